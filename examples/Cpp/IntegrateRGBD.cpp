@@ -82,15 +82,10 @@ int main(int argc, char *argv[]) {
 
     auto camera_trajectory =
             io::CreatePinholeCameraTrajectoryFromFile(log_filename);
-    std::string dir_name =
-            utility::filesystem::GetFileParentDirectory(match_filename).c_str();
-    FILE *file = utility::filesystem::FOpen(match_filename, "r");
-    if (file == NULL) {
-        utility::LogWarning("Unable to open file {}", match_filename);
-        fclose(file);
+    io::RGBDSequenceReader reader;
+    if (!reader.OpenAssociationFile(match_filename)) {
         return 0;
     }
-    char buffer[DEFAULT_IO_BUFFER_SIZE];
     int index = 0;
     int save_index = 0;
     integration::ScalableTSDFVolume volume(
@@ -99,50 +94,45 @@ int main(int argc, char *argv[]) {
     utility::FPSTimer timer("Process RGBD stream",
                             (int)camera_trajectory->parameters_.size());
     geometry::Image depth, color;
-    while (fgets(buffer, DEFAULT_IO_BUFFER_SIZE, file)) {
-        std::vector<std::string> st;
-        utility::SplitString(st, buffer, "\t\r\n ");
-        if (st.size() >= 2) {
-            utility::LogInfo("Processing frame {:d} ...", index);
-            io::ReadImage(dir_name + st[0], depth);
-            io::ReadImage(dir_name + st[1], color);
-            auto rgbd = geometry::RGBDImage::CreateFromColorAndDepth(
-                    color, depth, 1000.0, 4.0, false);
-            if (index == 0 ||
-                (every_k_frames > 0 && index % every_k_frames == 0)) {
-                volume.Reset();
+    while (!reader.IsEOF()) {
+        utility::LogInfo("Processing frame {:d} ...", index);
+        if (!reader.NextFrame(color, depth)) {
+            utility::LogWarning("Failed to read frame {:d}, stop.", index);
+            break;
+        }
+        auto rgbd = geometry::RGBDImage::CreateFromColorAndDepth(
+                color, depth, 1000.0, 4.0, false);
+        if (index == 0 || (every_k_frames > 0 && index % every_k_frames == 0)) {
+            volume.Reset();
+        }
+        volume.Integrate(*rgbd,
+                         camera_trajectory->parameters_[index].intrinsic_,
+                         camera_trajectory->parameters_[index].extrinsic_);
+        index++;
+        if (index == (int)camera_trajectory->parameters_.size() ||
+            (every_k_frames > 0 && index % every_k_frames == 0)) {
+            utility::LogInfo("Saving fragment {:d} ...", save_index);
+            std::string save_index_str = std::to_string(save_index);
+            if (save_pointcloud) {
+                utility::LogInfo("Saving pointcloud {:d} ...", save_index);
+                auto pcd = volume.ExtractPointCloud();
+                io::WritePointCloud("pointcloud_" + save_index_str + ".ply",
+                                    *pcd);
+            }
+            if (save_mesh) {
+                utility::LogInfo("Saving mesh {:d} ...", save_index);
+                auto mesh = volume.ExtractTriangleMesh();
+                io::WriteTriangleMesh("mesh_" + save_index_str + ".ply", *mesh);
             }
-            volume.Integrate(*rgbd,
-                             camera_trajectory->parameters_[index].intrinsic_,
-                             camera_trajectory->parameters_[index].extrinsic_);
-            index++;
-            if (index == (int)camera_trajectory->parameters_.size() ||
-                (every_k_frames > 0 && index % every_k_frames == 0)) {
-                utility::LogInfo("Saving fragment {:d} ...", save_index);
-                std::string save_index_str = std::to_string(save_index);
-                if (save_pointcloud) {
-                    utility::LogInfo("Saving pointcloud {:d} ...", save_index);
-                    auto pcd = volume.ExtractPointCloud();
-                    io::WritePointCloud("pointcloud_" + save_index_str + ".ply",
-                                        *pcd);
-                }
-                if (save_mesh) {
-                    utility::LogInfo("Saving mesh {:d} ...", save_index);
-                    auto mesh = volume.ExtractTriangleMesh();
-                    io::WriteTriangleMesh("mesh_" + save_index_str + ".ply",
-                                          *mesh);
-                }
-                if (save_voxel) {
-                    utility::LogInfo("Saving voxel {:d} ...", save_index);
-                    auto voxel = volume.ExtractVoxelPointCloud();
-                    io::WritePointCloud("voxel_" + save_index_str + ".ply",
-                                        *voxel);
-                }
-                save_index++;
+            if (save_voxel) {
+                utility::LogInfo("Saving voxel {:d} ...", save_index);
+                auto voxel = volume.ExtractVoxelPointCloud();
+                io::WritePointCloud("voxel_" + save_index_str + ".ply",
+                                    *voxel);
             }
-            timer.Signal();
+            save_index++;
         }
+        timer.Signal();
     }
-    fclose(file);
     return 0;
 }
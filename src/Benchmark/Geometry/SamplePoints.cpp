@@ -48,6 +48,19 @@ BENCHMARK_DEFINE_F(SamplePointsFixture, Poisson)(benchmark::State& state) {
 
 BENCHMARK_REGISTER_F(SamplePointsFixture, Poisson)->Args({123})->Args({1000});
 
+// Fixed seed, so that every iteration eliminates the same samples.
+BENCHMARK_DEFINE_F(SamplePointsFixture, PoissonSeeded)
+(benchmark::State& state) {
+    for (auto _ : state) {
+        trimesh->SamplePointsPoissonDisk(state.range(0), 5, nullptr, false, 0);
+    }
+}
+
+BENCHMARK_REGISTER_F(SamplePointsFixture, PoissonSeeded)
+        ->Args({1000})
+        ->Args({100000})
+        ->Unit(benchmark::kMillisecond);
+
 BENCHMARK_DEFINE_F(SamplePointsFixture, Uniform)(benchmark::State& state) {
     for (auto _ : state) {
         trimesh->SamplePointsUniformly(state.range(0));
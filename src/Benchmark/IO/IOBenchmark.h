@@ -0,0 +1,183 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <string>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "benchmark/benchmark.h"
+
+namespace open3d {
+namespace benchmarks {
+
+/// Random point cloud with normals and colors in [-10, 10]^3.
+inline geometry::PointCloud CreateRandomPointCloud(size_t num_points) {
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> position(-10.0, 10.0);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    geometry::PointCloud pcd;
+    pcd.points_.resize(num_points);
+    pcd.normals_.resize(num_points);
+    pcd.colors_.resize(num_points);
+    for (size_t i = 0; i < num_points; i++) {
+        pcd.points_[i] = {position(rng), position(rng), position(rng)};
+        pcd.normals_[i] = Eigen::Vector3d(unit(rng), unit(rng), unit(rng))
+                                  .normalized();
+        pcd.colors_[i] = {unit(rng), unit(rng), unit(rng)};
+    }
+    return pcd;
+}
+
+/// Random height field mesh with about \p num_vertices vertices, with vertex
+/// normals and colors.
+inline geometry::TriangleMesh CreateRandomTriangleMesh(size_t num_vertices) {
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> height(-0.1, 0.1);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    const int resolution =
+            std::max(2, (int)std::sqrt((double)num_vertices));
+    geometry::TriangleMesh mesh;
+    for (int y = 0; y < resolution; y++) {
+        for (int x = 0; x < resolution; x++) {
+            mesh.vertices_.emplace_back(x, y, height(rng));
+            mesh.vertex_colors_.emplace_back(unit(rng), unit(rng), unit(rng));
+        }
+    }
+    for (int y = 0; y + 1 < resolution; y++) {
+        for (int x = 0; x + 1 < resolution; x++) {
+            const int v = y * resolution + x;
+            mesh.triangles_.emplace_back(v, v + 1, v + resolution + 1);
+            mesh.triangles_.emplace_back(v, v + resolution + 1,
+                                         v + resolution);
+        }
+    }
+    mesh.ComputeVertexNormals();
+    return mesh;
+}
+
+/// Random 8 bit image of size \p width x \p width, with smooth gradients and
+/// noise so that the compressed size is representative of photographs.
+inline geometry::Image CreateRandomImage(int width, int num_of_channels) {
+    std::mt19937 rng(0);
+    std::uniform_int_distribution<int> noise(-8, 8);
+    geometry::Image image;
+    image.Prepare(width, width, num_of_channels, 1);
+    for (int v = 0; v < width; v++) {
+        for (int u = 0; u < width; u++) {
+            for (int c = 0; c < num_of_channels; c++) {
+                const int value = (u * (c + 1) + v * (3 - c)) * 255 /
+                                          (4 * width) +
+                                  noise(rng);
+                *image.PointerAt<uint8_t>(u, v, c) =
+                        (uint8_t)std::min(std::max(value, 0), 255);
+            }
+        }
+    }
+    return image;
+}
+
+inline int64_t GetFileSize(const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    return static_cast<int64_t>(file.tellg());
+}
+
+/// Returns the value of a "Key: value kB" line of /proc/self/status in bytes,
+/// or -1 if it is not available.
+inline int64_t GetProcessStatusBytes(const char* key) {
+#ifdef __linux__
+    std::ifstream file("/proc/self/status");
+    std::string line;
+    const size_t key_length = strlen(key);
+    while (std::getline(file, line)) {
+        if (line.compare(0, key_length, key) == 0 &&
+            line.size() > key_length && line[key_length] == ':') {
+            return std::stoll(line.substr(key_length + 1)) * 1024;
+        }
+    }
+#endif
+    return -1;
+}
+
+/// Resets the peak resident set size of the process. Returns false if the
+/// platform does not support it (Linux 4.0 and later do).
+inline bool ResetPeakMemory() {
+#ifdef __linux__
+    FILE* file = fopen("/proc/self/clear_refs", "w");
+    if (file == NULL) {
+        return false;
+    }
+    bool success = fputs("5", file) >= 0;
+    success = fclose(file) == 0 && success;
+    return success;
+#else
+    return false;
+#endif
+}
+
+/// \brief Runs \p f once and reports the growth of the peak resident set size
+/// over the resident set size before the call.
+///
+/// Sets the counters PeakRSS, in bytes, and Amplification, the ratio of
+/// PeakRSS to \p payload_bytes. Nothing is reported if the platform does not
+/// support resetting the peak.
+template <typename F>
+void ReportPeakMemory(benchmark::State& state, int64_t payload_bytes, F f) {
+#ifdef __GLIBC__
+    // Return the memory freed by previous runs to the system, otherwise it is
+    // reused without growing the resident set.
+    malloc_trim(0);
+#endif
+    const int64_t baseline = GetProcessStatusBytes("VmRSS");
+    if (baseline < 0 || !ResetPeakMemory()) {
+        f();
+        return;
+    }
+    f();
+    const int64_t peak =
+            std::max(GetProcessStatusBytes("VmHWM") - baseline, int64_t(0));
+    state.counters["PeakRSS"] =
+            benchmark::Counter((double)peak, benchmark::Counter::kDefaults,
+                               benchmark::Counter::kIs1024);
+    if (payload_bytes > 0) {
+        state.counters["Amplification"] = (double)peak / payload_bytes;
+    }
+}
+
+}  // namespace benchmarks
+}  // namespace open3d
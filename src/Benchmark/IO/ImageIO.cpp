@@ -0,0 +1,93 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <string>
+
+#include "Benchmark/IO/IOBenchmark.h"
+#include "Open3D/Geometry/Image.h"
+#include "Open3D/IO/ClassIO/ImageIO.h"
+#include "benchmark/benchmark.h"
+
+using namespace open3d;
+using namespace open3d::benchmarks;
+
+static void BM_WriteImage(benchmark::State& state,
+                          const std::string& format,
+                          int num_of_channels) {
+    const std::string filename = "benchmark_image." + format;
+    geometry::Image image = CreateRandomImage(state.range(0), num_of_channels);
+    auto write = [&]() { return io::WriteImage(filename, image); };
+    if (!write()) {
+        state.SkipWithError("WriteImage failed.");
+        return;
+    }
+    ReportPeakMemory(state, image.data_.size(), write);
+    for (auto _ : state) {
+        write();
+    }
+    state.SetBytesProcessed(state.iterations() * image.data_.size());
+    state.SetItemsProcessed(state.iterations() * image.width_ *
+                            image.height_);
+    std::remove(filename.c_str());
+}
+
+static void BM_ReadImage(benchmark::State& state,
+                         const std::string& format,
+                         int num_of_channels) {
+    const std::string filename = "benchmark_image." + format;
+    if (!io::WriteImage(filename,
+                        CreateRandomImage(state.range(0), num_of_channels))) {
+        state.SkipWithError("WriteImage failed.");
+        return;
+    }
+    geometry::Image image;
+    ReportPeakMemory(state, state.range(0) * state.range(0) * num_of_channels,
+                     [&]() { io::ReadImage(filename, image); });
+    for (auto _ : state) {
+        io::ReadImage(filename, image);
+    }
+    state.SetBytesProcessed(state.iterations() * image.data_.size());
+    state.SetItemsProcessed(state.iterations() * image.width_ *
+                            image.height_);
+    std::remove(filename.c_str());
+}
+
+// Bytes processed are the decoded image sizes, so that PNG and JPG rates are
+// comparable.
+#define REGISTER_IMAGE_IO_BENCHMARKS(NAME, FORMAT, CHANNELS)                 \
+    BENCHMARK_CAPTURE(BM_WriteImage, NAME, std::string(FORMAT), CHANNELS)    \
+            ->Arg(512)                                                       \
+            ->Arg(2048)                                                      \
+            ->Unit(benchmark::kMillisecond);                                 \
+    BENCHMARK_CAPTURE(BM_ReadImage, NAME, std::string(FORMAT), CHANNELS)     \
+            ->Arg(512)                                                       \
+            ->Arg(2048)                                                      \
+            ->Unit(benchmark::kMillisecond);
+
+REGISTER_IMAGE_IO_BENCHMARKS(png_gray, "png", 1)
+REGISTER_IMAGE_IO_BENCHMARKS(png_rgb, "png", 3)
+REGISTER_IMAGE_IO_BENCHMARKS(jpg_gray, "jpg", 1)
+REGISTER_IMAGE_IO_BENCHMARKS(jpg_rgb, "jpg", 3)
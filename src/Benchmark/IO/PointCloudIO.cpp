@@ -0,0 +1,104 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <string>
+
+#include "Benchmark/IO/IOBenchmark.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
+#include "benchmark/benchmark.h"
+
+using namespace open3d;
+using namespace open3d::benchmarks;
+
+static void BM_WritePointCloud(benchmark::State& state,
+                               const std::string& format,
+                               bool write_ascii,
+                               bool compressed) {
+    const std::string filename = "benchmark_point_cloud." + format;
+    geometry::PointCloud pcd = CreateRandomPointCloud(state.range(0));
+    auto write = [&]() {
+        return io::WritePointCloud(filename, pcd, write_ascii, compressed);
+    };
+    if (!write()) {
+        state.SkipWithError("WritePointCloud failed.");
+        return;
+    }
+    const int64_t file_size = GetFileSize(filename);
+    ReportPeakMemory(state, file_size, write);
+    for (auto _ : state) {
+        write();
+    }
+    state.SetBytesProcessed(state.iterations() * file_size);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    std::remove(filename.c_str());
+}
+
+static void BM_ReadPointCloud(benchmark::State& state,
+                              const std::string& format,
+                              bool write_ascii,
+                              bool compressed) {
+    const std::string filename = "benchmark_point_cloud." + format;
+    if (!io::WritePointCloud(filename, CreateRandomPointCloud(state.range(0)),
+                             write_ascii, compressed)) {
+        state.SkipWithError("WritePointCloud failed.");
+        return;
+    }
+    const int64_t file_size = GetFileSize(filename);
+    geometry::PointCloud pcd;
+    ReportPeakMemory(state, file_size,
+                     [&]() { io::ReadPointCloud(filename, pcd); });
+    for (auto _ : state) {
+        io::ReadPointCloud(filename, pcd);
+    }
+    state.SetBytesProcessed(state.iterations() * file_size);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    std::remove(filename.c_str());
+}
+
+#define REGISTER_POINT_CLOUD_IO_BENCHMARKS(NAME, FORMAT, ASCII, COMPRESSED) \
+    BENCHMARK_CAPTURE(BM_WritePointCloud, NAME, std::string(FORMAT), ASCII, \
+                      COMPRESSED)                                           \
+            ->Arg(100000)                                                   \
+            ->Arg(1000000)                                                  \
+            ->Unit(benchmark::kMillisecond);                                \
+    BENCHMARK_CAPTURE(BM_ReadPointCloud, NAME, std::string(FORMAT), ASCII,  \
+                      COMPRESSED)                                           \
+            ->Arg(100000)                                                   \
+            ->Arg(1000000)                                                  \
+            ->Unit(benchmark::kMillisecond);
+
+REGISTER_POINT_CLOUD_IO_BENCHMARKS(xyz, "xyz", true, false)
+REGISTER_POINT_CLOUD_IO_BENCHMARKS(xyzn, "xyzn", true, false)
+REGISTER_POINT_CLOUD_IO_BENCHMARKS(xyzrgb, "xyzrgb", true, false)
+REGISTER_POINT_CLOUD_IO_BENCHMARKS(pts, "pts", true, false)
+REGISTER_POINT_CLOUD_IO_BENCHMARKS(ply_ascii, "ply", true, false)
+REGISTER_POINT_CLOUD_IO_BENCHMARKS(ply_binary, "ply", false, false)
+REGISTER_POINT_CLOUD_IO_BENCHMARKS(pcd_ascii, "pcd", true, false)
+REGISTER_POINT_CLOUD_IO_BENCHMARKS(pcd_binary, "pcd", false, false)
+REGISTER_POINT_CLOUD_IO_BENCHMARKS(pcd_compressed, "pcd", false, true)
+REGISTER_POINT_CLOUD_IO_BENCHMARKS(tpc, "tpc", false, true)
+REGISTER_POINT_CLOUD_IO_BENCHMARKS(opc, "opc", false, true)
@@ -0,0 +1,102 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <string>
+
+#include "Benchmark/IO/IOBenchmark.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/IO/ClassIO/TriangleMeshIO.h"
+#include "benchmark/benchmark.h"
+
+using namespace open3d;
+using namespace open3d::benchmarks;
+
+static void BM_WriteTriangleMesh(benchmark::State& state,
+                                 const std::string& format,
+                                 bool write_ascii) {
+    const std::string filename = "benchmark_triangle_mesh." + format;
+    geometry::TriangleMesh mesh = CreateRandomTriangleMesh(state.range(0));
+    auto write = [&]() {
+        return io::WriteTriangleMesh(filename, mesh, write_ascii);
+    };
+    if (!write()) {
+        state.SkipWithError("WriteTriangleMesh failed.");
+        return;
+    }
+    const int64_t file_size = GetFileSize(filename);
+    ReportPeakMemory(state, file_size, write);
+    for (auto _ : state) {
+        write();
+    }
+    state.SetBytesProcessed(state.iterations() * file_size);
+    state.SetItemsProcessed(state.iterations() * mesh.vertices_.size());
+    std::remove(filename.c_str());
+}
+
+static void BM_ReadTriangleMesh(benchmark::State& state,
+                                const std::string& format,
+                                bool write_ascii) {
+    const std::string filename = "benchmark_triangle_mesh." + format;
+    const size_t num_vertices = [&]() -> size_t {
+        geometry::TriangleMesh mesh = CreateRandomTriangleMesh(state.range(0));
+        if (!io::WriteTriangleMesh(filename, mesh, write_ascii)) {
+            return 0;
+        }
+        return mesh.vertices_.size();
+    }();
+    if (num_vertices == 0) {
+        state.SkipWithError("WriteTriangleMesh failed.");
+        return;
+    }
+    const int64_t file_size = GetFileSize(filename);
+    geometry::TriangleMesh mesh;
+    ReportPeakMemory(state, file_size,
+                     [&]() { io::ReadTriangleMesh(filename, mesh); });
+    for (auto _ : state) {
+        io::ReadTriangleMesh(filename, mesh);
+    }
+    state.SetBytesProcessed(state.iterations() * file_size);
+    state.SetItemsProcessed(state.iterations() * num_vertices);
+    std::remove(filename.c_str());
+}
+
+#define REGISTER_TRIANGLE_MESH_IO_BENCHMARKS(NAME, FORMAT, ASCII)             \
+    BENCHMARK_CAPTURE(BM_WriteTriangleMesh, NAME, std::string(FORMAT), ASCII) \
+            ->Arg(100000)                                                     \
+            ->Arg(1000000)                                                    \
+            ->Unit(benchmark::kMillisecond);                                  \
+    BENCHMARK_CAPTURE(BM_ReadTriangleMesh, NAME, std::string(FORMAT), ASCII)  \
+            ->Arg(100000)                                                     \
+            ->Arg(1000000)                                                    \
+            ->Unit(benchmark::kMillisecond);
+
+REGISTER_TRIANGLE_MESH_IO_BENCHMARKS(ply_ascii, "ply", true)
+REGISTER_TRIANGLE_MESH_IO_BENCHMARKS(ply_binary, "ply", false)
+REGISTER_TRIANGLE_MESH_IO_BENCHMARKS(obj, "obj", true)
+REGISTER_TRIANGLE_MESH_IO_BENCHMARKS(stl, "stl", false)
+REGISTER_TRIANGLE_MESH_IO_BENCHMARKS(off, "off", true)
+REGISTER_TRIANGLE_MESH_IO_BENCHMARKS(gltf, "gltf", false)
+REGISTER_TRIANGLE_MESH_IO_BENCHMARKS(glb, "glb", false)
@@ -0,0 +1,286 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/AsRigidAsPossibleDeformer.h"
+
+#include <Eigen/Dense>
+#include <Eigen/Sparse>
+#include <algorithm>
+
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace geometry {
+
+AsRigidAsPossibleDeformer::AsRigidAsPossibleDeformer(
+        const TriangleMesh &mesh,
+        MeshBase::DeformAsRigidAsPossibleEnergy energy,
+        double smoothed_alpha)
+    : rest_vertices_(mesh.vertices_),
+      triangles_(mesh.triangles_),
+      energy_model_(energy),
+      smoothed_alpha_(smoothed_alpha) {
+    utility::LogDebug("[DeformAsRigidAsPossible] setting up S'");
+    const int num_vertices = int(rest_vertices_.size());
+    adjacency_ = MeshAdjacency::CreateVertexAdjacency(triangles_, num_vertices);
+    weights_ = mesh.ComputeAdjacencyWeightsCot(adjacency_, /*min_weight=*/0);
+    utility::LogDebug("[DeformAsRigidAsPossible] done setting up S'");
+
+    if (energy_model_ == MeshBase::DeformAsRigidAsPossibleEnergy::Smoothed) {
+        surface_area_ = mesh.GetSurfaceArea();
+    }
+    Reset();
+}
+
+void AsRigidAsPossibleDeformer::SetConstraints(
+        const std::vector<int> &constraint_vertex_indices) {
+    const int num_vertices = int(rest_vertices_.size());
+    rows_.assign(num_vertices, 0);
+    for (int idx : constraint_vertex_indices) {
+        if (idx < 0 || idx >= num_vertices) {
+            utility::LogError(
+                    "[DeformAsRigidAsPossible] constraint vertex index {:d} "
+                    "out of range",
+                    idx);
+        }
+        rows_[idx] = -1;
+    }
+    constraint_vertex_indices_ = constraint_vertex_indices;
+    num_rows_ = 0;
+    for (int i = 0; i < num_vertices; ++i) {
+        if (rows_[i] >= 0) {
+            rows_[i] = num_rows_++;
+        }
+    }
+
+    // The constrained vertices are moved to the right hand side, which keeps
+    // the system matrix symmetric positive definite.
+    utility::LogDebug("[DeformAsRigidAsPossible] setting up system matrix L");
+    std::vector<Eigen::Triplet<double>> triplets;
+    for (int i = 0; i < num_vertices; ++i) {
+        if (rows_[i] < 0) {
+            continue;
+        }
+        double W = 0;
+        for (int k = adjacency_.offsets_[i]; k < adjacency_.offsets_[i + 1];
+             ++k) {
+            int j = adjacency_.indices_[k];
+            if (j == i) {
+                continue;
+            }
+            if (rows_[j] >= 0) {
+                triplets.push_back(Eigen::Triplet<double>(rows_[i], rows_[j],
+                                                          -weights_[k]));
+            }
+            W += weights_[k];
+        }
+        // Vertices without weighted edges keep their position.
+        triplets.push_back(
+                Eigen::Triplet<double>(rows_[i], rows_[i], W > 0 ? W : 1));
+    }
+    Eigen::SparseMatrix<double> L(num_rows_, num_rows_);
+    L.setFromTriplets(triplets.begin(), triplets.end());
+    utility::LogDebug(
+            "[DeformAsRigidAsPossible] done setting up system matrix L");
+
+    utility::LogDebug("[DeformAsRigidAsPossible] setting up sparse solver");
+    factorized_ = false;
+    solver_.compute(L);
+    if (solver_.info() != Eigen::Success) {
+        utility::LogError(
+                "[DeformAsRigidAsPossible] Failed to build solver (factorize)");
+    }
+    factorized_ = true;
+    utility::LogDebug(
+            "[DeformAsRigidAsPossible] done setting up sparse solver");
+}
+
+std::shared_ptr<TriangleMesh> AsRigidAsPossibleDeformer::Deform(
+        const std::vector<Eigen::Vector3d> &constraint_vertex_positions,
+        size_t max_iter) {
+    if (!factorized_) {
+        utility::LogError(
+                "[DeformAsRigidAsPossible] SetConstraints has to be called "
+                "before Deform");
+    }
+    if (constraint_vertex_positions.size() !=
+        constraint_vertex_indices_.size()) {
+        utility::LogError(
+                "[DeformAsRigidAsPossible] {:d} constraint positions given "
+                "for {:d} constraint vertices",
+                constraint_vertex_positions.size(),
+                constraint_vertex_indices_.size());
+    }
+
+    for (size_t iter = 0; iter < max_iter; ++iter) {
+        // The rotations are fitted to the previous deformation, the smoothing
+        // term needs the rotations of the previous iteration. Both carry over
+        // from the previous call.
+        UpdateRotations(has_rotations_);
+        has_rotations_ = true;
+        for (size_t idx = 0; idx < constraint_vertex_indices_.size(); ++idx) {
+            vertices_[constraint_vertex_indices_[idx]] =
+                    constraint_vertex_positions[idx];
+        }
+        UpdatePositions();
+        energy_ = ComputeEnergy();
+        utility::LogDebug("[DeformAsRigidAsPossible] iter={}, energy={:e}",
+                          iter, energy_);
+    }
+
+    auto mesh = std::make_shared<TriangleMesh>();
+    mesh->vertices_ = vertices_;
+    mesh->triangles_ = triangles_;
+    return mesh;
+}
+
+void AsRigidAsPossibleDeformer::Reset() {
+    vertices_ = rest_vertices_;
+    rotations_.assign(rest_vertices_.size(), Eigen::Matrix3d::Identity());
+    previous_rotations_.assign(rest_vertices_.size(),
+                               Eigen::Matrix3d::Identity());
+    has_rotations_ = false;
+    energy_ = 0;
+}
+
+void AsRigidAsPossibleDeformer::UpdateRotations(bool smooth) {
+    const bool smoothed =
+            energy_model_ == MeshBase::DeformAsRigidAsPossibleEnergy::Smoothed;
+    if (smoothed) {
+        std::swap(rotations_, previous_rotations_);
+    }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < int(vertices_.size()); ++i) {
+        Eigen::Matrix3d S = Eigen::Matrix3d::Zero();
+        Eigen::Matrix3d R = Eigen::Matrix3d::Zero();
+        int n_nbs = 0;
+        for (int k = adjacency_.offsets_[i]; k < adjacency_.offsets_[i + 1];
+             ++k) {
+            int j = adjacency_.indices_[k];
+            Eigen::Vector3d e0 = rest_vertices_[i] - rest_vertices_[j];
+            Eigen::Vector3d e1 = vertices_[i] - vertices_[j];
+            S += weights_[k] * (e0 * e1.transpose());
+            if (smoothed) {
+                R += previous_rotations_[j];
+            }
+            n_nbs++;
+        }
+        if (smoothed && smooth && n_nbs > 0) {
+            S = 2 * S + (4 * smoothed_alpha_ * surface_area_ / n_nbs) *
+                                R.transpose();
+        }
+        Eigen::JacobiSVD<Eigen::Matrix3d> svd(
+                S, Eigen::ComputeFullU | Eigen::ComputeFullV);
+        Eigen::Matrix3d U = svd.matrixU();
+        Eigen::Matrix3d V = svd.matrixV();
+        Eigen::Vector3d D(1, 1, (V * U.transpose()).determinant());
+        // ensure rotation:
+        // http://graphics.stanford.edu/~smr/ICP/comparison/eggert_comparison_mva97.pdf
+        rotations_[i] = V * D.asDiagonal() * U.transpose();
+        if (rotations_[i].determinant() <= 0) {
+            utility::LogError(
+                    "[DeformAsRigidAsPossible] something went wrong with "
+                    "updating R");
+        }
+    }
+}
+
+void AsRigidAsPossibleDeformer::UpdatePositions() {
+    Eigen::MatrixXd b(num_rows_, 3);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < int(vertices_.size()); ++i) {
+        if (rows_[i] < 0) {
+            continue;
+        }
+        Eigen::Vector3d bi(0, 0, 0);
+        double W = 0;
+        for (int k = adjacency_.offsets_[i]; k < adjacency_.offsets_[i + 1];
+             ++k) {
+            int j = adjacency_.indices_[k];
+            if (j == i) {
+                continue;
+            }
+            double w = weights_[k];
+            bi += w / 2 *
+                  ((rotations_[i] + rotations_[j]) *
+                   (rest_vertices_[i] - rest_vertices_[j]));
+            if (rows_[j] < 0) {
+                bi += w * vertices_[j];
+            }
+            W += w;
+        }
+        b.row(rows_[i]) = (W > 0 ? bi : vertices_[i]).transpose();
+    }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int comp = 0; comp < 3; ++comp) {
+        Eigen::VectorXd p_prime = solver_.solve(b.col(comp));
+        if (solver_.info() != Eigen::Success) {
+            utility::LogError(
+                    "[DeformAsRigidAsPossible] Cholesky solve failed");
+        }
+        for (int i = 0; i < int(vertices_.size()); ++i) {
+            if (rows_[i] >= 0) {
+                vertices_[i](comp) = p_prime(rows_[i]);
+            }
+        }
+    }
+}
+
+double AsRigidAsPossibleDeformer::ComputeEnergy() const {
+    const bool smoothed =
+            energy_model_ == MeshBase::DeformAsRigidAsPossibleEnergy::Smoothed;
+    double energy = 0;
+    double reg = 0;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) reduction(+ : energy, reg)
+#endif
+    for (int i = 0; i < int(vertices_.size()); ++i) {
+        for (int k = adjacency_.offsets_[i]; k < adjacency_.offsets_[i + 1];
+             ++k) {
+            int j = adjacency_.indices_[k];
+            Eigen::Vector3d e0 = rest_vertices_[i] - rest_vertices_[j];
+            Eigen::Vector3d e1 = vertices_[i] - vertices_[j];
+            Eigen::Vector3d diff = e1 - rotations_[i] * e0;
+            energy += weights_[k] * diff.squaredNorm();
+            if (smoothed) {
+                reg += (rotations_[i] - rotations_[j]).squaredNorm();
+            }
+        }
+    }
+    if (smoothed) {
+        energy = energy + smoothed_alpha_ * surface_area_ * reg;
+    }
+    return energy;
+}
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,121 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <Eigen/SparseCholesky>
+#include <memory>
+#include <vector>
+
+#include "Open3D/Geometry/MeshAdjacency.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+
+namespace open3d {
+namespace geometry {
+
+/// \class AsRigidAsPossibleDeformer
+///
+/// \brief Deforms a triangle mesh with the method by Sorkine and Alexa,
+/// "As-Rigid-As-Possible Surface Modeling", 2007, for a sequence of handle
+/// positions.
+///
+/// The adjacency and the cotangent weights of the rest pose are computed once.
+/// The Cholesky factorization of the system matrix is computed once per set
+/// of constrained vertices. Every call to Deform starts from the result of
+/// the previous call, so a few iterations per call suffice while the handles
+/// move interactively.
+class AsRigidAsPossibleDeformer {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param mesh Rest pose of the deformation.
+    /// \param energy Energy model that should be optimized.
+    /// \param smoothed_alpha Alpha parameter of the smoothed ARAP model.
+    AsRigidAsPossibleDeformer(
+            const TriangleMesh &mesh,
+            MeshBase::DeformAsRigidAsPossibleEnergy energy =
+                    MeshBase::DeformAsRigidAsPossibleEnergy::Spokes,
+            double smoothed_alpha = 0.01);
+    ~AsRigidAsPossibleDeformer() {}
+
+public:
+    /// \brief Sets the constrained vertices and factorizes the system matrix.
+    ///
+    /// Every connected component of the mesh needs at least one constrained
+    /// vertex. The current deformation is kept.
+    /// \param constraint_vertex_indices Indices of the triangle vertices that
+    /// are moved to the positions passed to Deform.
+    void SetConstraints(const std::vector<int> &constraint_vertex_indices);
+
+    /// \brief Moves the constrained vertices and minimizes the energy,
+    /// starting from the previous deformation.
+    ///
+    /// \param constraint_vertex_positions Position of every constrained
+    /// vertex, in the order of the indices passed to SetConstraints.
+    /// \param max_iter Number of iterations to minimize energy functional.
+    /// \return The deformed TriangleMesh.
+    std::shared_ptr<TriangleMesh> Deform(
+            const std::vector<Eigen::Vector3d> &constraint_vertex_positions,
+            size_t max_iter);
+
+    /// Starts the next deformation from the rest pose.
+    void Reset();
+
+    /// Returns the energy after the last iteration of Deform.
+    double GetEnergy() const { return energy_; }
+
+private:
+    void UpdateRotations(bool smooth);
+    void UpdatePositions();
+    double ComputeEnergy() const;
+
+private:
+    std::vector<Eigen::Vector3d> rest_vertices_;
+    std::vector<Eigen::Vector3i> triangles_;
+    MeshBase::DeformAsRigidAsPossibleEnergy energy_model_;
+    double smoothed_alpha_;
+    double surface_area_ = -1;
+    MeshAdjacency adjacency_;
+    /// Cotangent weight of the edge to adjacency_.indices_[k].
+    std::vector<double> weights_;
+
+    std::vector<int> constraint_vertex_indices_;
+    /// Row of every vertex in the system matrix, -1 for constrained vertices.
+    std::vector<int> rows_;
+    int num_rows_ = 0;
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> solver_;
+    bool factorized_ = false;
+
+    std::vector<Eigen::Vector3d> vertices_;
+    std::vector<Eigen::Matrix3d> rotations_;
+    std::vector<Eigen::Matrix3d> previous_rotations_;
+    bool has_rotations_ = false;
+    double energy_ = 0;
+};
+
+}  // namespace geometry
+}  // namespace open3d
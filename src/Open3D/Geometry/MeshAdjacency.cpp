@@ -0,0 +1,179 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/MeshAdjacency.h"
+
+#include <algorithm>
+#include <atomic>
+
+namespace open3d {
+namespace geometry {
+
+std::vector<std::unordered_set<int>> MeshAdjacency::ToAdjacencyList() const {
+    std::vector<std::unordered_set<int>> adjacency_list(Size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int idx = 0; idx < Size(); idx++) {
+        Neighbors neighbors = (*this)[idx];
+        adjacency_list[idx].insert(neighbors.begin(), neighbors.end());
+    }
+    return adjacency_list;
+}
+
+MeshAdjacency MeshAdjacency::CreateVertexAdjacency(
+        const std::vector<Eigen::Vector3i> &triangles, int num_vertices) {
+    MeshAdjacency vertex_triangles =
+            CreateVertexTriangles(triangles, num_vertices);
+
+    // Every triangle adds at most two neighbors to each of its vertices, so
+    // collect them in place and compact afterwards.
+    std::vector<int> neighbors(vertex_triangles.indices_.size() * 2);
+    std::vector<int> counts(num_vertices);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int vidx = 0; vidx < num_vertices; vidx++) {
+        int *begin = neighbors.data() + 2 * vertex_triangles.offsets_[vidx];
+        int *end = begin;
+        for (int tidx : vertex_triangles[vidx]) {
+            const Eigen::Vector3i &triangle = triangles[tidx];
+            int num_corners = 0;
+            for (int i = 0; i < 3; i++) {
+                if (triangle(i) != vidx) {
+                    *end++ = triangle(i);
+                } else {
+                    num_corners++;
+                }
+            }
+            // A degenerate triangle connects the vertex to itself.
+            if (num_corners > 1) {
+                *end++ = vidx;
+            }
+        }
+        std::sort(begin, end);
+        counts[vidx] = int(std::unique(begin, end) - begin);
+    }
+
+    MeshAdjacency adjacency;
+    adjacency.offsets_.resize(num_vertices + 1);
+    adjacency.offsets_[0] = 0;
+    for (int vidx = 0; vidx < num_vertices; vidx++) {
+        adjacency.offsets_[vidx + 1] = adjacency.offsets_[vidx] + counts[vidx];
+    }
+    adjacency.indices_.resize(adjacency.offsets_[num_vertices]);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int vidx = 0; vidx < num_vertices; vidx++) {
+        const int *begin =
+                neighbors.data() + 2 * vertex_triangles.offsets_[vidx];
+        std::copy(begin, begin + counts[vidx],
+                  adjacency.indices_.begin() + adjacency.offsets_[vidx]);
+    }
+    return adjacency;
+}
+
+MeshAdjacency MeshAdjacency::CreateVertexTriangles(
+        const std::vector<Eigen::Vector3i> &triangles, int num_vertices) {
+    const int num_triangles = int(triangles.size());
+    // A triangle that references a vertex several times is listed once.
+    auto IsFirstCorner = [&](const Eigen::Vector3i &triangle, int i) {
+        return (i < 1 || triangle(i) != triangle(0)) &&
+               (i < 2 || triangle(i) != triangle(1));
+    };
+
+    std::vector<std::atomic<int>> cursors(num_vertices);
+    for (auto &cursor : cursors) {
+        cursor.store(0, std::memory_order_relaxed);
+    }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int tidx = 0; tidx < num_triangles; tidx++) {
+        for (int i = 0; i < 3; i++) {
+            if (IsFirstCorner(triangles[tidx], i)) {
+                cursors[triangles[tidx](i)].fetch_add(
+                        1, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    MeshAdjacency adjacency;
+    adjacency.offsets_.resize(num_vertices + 1);
+    adjacency.offsets_[0] = 0;
+    for (int vidx = 0; vidx < num_vertices; vidx++) {
+        adjacency.offsets_[vidx + 1] =
+                adjacency.offsets_[vidx] + cursors[vidx].load();
+        cursors[vidx].store(adjacency.offsets_[vidx]);
+    }
+    adjacency.indices_.resize(adjacency.offsets_[num_vertices]);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int tidx = 0; tidx < num_triangles; tidx++) {
+        for (int i = 0; i < 3; i++) {
+            if (IsFirstCorner(triangles[tidx], i)) {
+                adjacency.indices_[cursors[triangles[tidx](i)].fetch_add(1)] =
+                        tidx;
+            }
+        }
+    }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int vidx = 0; vidx < num_vertices; vidx++) {
+        std::sort(adjacency.indices_.begin() + adjacency.offsets_[vidx],
+                  adjacency.indices_.begin() + adjacency.offsets_[vidx + 1]);
+    }
+    return adjacency;
+}
+
+MeshAdjacency MeshAdjacency::CreateFromAdjacencyList(
+        const std::vector<std::unordered_set<int>> &adjacency_list) {
+    const int size = int(adjacency_list.size());
+    MeshAdjacency adjacency;
+    adjacency.offsets_.resize(size + 1);
+    adjacency.offsets_[0] = 0;
+    for (int idx = 0; idx < size; idx++) {
+        adjacency.offsets_[idx + 1] =
+                adjacency.offsets_[idx] + int(adjacency_list[idx].size());
+    }
+    adjacency.indices_.resize(adjacency.offsets_[size]);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int idx = 0; idx < size; idx++) {
+        auto begin = adjacency.indices_.begin() + adjacency.offsets_[idx];
+        std::copy(adjacency_list[idx].begin(), adjacency_list[idx].end(),
+                  begin);
+        std::sort(begin, begin + adjacency_list[idx].size());
+    }
+    return adjacency;
+}
+
+}  // namespace geometry
+}  // namespace open3d
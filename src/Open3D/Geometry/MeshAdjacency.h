@@ -0,0 +1,111 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <unordered_set>
+#include <vector>
+
+namespace open3d {
+namespace geometry {
+
+/// \class MeshAdjacency
+///
+/// \brief Adjacency of mesh elements in compressed sparse row layout.
+///
+/// The neighbors of element i are stored in increasing order in indices_,
+/// from indices_[offsets_[i]] to indices_[offsets_[i + 1] - 1]. It takes one
+/// integer per neighbor and a loop over the neighbors of consecutive
+/// elements reads memory sequentially.
+class MeshAdjacency {
+public:
+    /// \class Neighbors
+    ///
+    /// \brief Range over the neighbors of an element.
+    class Neighbors {
+    public:
+        Neighbors(const int *begin, const int *end)
+            : begin_(begin), end_(end) {}
+        const int *begin() const { return begin_; }
+        const int *end() const { return end_; }
+        size_t size() const { return size_t(end_ - begin_); }
+
+    private:
+        const int *begin_;
+        const int *end_;
+    };
+
+public:
+    /// \brief Default Constructor.
+    MeshAdjacency() {}
+    ~MeshAdjacency() {}
+
+public:
+    /// Returns the number of elements.
+    int Size() const { return offsets_.empty() ? 0 : int(offsets_.size()) - 1; }
+
+    /// Returns the neighbors of element \p idx.
+    Neighbors operator[](int idx) const {
+        return Neighbors(indices_.data() + offsets_[idx],
+                         indices_.data() + offsets_[idx + 1]);
+    }
+
+    /// Returns the adjacency as one set of neighbors per element, as in
+    /// TriangleMesh::adjacency_list_.
+    std::vector<std::unordered_set<int>> ToAdjacencyList() const;
+
+    /// \brief Factory function to compute the adjacent vertices of every
+    /// vertex of a triangle mesh in parallel.
+    ///
+    /// \param triangles Triangles of the mesh.
+    /// \param num_vertices Number of vertices of the mesh.
+    static MeshAdjacency CreateVertexAdjacency(
+            const std::vector<Eigen::Vector3i> &triangles, int num_vertices);
+
+    /// \brief Factory function to compute the triangles incident to every
+    /// vertex of a triangle mesh in parallel.
+    ///
+    /// \param triangles Triangles of the mesh.
+    /// \param num_vertices Number of vertices of the mesh.
+    static MeshAdjacency CreateVertexTriangles(
+            const std::vector<Eigen::Vector3i> &triangles, int num_vertices);
+
+    /// \brief Factory function to create the adjacency from one set of
+    /// neighbors per element, as in TriangleMesh::adjacency_list_.
+    static MeshAdjacency CreateFromAdjacencyList(
+            const std::vector<std::unordered_set<int>> &adjacency_list);
+
+public:
+    /// Start of the neighbors of every element in indices_, followed by the
+    /// total number of neighbors.
+    std::vector<int> offsets_;
+    /// Neighbors of all elements.
+    std::vector<int> indices_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
@@ -32,9 +32,14 @@
 
 #include <Eigen/Dense>
 
+#include <algorithm>
 #include <iostream>
 #include <list>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 namespace open3d {
 namespace geometry {
 
@@ -346,8 +351,7 @@ public:
                           edge->source_->idx_, edge->target_->idx_,
                           mp.transpose());
 
-        BallPivotingTrianglePtr triangle = edge->triangle0_;
-        const Eigen::Vector3d& center = triangle->ball_center_;
+        const Eigen::Vector3d& center = edge->triangle0_->ball_center_;
         utility::LogDebug("[FindCandidateVertex] edge=({}, {}), center={}",
                           edge->source_->idx_, edge->target_->idx_,
                           center.transpose());
@@ -571,8 +575,14 @@ public:
         return true;
     }
 
-    bool TrySeed(BallPivotingVertexPtr& v, double radius) {
-        utility::LogDebug("[TrySeed] with v.idx={}, radius={}", v->idx_,
+    // Searches the first pair of orphan neighbors that forms a seed triangle
+    // with v. Only reads the triangulation, so it can run in parallel.
+    bool FindSeed(const BallPivotingVertexPtr& v,
+                  double radius,
+                  int& seed_vidx0,
+                  int& seed_vidx1,
+                  Eigen::Vector3d& seed_center) {
+        utility::LogDebug("[FindSeed] with v.idx={}, radius={}", v->idx_,
                           radius);
         std::vector<int> indices;
         std::vector<double> dists2;
@@ -626,44 +636,120 @@ public:
                     continue;
                 }
 
-                CreateTriangle(v, nb0, nb1, center);
-
-                e0 = GetLinkingEdge(v, nb1);
-                e1 = GetLinkingEdge(nb0, nb1);
-                e2 = GetLinkingEdge(v, nb0);
-                if (e0->type_ == BallPivotingEdge::Type::Front) {
-                    edge_front_.push_front(e0);
-                }
-                if (e1->type_ == BallPivotingEdge::Type::Front) {
-                    edge_front_.push_front(e1);
-                }
-                if (e2->type_ == BallPivotingEdge::Type::Front) {
-                    edge_front_.push_front(e2);
-                }
-
-                if (edge_front_.size() > 0) {
-                    utility::LogDebug(
-                            "[TrySeed] edge_front_.size() > 0 => return "
-                            "true");
-                    return true;
-                }
+                seed_vidx0 = nb0->idx_;
+                seed_vidx1 = candidate_vidx2;
+                seed_center = center;
+                utility::LogDebug("[FindSeed] return true");
+                return true;
             }
         }
 
-        utility::LogDebug("[TrySeed] return false");
+        utility::LogDebug("[FindSeed] return false");
         return false;
     }
 
+    void CreateSeedTriangle(const BallPivotingVertexPtr& v,
+                            const BallPivotingVertexPtr& nb0,
+                            const BallPivotingVertexPtr& nb1,
+                            const Eigen::Vector3d& center) {
+        CreateTriangle(v, nb0, nb1, center);
+
+        BallPivotingEdgePtr e0 = GetLinkingEdge(v, nb1);
+        BallPivotingEdgePtr e1 = GetLinkingEdge(nb0, nb1);
+        BallPivotingEdgePtr e2 = GetLinkingEdge(v, nb0);
+        if (e0->type_ == BallPivotingEdge::Type::Front) {
+            edge_front_.push_front(e0);
+        }
+        if (e1->type_ == BallPivotingEdge::Type::Front) {
+            edge_front_.push_front(e1);
+        }
+        if (e2->type_ == BallPivotingEdge::Type::Front) {
+            edge_front_.push_front(e2);
+        }
+    }
+
+    // The seeds of a block of vertices are searched in parallel and then
+    // created in vertex order. Vertices never become orphans again, so a seed
+    // found earlier is still the first valid one as long as its vertices are
+    // orphans, and a vertex without seed stays without seed. Otherwise the
+    // seed is searched again.
     void FindSeedTriangle(double radius) {
-        for (size_t vidx = 0; vidx < vertices.size(); ++vidx) {
-            utility::LogDebug("[FindSeedTriangle] with radius={}, vidx={}",
-                              radius, vidx);
-            if (vertices[vidx]->type_ == BallPivotingVertex::Type::Orphan) {
-                if (TrySeed(vertices[vidx], radius)) {
-                    ExpandTriangulation(radius);
+#ifdef _OPENMP
+        const int num_threads = omp_get_max_threads();
+        const size_t block_size = num_threads > 1 ? 16 * num_threads : 1;
+#else
+        const size_t block_size = 1;
+#endif
+        std::vector<int> has_seed(block_size);
+        std::vector<Eigen::Vector2i> seeds(block_size);
+        std::vector<Eigen::Vector3d> centers(block_size);
+        for (size_t begin = 0; begin < vertices.size(); begin += block_size) {
+            int end = int(std::min(begin + block_size, vertices.size()));
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+            for (int vidx = int(begin); vidx < end; ++vidx) {
+                size_t i = vidx - begin;
+                has_seed[i] = 0;
+                if (vertices[vidx]->type_ == BallPivotingVertex::Type::Orphan) {
+                    has_seed[i] = FindSeed(vertices[vidx], radius, seeds[i](0),
+                                           seeds[i](1), centers[i]);
+                }
+            }
+
+            for (int vidx = int(begin); vidx < end; ++vidx) {
+                size_t i = vidx - begin;
+                utility::LogDebug("[FindSeedTriangle] with radius={}, vidx={}",
+                                  radius, vidx);
+                const BallPivotingVertexPtr& v = vertices[vidx];
+                if (!has_seed[i] ||
+                    v->type_ != BallPivotingVertex::Type::Orphan) {
+                    continue;
+                }
+                if (vertices[seeds[i](0)]->type_ !=
+                            BallPivotingVertex::Type::Orphan ||
+                    vertices[seeds[i](1)]->type_ !=
+                            BallPivotingVertex::Type::Orphan) {
+                    if (!FindSeed(v, radius, seeds[i](0), seeds[i](1),
+                                  centers[i])) {
+                        continue;
+                    }
                 }
+                CreateSeedTriangle(v, vertices[seeds[i](0)],
+                                   vertices[seeds[i](1)], centers[i]);
+                ExpandTriangulation(radius);
+            }
+        }
+    }
+
+    // Checks if the ball of the given radius still rests on the triangle of a
+    // border edge without containing other points.
+    bool IsEmptyBallOnBorderEdge(const BallPivotingEdgePtr& edge,
+                                 double radius) {
+        const BallPivotingTrianglePtr& triangle = edge->triangle0_;
+        utility::LogDebug("[Run] try edge {:d}-{:d} of triangle {:d}-{:d}-{:d}",
+                          edge->source_->idx_, edge->target_->idx_,
+                          triangle->vert0_->idx_, triangle->vert1_->idx_,
+                          triangle->vert2_->idx_);
+
+        Eigen::Vector3d center;
+        if (!ComputeBallCenter(triangle->vert0_->idx_, triangle->vert1_->idx_,
+                               triangle->vert2_->idx_, radius, center)) {
+            return false;
+        }
+        utility::LogDebug("[Run]   yes, we can work on this");
+        std::vector<int> indices;
+        std::vector<double> dists2;
+        kdtree_.SearchRadius(center, radius, indices, dists2);
+        for (auto idx : indices) {
+            if (idx != triangle->vert0_->idx_ &&
+                idx != triangle->vert1_->idx_ &&
+                idx != triangle->vert2_->idx_) {
+                utility::LogDebug("[Run]   but no, the ball is not empty");
+                return false;
             }
         }
+        return true;
     }
 
     std::shared_ptr<TriangleMesh> Run(const std::vector<double>& radii) {
@@ -682,46 +768,27 @@ public:
             }
 
             // update radius => update border edges
-            for (auto it = border_edges_.begin(); it != border_edges_.end();) {
-                BallPivotingEdgePtr edge = *it;
-                BallPivotingTrianglePtr triangle = edge->triangle0_;
-                utility::LogDebug(
-                        "[Run] try edge {:d}-{:d} of triangle {:d}-{:d}-{:d}",
-                        edge->source_->idx_, edge->target_->idx_,
-                        triangle->vert0_->idx_, triangle->vert1_->idx_,
-                        triangle->vert2_->idx_);
-
-                Eigen::Vector3d center;
-                if (ComputeBallCenter(triangle->vert0_->idx_,
-                                      triangle->vert1_->idx_,
-                                      triangle->vert2_->idx_, radius, center)) {
-                    utility::LogDebug("[Run]   yes, we can work on this");
-                    std::vector<int> indices;
-                    std::vector<double> dists2;
-                    kdtree_.SearchRadius(center, radius, indices, dists2);
-                    bool empty_ball = true;
-                    for (auto idx : indices) {
-                        if (idx != triangle->vert0_->idx_ &&
-                            idx != triangle->vert1_->idx_ &&
-                            idx != triangle->vert2_->idx_) {
-                            utility::LogDebug(
-                                    "[Run]   but no, the ball is not empty");
-                            empty_ball = false;
-                            break;
-                        }
-                    }
-
-                    if (empty_ball) {
-                        utility::LogDebug(
-                                "[Run]   yeah, add edge to edge_front_: {:d}",
-                                edge_front_.size());
-                        edge->type_ = BallPivotingEdge::Type::Front;
-                        edge_front_.push_back(edge);
-                        it = border_edges_.erase(it);
-                        continue;
-                    }
+            std::vector<BallPivotingEdgePtr> edges(border_edges_.begin(),
+                                                   border_edges_.end());
+            std::vector<int> is_empty_ball(edges.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+            for (int eidx = 0; eidx < int(edges.size()); ++eidx) {
+                is_empty_ball[eidx] =
+                        IsEmptyBallOnBorderEdge(edges[eidx], radius);
+            }
+            border_edges_.clear();
+            for (size_t eidx = 0; eidx < edges.size(); ++eidx) {
+                if (is_empty_ball[eidx]) {
+                    utility::LogDebug(
+                            "[Run]   yeah, add edge to edge_front_: {:d}",
+                            edge_front_.size());
+                    edges[eidx]->type_ = BallPivotingEdge::Type::Front;
+                    edge_front_.push_back(edges[eidx]);
+                } else {
+                    border_edges_.push_back(edges[eidx]);
                 }
-                ++it;
             }
 
             // do the reconstruction
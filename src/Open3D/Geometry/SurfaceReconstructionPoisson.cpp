@@ -29,12 +29,19 @@
 #include "Open3D/Utility/Console.h"
 
 #include <Eigen/Dense>
+#include <algorithm>
 #include <cfloat>
 #include <cmath>
 #include <cstdio>
 #include <cstdlib>
 #include <iostream>
 #include <list>
+#include <mutex>
+#include <thread>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 // clang-format off
 #include "PoissonRecon/Src/PreProcessor.h"
@@ -330,7 +337,8 @@ void ExtractMesh(
         const SetVertexFunction& SetVertex,
         XForm<Real, sizeof...(FEMSigs) + 1> iXForm,
         std::shared_ptr<open3d::geometry::TriangleMesh>& out_mesh,
-        std::vector<double>& out_densities) {
+        std::vector<double>& out_densities,
+        bool compute_densities) {
     static const int Dim = sizeof...(FEMSigs);
     typedef UIntPack<FEMSigs...> Sigs;
     static const unsigned int DataSig =
@@ -376,7 +384,14 @@ void ExtractMesh(
 
     mesh->resetIterator();
     out_densities.clear();
-    for (size_t vidx = 0; vidx < mesh->outOfCorePointCount(); ++vidx) {
+    size_t num_vertices = mesh->outOfCorePointCount();
+    out_mesh->vertices_.reserve(num_vertices);
+    out_mesh->vertex_normals_.reserve(num_vertices);
+    out_mesh->vertex_colors_.reserve(num_vertices);
+    if (compute_densities) {
+        out_densities.reserve(num_vertices);
+    }
+    for (size_t vidx = 0; vidx < num_vertices; ++vidx) {
         Vertex v;
         mesh->nextOutOfCorePoint(v);
         v.point = iXForm * v.point;
@@ -384,8 +399,11 @@ void ExtractMesh(
                 Eigen::Vector3d(v.point[0], v.point[1], v.point[2]));
         out_mesh->vertex_normals_.push_back(v.normal_);
         out_mesh->vertex_colors_.push_back(v.color_);
-        out_densities.push_back(v.w_);
+        if (compute_densities) {
+            out_densities.push_back(v.w_);
+        }
     }
+    out_mesh->triangles_.reserve(mesh->polygonCount());
     for (size_t tidx = 0; tidx < mesh->polygonCount(); ++tidx) {
         std::vector<CoredVertexIndex<node_index_type>> triangle;
         mesh->nextPolygon(triangle);
@@ -404,10 +422,7 @@ template <class Real, typename... SampleData, unsigned int... FEMSigs>
 void Execute(const open3d::geometry::PointCloud& pcd,
              std::shared_ptr<open3d::geometry::TriangleMesh>& out_mesh,
              std::vector<double>& out_densities,
-             int depth,
-             size_t width,
-             float scale,
-             bool linear_fit,
+             const open3d::geometry::PoissonReconstructionOption& option,
              UIntPack<FEMSigs...>) {
     static const int Dim = sizeof...(FEMSigs);
     typedef UIntPack<FEMSigs...> Sigs;
@@ -425,16 +440,21 @@ void Execute(const open3d::geometry::PointCloud& pcd,
     XForm<Real, Dim + 1> xForm, iXForm;
     xForm = XForm<Real, Dim + 1>::Identity();
 
+    int depth = option.depth_;
+    float width = static_cast<float>(option.width_);
+    float scale = static_cast<float>(option.scale_);
+    bool linear_fit = option.linear_fit_;
     float datax = 32.f;
     int base_depth = 0;
     int base_v_cycles = 1;
     float confidence = 0.f;
-    float point_weight = 2.f * DEFAULT_FEM_DEGREE;
+    float point_weight = static_cast<float>(option.point_weight_);
     float confidence_bias = 0.f;
     float samples_per_node = 1.5f;
     float cg_solver_accuracy = 1e-3f;
-    int full_depth = 5;
-    int iters = 8;
+    int full_depth = option.full_depth_;
+    int cg_depth = option.cg_depth_;
+    int iters = option.iterations_;
     bool exact_interpolation = false;
 
     double startTime = Time();
@@ -660,7 +680,7 @@ void Execute(const open3d::geometry::PointCloud& pcd,
         {
             profiler.start();
             typename FEMTree<Dim, Real>::SolverInfo sInfo;
-            sInfo.cgDepth = 0, sInfo.cascadic = true, sInfo.vCycles = 1,
+            sInfo.cgDepth = cg_depth, sInfo.cascadic = true, sInfo.vCycles = 1,
             sInfo.iters = iters, sInfo.cgAccuracy = cg_solver_accuracy,
             sInfo.verbose = utility::Logger::i().verbosity_level_ ==
                             utility::VerbosityLevel::Debug,
@@ -716,13 +736,52 @@ void Execute(const open3d::geometry::PointCloud& pcd,
     ExtractMesh<Open3DVertex<Real>, Real>(
             datax, linear_fit, UIntPack<FEMSigs...>(),
             std::tuple<SampleData...>(), tree, solution, isoValue, &samples,
-            &sampleData, density, SetVertex, iXForm, out_mesh, out_densities);
+            &sampleData, density, SetVertex, iXForm, out_mesh, out_densities,
+            option.compute_densities_);
 
     if (density) delete density, density = NULL;
     utility::LogDebug("#          Total Solve: {:9.1f} (s), {:9.1f} (MB)",
                       Time() - startTime, FEMTree<Dim, Real>::MaxMemoryUsage());
 }
 
+// PoissonRecon keeps its threads in the global ThreadPool. The pool is
+// started on first use and only restarted when the requested thread count
+// changes, so that batches of reconstructions do not pay the start-up cost on
+// every call. Since there is a single global pool, a pool per thread count is
+// not possible: the lock returned by Acquire is held for the whole
+// reconstruction, so concurrent calls run one at a time.
+class PersistentThreadPool {
+public:
+    ~PersistentThreadPool() {
+        if (num_threads_ > 0) {
+            ThreadPool::Terminate();
+        }
+    }
+
+    std::unique_lock<std::mutex> Acquire(int num_threads) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (num_threads != num_threads_) {
+            if (num_threads_ > 0) {
+                ThreadPool::Terminate();
+            }
+#ifdef _OPENMP
+            ThreadPool::Init((ThreadPool::ParallelType)(int)ThreadPool::OPEN_MP,
+                             num_threads);
+#else
+            ThreadPool::Init(
+                    (ThreadPool::ParallelType)(int)ThreadPool::THREAD_POOL,
+                    num_threads);
+#endif
+            num_threads_ = num_threads;
+        }
+        return lock;
+    }
+
+private:
+    std::mutex mutex_;
+    int num_threads_ = 0;
+};
+
 }  // namespace poisson
 
 std::tuple<std::shared_ptr<TriangleMesh>, std::vector<double>>
@@ -731,6 +790,17 @@ TriangleMesh::CreateFromPointCloudPoisson(const PointCloud& pcd,
                                           size_t width,
                                           float scale,
                                           bool linear_fit) {
+    PoissonReconstructionOption option;
+    option.depth_ = static_cast<int>(depth);
+    option.width_ = static_cast<double>(width);
+    option.scale_ = scale;
+    option.linear_fit_ = linear_fit;
+    return CreateFromPointCloudPoisson(pcd, option);
+}
+
+std::tuple<std::shared_ptr<TriangleMesh>, std::vector<double>>
+TriangleMesh::CreateFromPointCloudPoisson(
+        const PointCloud& pcd, const PoissonReconstructionOption& option) {
     static const BoundaryType BType = poisson::DEFAULT_FEM_BOUNDARY;
     typedef IsotropicUIntPack<
             poisson::DIMENSION,
@@ -740,21 +810,30 @@ TriangleMesh::CreateFromPointCloudPoisson(const PointCloud& pcd,
     if (!pcd.HasNormals()) {
         utility::LogError("[CreateFromPointCloudPoisson] pcd has no normals");
     }
+    if (option.iterations_ < 1 || option.full_depth_ < 0 ||
+        option.cg_depth_ < 0 || option.point_weight_ < 0) {
+        utility::LogError(
+                "[CreateFromPointCloudPoisson] iterations (={}) has to be "
+                ">= 1, full_depth (={}), cg_depth (={}) and point_weight "
+                "(={}) have to be >= 0",
+                option.iterations_, option.full_depth_, option.cg_depth_,
+                option.point_weight_);
+    }
 
+    int num_threads = option.n_threads_;
+    if (num_threads <= 0) {
 #ifdef _OPENMP
-    ThreadPool::Init((ThreadPool::ParallelType)(int)ThreadPool::OPEN_MP,
-                     std::thread::hardware_concurrency());
+        num_threads = omp_get_max_threads();
 #else
-    ThreadPool::Init((ThreadPool::ParallelType)(int)ThreadPool::THREAD_POOL,
-                     std::thread::hardware_concurrency());
+        num_threads = std::max(1, (int)std::thread::hardware_concurrency());
 #endif
+    }
+    static poisson::PersistentThreadPool thread_pool;
+    auto lock = thread_pool.Acquire(num_threads);
 
     auto mesh = std::make_shared<TriangleMesh>();
     std::vector<double> densities;
-    poisson::Execute<float>(pcd, mesh, densities, static_cast<int>(depth),
-                            width, scale, linear_fit, FEMSigs());
-
-    ThreadPool::Terminate();
+    poisson::Execute<float>(pcd, mesh, densities, option, FEMSigs());
 
     return std::make_tuple(mesh, densities);
 }
@@ -32,6 +32,9 @@
 #include "Open3D/Geometry/Qhull.h"
 
 #include <Eigen/Dense>
+#include <Eigen/SparseCholesky>
+#include <algorithm>
+#include <cstring>
 #include <numeric>
 #include <queue>
 #include <random>
@@ -142,19 +145,68 @@ TriangleMesh &TriangleMesh::ComputeVertexNormals(bool normalized /* = true*/) {
 }
 
 TriangleMesh &TriangleMesh::ComputeAdjacencyList() {
-    adjacency_list_.clear();
-    adjacency_list_.resize(vertices_.size());
-    for (const auto &triangle : triangles_) {
-        adjacency_list_[triangle(0)].insert(triangle(1));
-        adjacency_list_[triangle(0)].insert(triangle(2));
-        adjacency_list_[triangle(1)].insert(triangle(0));
-        adjacency_list_[triangle(1)].insert(triangle(2));
-        adjacency_list_[triangle(2)].insert(triangle(0));
-        adjacency_list_[triangle(2)].insert(triangle(1));
-    }
+    adjacency_list_ = MeshAdjacency::CreateVertexAdjacency(
+                              triangles_, int(vertices_.size()))
+                              .ToAdjacencyList();
     return *this;
 }
 
+MeshAdjacency TriangleMesh::GetVertexAdjacency() const {
+    if (HasAdjacencyList()) {
+        return MeshAdjacency::CreateFromAdjacencyList(adjacency_list_);
+    }
+    return MeshAdjacency::CreateVertexAdjacency(triangles_,
+                                                int(vertices_.size()));
+}
+
+MeshAdjacency TriangleMesh::GetVertexTriangles() const {
+    return MeshAdjacency::CreateVertexTriangles(triangles_,
+                                                int(vertices_.size()));
+}
+
+std::vector<double> TriangleMesh::ComputeAdjacencyWeightsCot(
+        const MeshAdjacency &adjacency, double min_weight) const {
+    const MeshAdjacency vertex_triangles = GetVertexTriangles();
+    std::vector<double> weights(adjacency.indices_.size(), 0);
+    std::vector<int> num_angles(adjacency.indices_.size(), 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < adjacency.Size(); ++i) {
+        MeshAdjacency::Neighbors neighbors = adjacency[i];
+        auto AddAngle = [&](int j, int opposite) {
+            const int *nb =
+                    std::lower_bound(neighbors.begin(), neighbors.end(), j);
+            if (nb == neighbors.end() || *nb != j) {
+                return;
+            }
+            Eigen::Vector3d a = vertices_[i] - vertices_[opposite];
+            Eigen::Vector3d b = vertices_[j] - vertices_[opposite];
+            int k = int(nb - adjacency.indices_.data());
+            weights[k] += a.dot(b) / (a.cross(b)).norm();
+            num_angles[k]++;
+        };
+        for (int tidx : vertex_triangles[i]) {
+            const Eigen::Vector3i &triangle = triangles_[tidx];
+            if (triangle(0) == triangle(1) || triangle(1) == triangle(2) ||
+                triangle(2) == triangle(0)) {
+                continue;
+            }
+            int c = triangle(0) == i ? 0 : (triangle(1) == i ? 1 : 2);
+            int j0 = triangle((c + 1) % 3);
+            int j1 = triangle((c + 2) % 3);
+            AddAngle(j0, j1);
+            AddAngle(j1, j0);
+        }
+        for (int k = adjacency.offsets_[i]; k < adjacency.offsets_[i + 1];
+             ++k) {
+            double weight = num_angles[k] > 0 ? weights[k] / num_angles[k] : 0;
+            weights[k] = std::max(weight, min_weight);
+        }
+    }
+    return weights;
+}
+
 std::shared_ptr<TriangleMesh> TriangleMesh::FilterSharpen(
         int number_of_iterations, double strength, FilterScope scope) const {
     bool filter_vertex =
@@ -176,16 +228,17 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSharpen(
     mesh->vertex_colors_.resize(vertex_colors_.size());
     mesh->triangles_ = triangles_;
     mesh->adjacency_list_ = adjacency_list_;
-    if (!mesh->HasAdjacencyList()) {
-        mesh->ComputeAdjacencyList();
-    }
+    const MeshAdjacency adjacency = GetVertexAdjacency();
 
     for (int iter = 0; iter < number_of_iterations; ++iter) {
-        for (size_t vidx = 0; vidx < mesh->vertices_.size(); ++vidx) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int vidx = 0; vidx < int(mesh->vertices_.size()); ++vidx) {
             Eigen::Vector3d vertex_sum(0, 0, 0);
             Eigen::Vector3d normal_sum(0, 0, 0);
             Eigen::Vector3d color_sum(0, 0, 0);
-            for (int nbidx : mesh->adjacency_list_[vidx]) {
+            for (int nbidx : adjacency[vidx]) {
                 if (filter_vertex) {
                     vertex_sum += prev_vertices[nbidx];
                 }
@@ -197,7 +250,7 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSharpen(
                 }
             }
 
-            size_t nb_size = mesh->adjacency_list_[vidx].size();
+            size_t nb_size = adjacency[vidx].size();
             if (filter_vertex) {
                 mesh->vertices_[vidx] =
                         prev_vertices[vidx] +
@@ -247,16 +300,17 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothSimple(
     mesh->vertex_colors_.resize(vertex_colors_.size());
     mesh->triangles_ = triangles_;
     mesh->adjacency_list_ = adjacency_list_;
-    if (!mesh->HasAdjacencyList()) {
-        mesh->ComputeAdjacencyList();
-    }
+    const MeshAdjacency adjacency = GetVertexAdjacency();
 
     for (int iter = 0; iter < number_of_iterations; ++iter) {
-        for (size_t vidx = 0; vidx < mesh->vertices_.size(); ++vidx) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int vidx = 0; vidx < int(mesh->vertices_.size()); ++vidx) {
             Eigen::Vector3d vertex_sum(0, 0, 0);
             Eigen::Vector3d normal_sum(0, 0, 0);
             Eigen::Vector3d color_sum(0, 0, 0);
-            for (int nbidx : mesh->adjacency_list_[vidx]) {
+            for (int nbidx : adjacency[vidx]) {
                 if (filter_vertex) {
                     vertex_sum += prev_vertices[nbidx];
                 }
@@ -268,7 +322,7 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothSimple(
                 }
             }
 
-            size_t nb_size = mesh->adjacency_list_[vidx].size();
+            size_t nb_size = adjacency[vidx].size();
             if (filter_vertex) {
                 mesh->vertices_[vidx] =
                         (prev_vertices[vidx] + vertex_sum) / (1 + nb_size);
@@ -297,17 +351,20 @@ void TriangleMesh::FilterSmoothLaplacianHelper(
         const std::vector<Eigen::Vector3d> &prev_vertices,
         const std::vector<Eigen::Vector3d> &prev_vertex_normals,
         const std::vector<Eigen::Vector3d> &prev_vertex_colors,
-        const std::vector<std::unordered_set<int>> &adjacency_list,
+        const MeshAdjacency &adjacency,
         double lambda,
         bool filter_vertex,
         bool filter_normal,
         bool filter_color) const {
-    for (size_t vidx = 0; vidx < mesh->vertices_.size(); ++vidx) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int vidx = 0; vidx < int(mesh->vertices_.size()); ++vidx) {
         Eigen::Vector3d vertex_sum(0, 0, 0);
         Eigen::Vector3d normal_sum(0, 0, 0);
         Eigen::Vector3d color_sum(0, 0, 0);
         double total_weight = 0;
-        for (int nbidx : mesh->adjacency_list_[vidx]) {
+        for (int nbidx : adjacency[vidx]) {
             auto diff = prev_vertices[vidx] - prev_vertices[nbidx];
             double dist = diff.norm();
             double weight = 1. / (dist + 1e-12);
@@ -363,13 +420,11 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothLaplacian(
     mesh->vertex_colors_.resize(vertex_colors_.size());
     mesh->triangles_ = triangles_;
     mesh->adjacency_list_ = adjacency_list_;
-    if (!mesh->HasAdjacencyList()) {
-        mesh->ComputeAdjacencyList();
-    }
+    const MeshAdjacency adjacency = GetVertexAdjacency();
 
     for (int iter = 0; iter < number_of_iterations; ++iter) {
         FilterSmoothLaplacianHelper(mesh, prev_vertices, prev_vertex_normals,
-                                    prev_vertex_colors, mesh->adjacency_list_,
+                                    prev_vertex_colors, adjacency,
                                     lambda, filter_vertex, filter_normal,
                                     filter_color);
         if (iter < number_of_iterations - 1) {
@@ -405,19 +460,17 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothTaubin(
     mesh->vertex_colors_.resize(vertex_colors_.size());
     mesh->triangles_ = triangles_;
     mesh->adjacency_list_ = adjacency_list_;
-    if (!mesh->HasAdjacencyList()) {
-        mesh->ComputeAdjacencyList();
-    }
+    const MeshAdjacency adjacency = GetVertexAdjacency();
     for (int iter = 0; iter < number_of_iterations; ++iter) {
         FilterSmoothLaplacianHelper(mesh, prev_vertices, prev_vertex_normals,
-                                    prev_vertex_colors, mesh->adjacency_list_,
+                                    prev_vertex_colors, adjacency,
                                     lambda, filter_vertex, filter_normal,
                                     filter_color);
         std::swap(mesh->vertices_, prev_vertices);
         std::swap(mesh->vertex_normals_, prev_vertex_normals);
         std::swap(mesh->vertex_colors_, prev_vertex_colors);
         FilterSmoothLaplacianHelper(mesh, prev_vertices, prev_vertex_normals,
-                                    prev_vertex_colors, mesh->adjacency_list_,
+                                    prev_vertex_colors, adjacency,
                                     mu, filter_vertex, filter_normal,
                                     filter_color);
         if (iter < number_of_iterations - 1) {
@@ -429,6 +482,112 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothTaubin(
     return mesh;
 }
 
+std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothImplicit(
+        int number_of_iterations,
+        double lambda,
+        bool use_cotangent_weights,
+        FilterScope scope) const {
+    if (lambda < 0) {
+        utility::LogError("[FilterSmoothImplicit] lambda must be non-negative");
+    }
+    bool filter_vertex =
+            scope == FilterScope::All || scope == FilterScope::Vertex;
+    bool filter_normal =
+            (scope == FilterScope::All || scope == FilterScope::Normal) &&
+            HasVertexNormals();
+    bool filter_color =
+            (scope == FilterScope::All || scope == FilterScope::Color) &&
+            HasVertexColors();
+
+    std::shared_ptr<TriangleMesh> mesh = std::make_shared<TriangleMesh>();
+    mesh->vertices_ = vertices_;
+    mesh->vertex_normals_ = vertex_normals_;
+    mesh->vertex_colors_ = vertex_colors_;
+    mesh->triangles_ = triangles_;
+    mesh->adjacency_list_ = adjacency_list_;
+    std::vector<std::vector<Eigen::Vector3d> *> attributes;
+    if (filter_vertex) {
+        attributes.push_back(&mesh->vertices_);
+    }
+    if (filter_normal) {
+        attributes.push_back(&mesh->vertex_normals_);
+    }
+    if (filter_color) {
+        attributes.push_back(&mesh->vertex_colors_);
+    }
+    if (number_of_iterations <= 0 || attributes.empty()) {
+        return mesh;
+    }
+
+    const int num_vertices = int(vertices_.size());
+    const MeshAdjacency adjacency = GetVertexAdjacency();
+    const std::vector<double> weights =
+            use_cotangent_weights
+                    ? ComputeAdjacencyWeightsCot(adjacency)
+                    : std::vector<double>(adjacency.indices_.size(), 1.0);
+    // The factorization needs a symmetric matrix, but adjacency_list_ may
+    // list an edge at one end only. The weights are averaged with their
+    // transpose, which leaves symmetric weights unchanged. Vertices without
+    // weighted neighbours keep their values.
+    std::vector<double> weight_sums(num_vertices, 0);
+    std::vector<Eigen::Triplet<double>> triplets;
+    for (int i = 0; i < num_vertices; ++i) {
+        for (int k = adjacency.offsets_[i]; k < adjacency.offsets_[i + 1];
+             ++k) {
+            int j = adjacency.indices_[k];
+            if (j != i && weights[k] != 0) {
+                double weight = 0.5 * weights[k];
+                triplets.push_back(
+                        Eigen::Triplet<double>(i, j, -lambda * weight));
+                triplets.push_back(
+                        Eigen::Triplet<double>(j, i, -lambda * weight));
+                weight_sums[i] += weight;
+                weight_sums[j] += weight;
+            }
+        }
+    }
+    for (int i = 0; i < num_vertices; ++i) {
+        if (weight_sums[i] <= 0) {
+            weight_sums[i] = 1;
+        }
+        triplets.push_back(
+                Eigen::Triplet<double>(i, i, (1 + lambda) * weight_sums[i]));
+    }
+    Eigen::SparseMatrix<double> A(num_vertices, num_vertices);
+    A.setFromTriplets(triplets.begin(), triplets.end());
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> solver(A);
+    if (solver.info() != Eigen::Success) {
+        utility::LogError(
+                "[FilterSmoothImplicit] Failed to factorize the system "
+                "matrix");
+    }
+
+    // All attributes are solved at once, three columns per attribute.
+    const int num_columns = 3 * int(attributes.size());
+    Eigen::MatrixXd b(num_vertices, num_columns);
+    for (int iter = 0; iter < number_of_iterations; ++iter) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int i = 0; i < num_vertices; ++i) {
+            for (size_t a = 0; a < attributes.size(); ++a) {
+                b.block<1, 3>(i, 3 * a) =
+                        weight_sums[i] * (*attributes[a])[i].transpose();
+            }
+        }
+        Eigen::MatrixXd x = solver.solve(b);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int i = 0; i < num_vertices; ++i) {
+            for (size_t a = 0; a < attributes.size(); ++a) {
+                (*attributes[a])[i] = x.block<1, 3>(i, 3 * a).transpose();
+            }
+        }
+    }
+    return mesh;
+}
+
 std::shared_ptr<PointCloud> TriangleMesh::SamplePointsUniformlyImpl(
         size_t number_of_points,
         std::vector<double> &triangle_areas,
@@ -579,38 +738,40 @@ std::shared_ptr<PointCloud> TriangleMesh::SamplePointsPoissonDisk(
         return std::pow(1 - d / r_max, alpha);
     };
 
-    auto ComputePointWeight = [&](int pidx0) {
+    // init weights, the neighborhoods are searched in parallel
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int pidx0 = 0; pidx0 < int(pcl->points_.size()); ++pidx0) {
         std::vector<int> nbs;
         std::vector<double> dists2;
         kdtree.SearchRadius(pcl->points_[pidx0], r_max, nbs, dists2);
         double weight = 0;
         for (size_t nbidx = 0; nbidx < nbs.size(); ++nbidx) {
-            int pidx1 = nbs[nbidx];
-            // only count weights if not the same point if not deleted
-            if (pidx0 == pidx1 || deleted[pidx1]) {
-                continue;
+            if (nbs[nbidx] != pidx0) {
+                weight += WeightFcn(dists2[nbidx]);
             }
-            weight += WeightFcn(dists2[nbidx]);
         }
-
         weights[pidx0] = weight;
-    };
+    }
 
-    // init weights and priority queue
+    // init priority queue
     typedef std::tuple<int, double> QueueEntry;
     auto WeightCmp = [](const QueueEntry &a, const QueueEntry &b) {
         return std::get<1>(a) < std::get<1>(b);
     };
+    std::vector<QueueEntry> entries(pcl->points_.size());
+    for (size_t pidx0 = 0; pidx0 < pcl->points_.size(); ++pidx0) {
+        entries[pidx0] = QueueEntry(int(pidx0), weights[pidx0]);
+    }
     std::priority_queue<QueueEntry, std::vector<QueueEntry>,
                         decltype(WeightCmp)>
-            queue(WeightCmp);
-    for (size_t pidx0 = 0; pidx0 < pcl->points_.size(); ++pidx0) {
-        ComputePointWeight(int(pidx0));
-        queue.push(QueueEntry(int(pidx0), weights[pidx0]));
-    };
+            queue(WeightCmp, std::move(entries));
 
     // sample elimination
     size_t current_number_of_points = pcl->points_.size();
+    std::vector<int> nbs;
+    std::vector<double> dists2;
     while (current_number_of_points > number_of_points) {
         int pidx;
         double weight;
@@ -626,12 +787,16 @@ std::shared_ptr<PointCloud> TriangleMesh::SamplePointsPoissonDisk(
         deleted[pidx] = true;
         current_number_of_points--;
 
-        // update weights
-        std::vector<int> nbs;
-        std::vector<double> dists2;
+        // update weights, the weight function is symmetric, so the
+        // contribution of the deleted sample is subtracted from its neighbors
+        // instead of searching their neighborhoods again
         kdtree.SearchRadius(pcl->points_[pidx], r_max, nbs, dists2);
-        for (int nb : nbs) {
-            ComputePointWeight(nb);
+        for (size_t nbidx = 0; nbidx < nbs.size(); ++nbidx) {
+            int nb = nbs[nbidx];
+            if (nb == pidx || deleted[nb]) {
+                continue;
+            }
+            weights[nb] -= WeightFcn(dists2[nbidx]);
             queue.push(QueueEntry(nb, weights[nb]));
         }
     }
@@ -663,38 +828,98 @@ std::shared_ptr<PointCloud> TriangleMesh::SamplePointsPoissonDisk(
     return pcl;
 }
 
+namespace {
+
+/// Numbers the elements that are their own first occurrence in order, maps
+/// every other element to the new index of its first occurrence and returns
+/// the old indices of the kept elements.
+std::vector<int> NumberFirstOccurrences(
+        const std::vector<int> &first_occurrence,
+        std::vector<int> &index_old_to_new) {
+    std::vector<int> kept;
+    index_old_to_new.resize(first_occurrence.size());
+    for (size_t i = 0; i < first_occurrence.size(); i++) {
+        if (first_occurrence[i] == int(i)) {
+            index_old_to_new[i] = int(kept.size());
+            kept.push_back(int(i));
+        } else {
+            index_old_to_new[i] = index_old_to_new[first_occurrence[i]];
+        }
+    }
+    return kept;
+}
+
+template <typename T>
+void SelectInParallel(std::vector<T> &values, const std::vector<int> &kept) {
+    std::vector<T> selected(kept.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < int(kept.size()); i++) {
+        selected[i] = values[kept[i]];
+    }
+    values.swap(selected);
+}
+
+}  // unnamed namespace
+
 TriangleMesh &TriangleMesh::RemoveDuplicatedVertices() {
-    typedef std::tuple<double, double, double> Coordinate3;
-    std::unordered_map<Coordinate3, size_t,
-                       utility::hash_tuple::hash<Coordinate3>>
-            point_to_old_index;
-    std::vector<int> index_old_to_new(vertices_.size());
-    bool has_vert_normal = HasVertexNormals();
-    bool has_vert_color = HasVertexColors();
+    RemoveDuplicatedVerticesAndTrace();
+    return *this;
+}
+
+std::vector<int> TriangleMesh::RemoveDuplicatedVerticesAndTrace(
+        double tolerance) {
+    if (tolerance < 0.0) {
+        utility::LogError(
+                "[RemoveDuplicatedVerticesAndTrace] tolerance must be "
+                "non-negative.");
+    }
+    // Vertices are keyed by the bits of their coordinates, or by their grid
+    // cell if a tolerance is given. Vertices without a key are never merged.
+    typedef Eigen::Matrix<int64_t, 3, 1> Key;
     size_t old_vertex_num = vertices_.size();
-    size_t k = 0;                                  // new index
-    for (size_t i = 0; i < old_vertex_num; i++) {  // old index
-        Coordinate3 coord = std::make_tuple(vertices_[i](0), vertices_[i](1),
-                                            vertices_[i](2));
-        if (point_to_old_index.find(coord) == point_to_old_index.end()) {
-            point_to_old_index[coord] = i;
-            vertices_[k] = vertices_[i];
-            if (has_vert_normal) vertex_normals_[k] = vertex_normals_[i];
-            if (has_vert_color) vertex_colors_[k] = vertex_colors_[i];
-            index_old_to_new[i] = (int)k;
-            k++;
-        } else {
-            index_old_to_new[i] = index_old_to_new[point_to_old_index[coord]];
+    std::vector<Key> keys(old_vertex_num);
+    std::vector<uint8_t> valid(old_vertex_num);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < int(old_vertex_num); i++) {
+        bool is_valid = true;
+        for (int d = 0; d < 3; d++) {
+            double c = vertices_[i](d);
+            if (tolerance > 0.0) {
+                c = std::floor(c / tolerance);
+                is_valid = is_valid && std::abs(c) < 9.2e18;
+                keys[i](d) = is_valid ? int64_t(c) : 0;
+            } else {
+                is_valid = is_valid && !std::isnan(c);
+                // -0.0 and 0.0 are the same coordinate.
+                c = c == 0.0 ? 0.0 : c;
+                std::memcpy(&keys[i](d), &c, sizeof(double));
+            }
         }
+        valid[i] = is_valid ? 1 : 0;
     }
-    vertices_.resize(k);
-    if (has_vert_normal) vertex_normals_.resize(k);
-    if (has_vert_color) vertex_colors_.resize(k);
-    if (k < old_vertex_num) {
-        for (auto &triangle : triangles_) {
-            triangle(0) = index_old_to_new[triangle(0)];
-            triangle(1) = index_old_to_new[triangle(1)];
-            triangle(2) = index_old_to_new[triangle(2)];
+
+    std::vector<int> index_old_to_new;
+    std::vector<int> kept = NumberFirstOccurrences(
+            utility::FindFirstOccurrences(keys, valid), index_old_to_new);
+    if (kept.size() < old_vertex_num) {
+        SelectInParallel(vertices_, kept);
+        if (vertex_normals_.size() == old_vertex_num) {
+            SelectInParallel(vertex_normals_, kept);
+        }
+        if (vertex_colors_.size() == old_vertex_num) {
+            SelectInParallel(vertex_colors_, kept);
+        }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int i = 0; i < int(triangles_.size()); i++) {
+            for (int j = 0; j < 3; j++) {
+                triangles_[i](j) = index_old_to_new[triangles_[i](j)];
+            }
         }
         if (HasAdjacencyList()) {
             ComputeAdjacencyList();
@@ -702,61 +927,56 @@ TriangleMesh &TriangleMesh::RemoveDuplicatedVertices() {
     }
     utility::LogDebug(
             "[RemoveDuplicatedVertices] {:d} vertices have been removed.",
-            (int)(old_vertex_num - k));
+            (int)(old_vertex_num - kept.size()));
 
-    return *this;
+    return index_old_to_new;
 }
 
 TriangleMesh &TriangleMesh::RemoveDuplicatedTriangles() {
+    RemoveDuplicatedTrianglesAndTrace();
+    return *this;
+}
+
+std::vector<int> TriangleMesh::RemoveDuplicatedTrianglesAndTrace() {
     if (HasTriangleUvs()) {
         utility::LogWarning(
                 "[RemoveDuplicatedTriangles] This mesh contains triangle uvs "
                 "that are not handled in this function");
     }
-    typedef std::tuple<int, int, int> Index3;
-    std::unordered_map<Index3, size_t, utility::hash_tuple::hash<Index3>>
-            triangle_to_old_index;
-    bool has_tri_normal = HasTriangleNormals();
     size_t old_triangle_num = triangles_.size();
-    size_t k = 0;
-    for (size_t i = 0; i < old_triangle_num; i++) {
-        Index3 index;
+    std::vector<Eigen::Vector3i> keys(old_triangle_num);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < int(old_triangle_num); i++) {
         // We first need to find the minimum index. Because triangle (0-1-2)
         // and triangle (2-0-1) are the same.
-        if (triangles_[i](0) <= triangles_[i](1)) {
-            if (triangles_[i](0) <= triangles_[i](2)) {
-                index = std::make_tuple(triangles_[i](0), triangles_[i](1),
-                                        triangles_[i](2));
-            } else {
-                index = std::make_tuple(triangles_[i](2), triangles_[i](0),
-                                        triangles_[i](1));
-            }
-        } else {
-            if (triangles_[i](1) <= triangles_[i](2)) {
-                index = std::make_tuple(triangles_[i](1), triangles_[i](2),
-                                        triangles_[i](0));
-            } else {
-                index = std::make_tuple(triangles_[i](2), triangles_[i](0),
-                                        triangles_[i](1));
-            }
+        const Eigen::Vector3i &t = triangles_[i];
+        int r = 0;
+        if (t(1) < t(r)) r = 1;
+        if (t(2) < t(r)) r = 2;
+        keys[i] = Eigen::Vector3i(t(r), t((r + 1) % 3), t((r + 2) % 3));
+    }
+
+    std::vector<int> index_old_to_new;
+    std::vector<int> kept = NumberFirstOccurrences(
+            utility::FindFirstOccurrences(keys,
+                                 std::vector<uint8_t>(old_triangle_num, 1)),
+            index_old_to_new);
+    if (kept.size() < old_triangle_num) {
+        SelectInParallel(triangles_, kept);
+        if (triangle_normals_.size() == old_triangle_num) {
+            SelectInParallel(triangle_normals_, kept);
         }
-        if (triangle_to_old_index.find(index) == triangle_to_old_index.end()) {
-            triangle_to_old_index[index] = i;
-            triangles_[k] = triangles_[i];
-            if (has_tri_normal) triangle_normals_[k] = triangle_normals_[i];
-            k++;
+        if (HasAdjacencyList()) {
+            ComputeAdjacencyList();
         }
     }
-    triangles_.resize(k);
-    if (has_tri_normal) triangle_normals_.resize(k);
-    if (k < old_triangle_num && HasAdjacencyList()) {
-        ComputeAdjacencyList();
-    }
     utility::LogDebug(
             "[RemoveDuplicatedTriangles] {:d} triangles have been removed.",
-            (int)(old_triangle_num - k));
+            (int)(old_triangle_num - kept.size()));
 
-    return *this;
+    return index_old_to_new;
 }
 
 TriangleMesh &TriangleMesh::RemoveUnreferencedVertices() {
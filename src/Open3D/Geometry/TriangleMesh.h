@@ -35,6 +35,7 @@
 #include <vector>
 
 #include "Open3D/Geometry/Image.h"
+#include "Open3D/Geometry/MeshAdjacency.h"
 #include "Open3D/Geometry/MeshBase.h"
 #include "Open3D/Utility/Helper.h"
 
@@ -44,6 +45,47 @@ namespace geometry {
 class PointCloud;
 class TetraMesh;
 
+/// \class PoissonReconstructionOption
+///
+/// Class that defines the options of the Screened Poisson surface
+/// reconstruction, see TriangleMesh::CreateFromPointCloudPoisson.
+class PoissonReconstructionOption {
+public:
+    PoissonReconstructionOption() {}
+    ~PoissonReconstructionOption() {}
+
+public:
+    /// Maximum depth of the tree that will be used for surface reconstruction.
+    /// Running at depth d corresponds to solving on a grid whose resolution is
+    /// no larger than 2^d x 2^d x 2^d.
+    int depth_ = 8;
+    /// Target width of the finest level octree cells. Ignored if 0.
+    double width_ = 0.0;
+    /// Ratio between the diameter of the cube used for reconstruction and the
+    /// diameter of the samples' bounding cube.
+    double scale_ = 1.1;
+    /// If true, the positions of iso-vertices are linearly interpolated.
+    bool linear_fit_ = false;
+    /// Depth up to which the octree is complete. Coarser levels are adapted
+    /// to the sampling density only below this depth.
+    int full_depth_ = 5;
+    /// Depth up to which the system is solved with a conjugate-gradient
+    /// solver instead of the multigrid relaxation.
+    int cg_depth_ = 0;
+    /// Number of Gauss-Seidel relaxations per level of the multigrid solver.
+    int iterations_ = 8;
+    /// Importance of point interpolation relative to the gradient fit. A
+    /// value of 0 gives the unscreened Poisson reconstruction.
+    double point_weight_ = 2.0;
+    /// Number of threads used by the reconstruction. Values <= 0 use the
+    /// OpenMP thread limit. The thread pool persists between calls and is
+    /// only restarted when this value changes. PoissonRecon has a single
+    /// global thread pool, so concurrent reconstructions run one at a time.
+    int n_threads_ = -1;
+    /// If false, the per vertex densities are neither computed nor returned.
+    bool compute_densities_ = true;
+};
+
 /// \class TriangleMesh
 ///
 /// \brief Triangle mesh contains vertices and triangles represented by the
@@ -144,6 +186,24 @@ public:
     /// order.
     TriangleMesh &RemoveDuplicatedTriangles();
 
+    /// \brief Function that removes duplicated vertices and returns for every
+    /// old vertex the index of the vertex it has been merged into.
+    ///
+    /// The returned map can be used to remap per-vertex attributes that are
+    /// not stored in the mesh. The first vertex of every group of duplicates
+    /// is kept, and the kept vertices retain their relative order.
+    ///
+    /// \param tolerance If positive, the vertices are snapped to a grid with
+    /// this cell size and all vertices falling into the same cell are welded
+    /// into the first of them. If zero, only vertices with identical
+    /// coordinates are merged. Use MergeCloseVertices to merge vertices by
+    /// their distance instead.
+    std::vector<int> RemoveDuplicatedVerticesAndTrace(double tolerance = 0.0);
+
+    /// \brief Function that removes duplicated triangles and returns for every
+    /// old triangle the index of the kept triangle that is equal to it.
+    std::vector<int> RemoveDuplicatedTrianglesAndTrace();
+
     /// \brief This function removes vertices from the triangle mesh that are
     /// not referenced in any triangle of the mesh.
     TriangleMesh &RemoveUnreferencedVertices();
@@ -225,6 +285,29 @@ public:
             double mu = -0.53,
             FilterScope scope = FilterScope::All) const;
 
+    /// \brief Function to smooth triangle mesh with implicit (backward Euler)
+    /// steps of the Laplacian flow, see Desbrun et al., "Implicit Fairing of
+    /// Irregular Meshes using Diffusion and Curvature Flow", 1999.
+    ///
+    /// Each iteration solves $(D + \lambda (D - W)) v_o = D v_i$ with a sparse
+    /// Cholesky factorization that is computed once, where $W$ holds the
+    /// weights of the adjacent neighbours and $D$ their sums. Unlike the
+    /// explicit filters, a single iteration with a large lambda is stable and
+    /// smooths as strongly as many explicit iterations. An adjacency_list_
+    /// that lists some edges at one end only is symmetrized by averaging the
+    /// weights of both directions.
+    ///
+    /// \param number_of_iterations defines the number of repetitions
+    /// of this operation.
+    /// \param lambda is the time step of the flow.
+    /// \param use_cotangent_weights weights the neighbours with the
+    /// cotangent weights of the input mesh instead of uniformly.
+    std::shared_ptr<TriangleMesh> FilterSmoothImplicit(
+            int number_of_iterations,
+            double lambda,
+            bool use_cotangent_weights = false,
+            FilterScope scope = FilterScope::All) const;
+
     /// Function that computes the Euler-Poincaré characteristic, i.e.,
     /// V + F - E, where V is the number of vertices, F is the number
     /// of triangles, and E is the number of edges.
@@ -297,6 +380,24 @@ public:
                        utility::hash_eigen::hash<Eigen::Vector2i>>
     GetEdgeToVerticesMap() const;
 
+    /// Function that returns the adjacent vertices of every vertex in
+    /// compressed sparse row layout. It is converted from adjacency_list_ if
+    /// the mesh has one and computed from the triangles otherwise.
+    MeshAdjacency GetVertexAdjacency() const;
+
+    /// Function that returns the triangles incident to every vertex in
+    /// compressed sparse row layout.
+    MeshAdjacency GetVertexTriangles() const;
+
+    /// \brief Function that computes the cotangent weight of every edge in
+    /// \p adjacency, in the layout of adjacency.indices_.
+    ///
+    /// The weight is the mean of the cotangents of the angles opposite to the
+    /// edge. Weights smaller than \p min_weight, including the weights of
+    /// neighbors that share no triangle, get clamped.
+    std::vector<double> ComputeAdjacencyWeightsCot(
+            const MeshAdjacency &adjacency, double min_weight = 0) const;
+
     /// Function that computes the area of a mesh triangle
     static double ComputeTriangleArea(const Eigen::Vector3d &p0,
                                       const Eigen::Vector3d &p1,
@@ -410,7 +511,8 @@ public:
                     SimplificationContraction::Average) const;
 
     /// Function to simplify mesh using Quadric Error Metric Decimation by
-    /// Garland and Heckbert.
+    /// Garland and Heckbert. The cheapest edges whose neighborhoods do not
+    /// overlap are collapsed together in parallel.
     /// \param target_number_of_triangles defines the number of triangles that
     /// the simplified mesh should have. It is not guranteed that this number
     /// will be reached.
@@ -481,6 +583,9 @@ public:
     /// \brief This function deforms the mesh using the method by
     /// Sorkine and Alexa, "As-Rigid-As-Possible Surface Modeling", 2007.
     ///
+    /// Use AsRigidAsPossibleDeformer to deform the same mesh repeatedly
+    /// without setting up the system again.
+    ///
     /// \param constraint_vertex_indices Indices of the triangle vertices that
     /// should be constrained by the vertex positions in
     /// constraint_vertex_positions.
@@ -559,6 +664,21 @@ public:
                                 float scale = 1.1f,
                                 bool linear_fit = false);
 
+    /// \brief Function that computes a triangle mesh from a oriented PointCloud
+    /// pcd with the Screened Poisson Reconstruction, see above.
+    ///
+    /// \param pcd PointCloud with normals and optionally colors.
+    /// Reconstructions share the global thread pool of PoissonRecon, calls
+    /// from several threads are serialized.
+    ///
+    /// \param option Tree depth, solver controls, thread count and whether
+    /// densities are returned.
+    /// \return The estimated TriangleMesh, and per vertex densities if
+    /// option.compute_densities_ is set, otherwise an empty vector.
+    static std::tuple<std::shared_ptr<TriangleMesh>, std::vector<double>>
+    CreateFromPointCloudPoisson(const PointCloud &pcd,
+                                const PoissonReconstructionOption &option);
+
     /// Factory function to create a tetrahedron mesh (trianglemeshfactory.cpp).
     /// the mesh centroid will be at (0,0,0) and \param radius defines the
     /// distance from the center to the mesh vertices.
@@ -706,7 +826,7 @@ protected:
             const std::vector<Eigen::Vector3d> &prev_vertices,
             const std::vector<Eigen::Vector3d> &prev_vertex_normals,
             const std::vector<Eigen::Vector3d> &prev_vertex_colors,
-            const std::vector<std::unordered_set<int>> &adjacency_list,
+            const MeshAdjacency &adjacency,
             double lambda,
             bool filter_vertex,
             bool filter_normal,
@@ -27,10 +27,14 @@
 #include "Open3D/Geometry/TriangleMesh.h"
 
 #include <Eigen/Dense>
-#include <queue>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <limits>
 #include <tuple>
 
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Helper.h"
 
 namespace open3d {
 namespace geometry {
@@ -89,6 +93,76 @@ public:
     double c_;
 };
 
+namespace {
+
+/// Computes the triangles incident to every vertex like
+/// MeshAdjacency::CreateVertexTriangles, but skips deleted triangles and
+/// reuses the memory of vertex_triangles.
+void ComputeVertexTriangles(const std::vector<Eigen::Vector3i>& triangles,
+                            const std::vector<uint8_t>& triangles_deleted,
+                            int num_vertices,
+                            MeshAdjacency& vertex_triangles) {
+    const int num_triangles = (int)triangles.size();
+    std::vector<std::atomic<int>> cursors(num_vertices);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int tidx = 0; tidx < num_triangles; tidx++) {
+        if (!triangles_deleted[tidx]) {
+            for (int i = 0; i < 3; i++) {
+                cursors[triangles[tidx](i)].fetch_add(
+                        1, std::memory_order_relaxed);
+            }
+        }
+    }
+    std::vector<int>& offsets = vertex_triangles.offsets_;
+    offsets.resize(num_vertices + 1);
+    offsets[0] = 0;
+    for (int vidx = 0; vidx < num_vertices; vidx++) {
+        offsets[vidx + 1] = offsets[vidx] + cursors[vidx].load();
+        cursors[vidx].store(offsets[vidx]);
+    }
+    vertex_triangles.indices_.resize(offsets[num_vertices]);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int tidx = 0; tidx < num_triangles; tidx++) {
+        if (!triangles_deleted[tidx]) {
+            for (int i = 0; i < 3; i++) {
+                vertex_triangles.indices_[cursors[triangles[tidx](i)]
+                                                    .fetch_add(1)] = tidx;
+            }
+        }
+    }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int vidx = 0; vidx < num_vertices; vidx++) {
+        std::sort(vertex_triangles.indices_.begin() + offsets[vidx],
+                  vertex_triangles.indices_.begin() + offsets[vidx + 1]);
+    }
+}
+
+/// Orders collapses by cost, then by vertex index. Costs are non-negative,
+/// so their float bit patterns increase with the cost.
+uint64_t GetCollapseKey(double cost, int vidx) {
+    const float cost_float = (float)std::max(cost, 0.0);
+    uint32_t cost_bits;
+    memcpy(&cost_bits, &cost_float, sizeof(cost_bits));
+    return ((uint64_t)cost_bits << 32) | (uint32_t)vidx;
+}
+
+const uint64_t kNoCollapse = std::numeric_limits<uint64_t>::max();
+
+/// Orders indexed vectors lexicographically, then by index.
+bool LexicographicLess(const std::pair<Eigen::Vector3i, int>& a,
+                       const std::pair<Eigen::Vector3i, int>& b) {
+    return std::tie(a.first(0), a.first(1), a.first(2), a.second) <
+           std::tie(b.first(0), b.first(1), b.first(2), b.second);
+}
+
+}  // unnamed namespace
+
 std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyVertexClustering(
         double voxel_size,
         SimplificationContraction
@@ -119,117 +193,134 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyVertexClustering(
         return idx;
     };
 
-    std::unordered_map<Eigen::Vector3i, std::unordered_set<int>,
-                       utility::hash_eigen::hash<Eigen::Vector3i>>
-            voxel_vertices;
-    std::unordered_map<Eigen::Vector3i, int,
-                       utility::hash_eigen::hash<Eigen::Vector3i>>
-            voxel_vert_ind;
+    // Sort the vertices by voxel, the vertices of a voxel are then adjacent
+    // in voxel_vertices.
+    const int num_vertices = int(vertices_.size());
+    const int num_triangles = int(triangles_.size());
+    std::vector<std::pair<Eigen::Vector3i, int>> voxel_vertices(num_vertices);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int vidx = 0; vidx < num_vertices; vidx++) {
+        voxel_vertices[vidx] =
+                std::make_pair(GetVoxelIdx(vertices_[vidx]), vidx);
+    }
+    utility::ParallelSort(voxel_vertices.begin(), voxel_vertices.end(),
+                          LexicographicLess);
+    std::vector<int> voxel_offsets;
+    for (int i = 0; i < num_vertices; i++) {
+        if (i == 0 || voxel_vertices[i].first != voxel_vertices[i - 1].first) {
+            voxel_offsets.push_back(i);
+        }
+    }
+    const int num_voxels = int(voxel_offsets.size());
+    voxel_offsets.push_back(num_vertices);
+
+    // Number the voxels in the order of their first vertex, which comes
+    // first in its voxel.
+    std::vector<int> vert_remapping(num_vertices, -1);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int voxel = 0; voxel < num_voxels; voxel++) {
+        vert_remapping[voxel_vertices[voxel_offsets[voxel]].second] = 0;
+    }
     int new_vidx = 0;
-    for (size_t vidx = 0; vidx < vertices_.size(); ++vidx) {
-        const Eigen::Vector3i vox_idx = GetVoxelIdx(vertices_[vidx]);
-        voxel_vertices[vox_idx].insert(int(vidx));
-
-        if (voxel_vert_ind.count(vox_idx) == 0) {
-            voxel_vert_ind[vox_idx] = new_vidx;
-            new_vidx++;
+    for (int vidx = 0; vidx < num_vertices; vidx++) {
+        if (vert_remapping[vidx] == 0) {
+            vert_remapping[vidx] = new_vidx++;
+        }
+    }
+    std::vector<int> voxel_vert_ind(num_voxels);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int voxel = 0; voxel < num_voxels; voxel++) {
+        voxel_vert_ind[voxel] =
+                vert_remapping[voxel_vertices[voxel_offsets[voxel]].second];
+        for (int i = voxel_offsets[voxel] + 1; i < voxel_offsets[voxel + 1];
+             i++) {
+            vert_remapping[voxel_vertices[i].second] = voxel_vert_ind[voxel];
         }
     }
 
     // aggregate vertex info
     bool has_vert_normal = HasVertexNormals();
     bool has_vert_color = HasVertexColors();
-    mesh->vertices_.resize(voxel_vertices.size());
+    mesh->vertices_.resize(num_voxels);
     if (has_vert_normal) {
-        mesh->vertex_normals_.resize(voxel_vertices.size());
+        mesh->vertex_normals_.resize(num_voxels);
     }
     if (has_vert_color) {
-        mesh->vertex_colors_.resize(voxel_vertices.size());
+        mesh->vertex_colors_.resize(num_voxels);
     }
 
-    auto AvgVertex = [&](const std::unordered_set<int> ind) {
+    auto Avg = [&](const std::vector<Eigen::Vector3d>& values, int voxel) {
         Eigen::Vector3d aggr(0, 0, 0);
-        for (int vidx : ind) {
-            aggr += vertices_[vidx];
+        for (int i = voxel_offsets[voxel]; i < voxel_offsets[voxel + 1]; i++) {
+            aggr += values[voxel_vertices[i].second];
         }
-        aggr /= double(ind.size());
-        return aggr;
-    };
-    auto AvgNormal = [&](const std::unordered_set<int> ind) {
-        Eigen::Vector3d aggr(0, 0, 0);
-        for (int vidx : ind) {
-            aggr += vertex_normals_[vidx];
-        }
-        aggr /= double(ind.size());
-        return aggr;
-    };
-    auto AvgColor = [&](const std::unordered_set<int> ind) {
-        Eigen::Vector3d aggr(0, 0, 0);
-        for (int vidx : ind) {
-            aggr += vertex_colors_[vidx];
-        }
-        aggr /= double(ind.size());
+        aggr /= double(voxel_offsets[voxel + 1] - voxel_offsets[voxel]);
         return aggr;
     };
 
-    if (contraction == SimplificationContraction::Average) {
-        for (const auto& voxel : voxel_vertices) {
-            int vox_vidx = voxel_vert_ind[voxel.first];
-            mesh->vertices_[vox_vidx] = AvgVertex(voxel.second);
-            if (has_vert_normal) {
-                mesh->vertex_normals_[vox_vidx] = AvgNormal(voxel.second);
-            }
-            if (has_vert_color) {
-                mesh->vertex_colors_[vox_vidx] = AvgColor(voxel.second);
-            }
-        }
-    } else if (contraction == SimplificationContraction::Quadric) {
-        // Map triangles
-        std::unordered_map<int, std::unordered_set<int>> vert_to_triangles;
-        for (size_t tidx = 0; tidx < triangles_.size(); ++tidx) {
-            vert_to_triangles[triangles_[tidx](0)].emplace(int(tidx));
-            vert_to_triangles[triangles_[tidx](1)].emplace(int(tidx));
-            vert_to_triangles[triangles_[tidx](2)].emplace(int(tidx));
+    // Map triangles
+    MeshAdjacency vertex_triangles;
+    std::vector<Eigen::Vector4d> triangle_planes;
+    std::vector<double> triangle_areas;
+    if (contraction == SimplificationContraction::Quadric) {
+        vertex_triangles = GetVertexTriangles();
+        triangle_planes.resize(num_triangles);
+        triangle_areas.resize(num_triangles);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int tidx = 0; tidx < num_triangles; tidx++) {
+            triangle_planes[tidx] = GetTrianglePlane(tidx);
+            triangle_areas[tidx] = GetTriangleArea(tidx);
         }
+    }
 
-        for (const auto& voxel : voxel_vertices) {
-            int vox_vidx = voxel_vert_ind[voxel.first];
-
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int voxel = 0; voxel < num_voxels; voxel++) {
+        int vox_vidx = voxel_vert_ind[voxel];
+        mesh->vertices_[vox_vidx] = Avg(vertices_, voxel);
+        if (contraction == SimplificationContraction::Quadric) {
             Quadric q;
-            for (int vidx : voxel.second) {
-                for (int tidx : vert_to_triangles[vidx]) {
-                    Eigen::Vector4d p = GetTrianglePlane(tidx);
-                    double area = GetTriangleArea(tidx);
-                    q += Quadric(p, area);
+            for (int i = voxel_offsets[voxel]; i < voxel_offsets[voxel + 1];
+                 i++) {
+                int vidx = voxel_vertices[i].second;
+                for (int tidx : vertex_triangles[vidx]) {
+                    q += Quadric(triangle_planes[tidx], triangle_areas[tidx]);
                 }
             }
             if (q.IsInvertible()) {
-                Eigen::Vector3d v = q.Minimum();
-                mesh->vertices_[vox_vidx] = v;
-            } else {
-                mesh->vertices_[vox_vidx] = AvgVertex(voxel.second);
-            }
-
-            if (has_vert_normal) {
-                mesh->vertex_normals_[vox_vidx] = AvgNormal(voxel.second);
-            }
-            if (has_vert_color) {
-                mesh->vertex_colors_[vox_vidx] = AvgColor(voxel.second);
+                mesh->vertices_[vox_vidx] = q.Minimum();
             }
         }
+        if (has_vert_normal) {
+            mesh->vertex_normals_[vox_vidx] = Avg(vertex_normals_, voxel);
+        }
+        if (has_vert_color) {
+            mesh->vertex_colors_[vox_vidx] = Avg(vertex_colors_, voxel);
+        }
     }
 
     //  connect vertices
-    std::unordered_set<Eigen::Vector3i,
-                       utility::hash_eigen::hash<Eigen::Vector3i>>
-            triangles;
-    for (const auto& triangle : triangles_) {
-        int vidx0 = voxel_vert_ind[GetVoxelIdx(vertices_[triangle(0)])];
-        int vidx1 = voxel_vert_ind[GetVoxelIdx(vertices_[triangle(1)])];
-        int vidx2 = voxel_vert_ind[GetVoxelIdx(vertices_[triangle(2)])];
+    std::vector<std::pair<Eigen::Vector3i, int>> triangles(num_triangles);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int tidx = 0; tidx < num_triangles; tidx++) {
+        int vidx0 = vert_remapping[triangles_[tidx](0)];
+        int vidx1 = vert_remapping[triangles_[tidx](1)];
+        int vidx2 = vert_remapping[triangles_[tidx](2)];
 
         // only connect if in different voxels
         if (vidx0 == vidx1 || vidx0 == vidx2 || vidx1 == vidx2) {
+            triangles[tidx] = std::make_pair(Eigen::Vector3i(-1, -1, -1), tidx);
             continue;
         }
 
@@ -246,15 +337,32 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyVertexClustering(
             vidx0 = vidx2;
             vidx2 = tmp;
         }
-
-        triangles.emplace(Eigen::Vector3i(vidx0, vidx1, vidx2));
+        triangles[tidx] =
+                std::make_pair(Eigen::Vector3i(vidx0, vidx1, vidx2), tidx);
     }
 
-    mesh->triangles_.resize(triangles.size());
-    int tidx = 0;
-    for (const Eigen::Vector3i& triangle : triangles) {
-        mesh->triangles_[tidx] = triangle;
-        tidx++;
+    // Keep the first one of equal triangles.
+    triangles.erase(std::remove_if(triangles.begin(), triangles.end(),
+                                   [](const std::pair<Eigen::Vector3i, int>&
+                                              triangle) {
+                                       return triangle.first(0) < 0;
+                                   }),
+                    triangles.end());
+    utility::ParallelSort(triangles.begin(), triangles.end(),
+                          LexicographicLess);
+    std::vector<int> kept_positions(num_triangles, -1);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < int(triangles.size()); i++) {
+        if (i == 0 || triangles[i].first != triangles[i - 1].first) {
+            kept_positions[triangles[i].second] = i;
+        }
+    }
+    for (int tidx = 0; tidx < num_triangles; tidx++) {
+        if (kept_positions[tidx] >= 0) {
+            mesh->triangles_.push_back(triangles[kept_positions[tidx]].first);
+        }
     }
 
     if (HasTriangleNormals()) {
@@ -271,246 +379,337 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyQuadricDecimation(
                 "[SimplifyQuadricDecimation] This mesh contains triangle uvs "
                 "that are not handled in this function");
     }
-    typedef std::tuple<double, int, int> CostEdge;
 
     auto mesh = std::make_shared<TriangleMesh>();
     mesh->vertices_ = vertices_;
     mesh->vertex_normals_ = vertex_normals_;
     mesh->vertex_colors_ = vertex_colors_;
     mesh->triangles_ = triangles_;
+    std::vector<Eigen::Vector3d>& vertices = mesh->vertices_;
+    std::vector<Eigen::Vector3i>& triangles = mesh->triangles_;
+    const int num_vertices = int(vertices_.size());
+    const int num_triangles = int(triangles_.size());
+
+    std::vector<uint8_t> vertices_deleted(num_vertices, 0);
+    std::vector<uint8_t> triangles_deleted(num_triangles, 0);
+    MeshAdjacency vertex_triangles;
+    ComputeVertexTriangles(triangles, triangles_deleted, num_vertices,
+                           vertex_triangles);
+    auto TrianglesBegin = [&](int vidx) {
+        return vertex_triangles.indices_.data() +
+               vertex_triangles.offsets_[vidx];
+    };
+    auto TrianglesEnd = [&](int vidx) {
+        return vertex_triangles.indices_.data() +
+               vertex_triangles.offsets_[vidx + 1];
+    };
 
-    std::vector<bool> vertices_deleted(vertices_.size(), false);
-    std::vector<bool> triangles_deleted(triangles_.size(), false);
-
-    // Map vertices to triangles and compute triangle planes and areas
-    std::vector<std::unordered_set<int>> vert_to_triangles(vertices_.size());
-    std::vector<Eigen::Vector4d> triangle_planes(triangles_.size());
-    std::vector<double> triangle_areas(triangles_.size());
-    for (size_t tidx = 0; tidx < triangles_.size(); ++tidx) {
-        vert_to_triangles[triangles_[tidx](0)].emplace(static_cast<int>(tidx));
-        vert_to_triangles[triangles_[tidx](1)].emplace(static_cast<int>(tidx));
-        vert_to_triangles[triangles_[tidx](2)].emplace(static_cast<int>(tidx));
-
+    std::vector<Eigen::Vector4d> triangle_planes(num_triangles);
+    std::vector<double> triangle_areas(num_triangles);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int tidx = 0; tidx < num_triangles; tidx++) {
         triangle_planes[tidx] = GetTrianglePlane(tidx);
         triangle_areas[tidx] = GetTriangleArea(tidx);
     }
 
-    // Compute the error metric per vertex
-    std::vector<Quadric> Qs(vertices_.size());
-    for (size_t vidx = 0; vidx < vertices_.size(); ++vidx) {
-        for (int tidx : vert_to_triangles[vidx]) {
-            Qs[vidx] += Quadric(triangle_planes[tidx], triangle_areas[tidx]);
+    // Compute the error metric per vertex. For boundary edges add a
+    // perpendicular plane quadric. All triangles of an edge contain both of
+    // its vertices, so every vertex finds its boundary edges on its own.
+    std::vector<Quadric> Qs(num_vertices);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int vidx = 0; vidx < num_vertices; vidx++) {
+        for (const int* t = TrianglesBegin(vidx); t != TrianglesEnd(vidx);
+             t++) {
+            Qs[vidx] += Quadric(triangle_planes[*t], triangle_areas[*t]);
+            const Eigen::Vector3i& tria = triangles[*t];
+            for (int i = 0; i < 3; i++) {
+                int vidx0 = tria(i);
+                int vidx1 = tria((i + 1) % 3);
+                int vidx2 = tria((i + 2) % 3);
+                if (vidx0 != vidx && vidx1 != vidx) {
+                    continue;
+                }
+                int other = vidx0 == vidx ? vidx1 : vidx0;
+                int edge_triangle_count = 0;
+                for (const int* t2 = TrianglesBegin(vidx);
+                     t2 != TrianglesEnd(vidx); t2++) {
+                    const Eigen::Vector3i& tria2 = triangles[*t2];
+                    if (tria2(0) == other || tria2(1) == other ||
+                        tria2(2) == other) {
+                        edge_triangle_count++;
+                    }
+                }
+                if (edge_triangle_count != 1) {
+                    continue;
+                }
+                const auto& vert0 = vertices[vidx0];
+                const auto& vert1 = vertices[vidx1];
+                const auto& vert2 = vertices[vidx2];
+                Eigen::Vector3d vert2p = (vert2 - vert0).cross(vert2 - vert1);
+                Eigen::Vector4d plane =
+                        ComputeTrianglePlane(vert0, vert1, vert2p);
+                Qs[vidx] += Quadric(plane, triangle_areas[*t]);
+            }
         }
     }
 
-    // For boundary edges add perpendicular plane quadric
-    auto edge_triangle_count = GetEdgeToTrianglesMap();
-    auto AddPerpPlaneQuadric = [&](int vidx0, int vidx1, int vidx2,
-                                   double area) {
-        int min = std::min(vidx0, vidx1);
-        int max = std::max(vidx0, vidx1);
-        Eigen::Vector2i edge(min, max);
-        if (edge_triangle_count[edge].size() != 1) {
-            return;
+    // Position and cost of the collapse of an edge.
+    auto ComputeCollapse = [&](int vidx0, int vidx1, Eigen::Vector3d& vbar) {
+        Quadric Qbar = Qs[vidx0] + Qs[vidx1];
+        if (Qbar.IsInvertible()) {
+            vbar = Qbar.Minimum();
+            return Qbar.Eval(vbar);
         }
-        const auto& vert0 = mesh->vertices_[vidx0];
-        const auto& vert1 = mesh->vertices_[vidx1];
-        const auto& vert2 = mesh->vertices_[vidx2];
-        Eigen::Vector3d vert2p = (vert2 - vert0).cross(vert2 - vert1);
-        Eigen::Vector4d plane = ComputeTrianglePlane(vert0, vert1, vert2p);
-        Quadric quad(plane, area);
-        Qs[vidx0] += quad;
-        Qs[vidx1] += quad;
-    };
-    for (size_t tidx = 0; tidx < triangles_.size(); ++tidx) {
-        const auto& tria = triangles_[tidx];
-        double area = triangle_areas[tidx];
-        AddPerpPlaneQuadric(tria(0), tria(1), tria(2), area);
-        AddPerpPlaneQuadric(tria(1), tria(2), tria(0), area);
-        AddPerpPlaneQuadric(tria(2), tria(0), tria(1), area);
-    }
-
-    // Get valid edges and compute cost
-    // Note: We could also select all vertex pairs as edges with dist < eps
-    std::unordered_map<Eigen::Vector2i, Eigen::Vector3d,
-                       utility::hash_eigen::hash<Eigen::Vector2i>>
-            vbars;
-    std::unordered_map<Eigen::Vector2i, double,
-                       utility::hash_eigen::hash<Eigen::Vector2i>>
-            costs;
-    auto CostEdgeComp = [](const CostEdge& a, const CostEdge& b) {
-        return std::get<0>(a) > std::get<0>(b);
+        const Eigen::Vector3d& v0 = vertices[vidx0];
+        const Eigen::Vector3d& v1 = vertices[vidx1];
+        Eigen::Vector3d vmid = (v0 + v1) / 2;
+        double cost0 = Qbar.Eval(v0);
+        double cost1 = Qbar.Eval(v1);
+        double costmid = Qbar.Eval(vmid);
+        double cost = std::min(cost0, std::min(cost1, costmid));
+        if (cost == costmid) {
+            vbar = vmid;
+        } else if (cost == cost0) {
+            vbar = v0;
+        } else {
+            vbar = v1;
+        }
+        return cost;
     };
-    std::priority_queue<CostEdge, std::vector<CostEdge>, decltype(CostEdgeComp)>
-            queue(CostEdgeComp);
-
-    auto AddEdge = [&](int vidx0, int vidx1, bool update) {
-        int min = std::min(vidx0, vidx1);
-        int max = std::max(vidx0, vidx1);
-        Eigen::Vector2i edge(min, max);
-        if (update || vbars.count(edge) == 0) {
-            const Quadric& Q0 = Qs[min];
-            const Quadric& Q1 = Qs[max];
-            Quadric Qbar = Q0 + Q1;
-            double cost;
-            Eigen::Vector3d vbar;
-            if (Qbar.IsInvertible()) {
-                vbar = Qbar.Minimum();
-                cost = Qbar.Eval(vbar);
-            } else {
-                const Eigen::Vector3d& v0 = mesh->vertices_[vidx0];
-                const Eigen::Vector3d& v1 = mesh->vertices_[vidx0];
-                Eigen::Vector3d vmid = (v0 + v1) / 2;
-                double cost0 = Qbar.Eval(v0);
-                double cost1 = Qbar.Eval(v1);
-                double costmid = Qbar.Eval(vbar);
-                cost = std::min(cost0, std::min(cost1, costmid));
-                if (cost == costmid) {
-                    vbar = vmid;
-                } else if (cost == cost0) {
-                    vbar = v0;
-                } else {
-                    vbar = v1;
+
+    // Tests if moving both vertices of an edge to vbar flips the normal of a
+    // triangle that does not contain the edge.
+    auto FlipsTriangle = [&](int vidx0, int vidx1,
+                             const Eigen::Vector3d& vbar) {
+        for (int vidx : {vidx0, vidx1}) {
+            for (const int* t = TrianglesBegin(vidx); t != TrianglesEnd(vidx);
+                 t++) {
+                const Eigen::Vector3i& tria = triangles[*t];
+                bool has_vidx0 = vidx0 == tria(0) || vidx0 == tria(1) ||
+                                 vidx0 == tria(2);
+                bool has_vidx1 = vidx1 == tria(0) || vidx1 == tria(1) ||
+                                 vidx1 == tria(2);
+                if (has_vidx0 && has_vidx1) {
+                    continue;
+                }
+                Eigen::Vector3d vert[3];
+                for (int i = 0; i < 3; i++) {
+                    vert[i] = vertices[tria(i)];
+                }
+                Eigen::Vector3d norm_before =
+                        (vert[1] - vert[0]).cross(vert[2] - vert[0]);
+                for (int i = 0; i < 3; i++) {
+                    if (tria(i) == vidx0 || tria(i) == vidx1) {
+                        vert[i] = vbar;
+                    }
+                }
+                Eigen::Vector3d norm_after =
+                        (vert[1] - vert[0]).cross(vert[2] - vert[0]);
+                if (norm_before.dot(norm_after) < 0) {
+                    return true;
                 }
             }
-            vbars[edge] = vbar;
-            costs[edge] = cost;
-            queue.push(CostEdge(cost, min, max));
         }
+        return false;
     };
 
-    // add all edges to priority queue
-    for (const auto& triangle : triangles_) {
-        AddEdge(triangle(0), triangle(1), false);
-        AddEdge(triangle(1), triangle(2), false);
-        AddEdge(triangle(2), triangle(0), false);
-    }
+    // Calls f(vidx) for every vertex of the triangles around an edge, i.e.
+    // every vertex read or written by its collapse.
+    auto ForEachCollapseVertex = [&](int vidx0, int vidx1, auto f) {
+        for (int vidx : {vidx0, vidx1}) {
+            for (const int* t = TrianglesBegin(vidx); t != TrianglesEnd(vidx);
+                 t++) {
+                if (!f(triangles[*t](0)) || !f(triangles[*t](1)) ||
+                    !f(triangles[*t](2))) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    };
 
-    // perform incremental edge collapse
+    // Collapse edges in rounds. Each vertex proposes its cheapest edge that
+    // does not flip a triangle, and the cheapest proposals whose
+    // neighborhoods do not overlap are collapsed in parallel. Afterwards only
+    // the vertices next to a collapse update their proposal.
     bool has_vert_normal = HasVertexNormals();
     bool has_vert_color = HasVertexColors();
-    int n_triangles = int(triangles_.size());
-    while (n_triangles > target_number_of_triangles && !queue.empty()) {
-        // retrieve edge from queue
-        double cost;
-        int vidx0, vidx1;
-        std::tie(cost, vidx0, vidx1) = queue.top();
-        queue.pop();
-
-        // test if the edge has been updated (reinserted into queue)
-        Eigen::Vector2i edge(vidx0, vidx1);
-        bool valid = !vertices_deleted[vidx0] && !vertices_deleted[vidx1] &&
-                     cost == costs[edge];
-        if (!valid) {
-            continue;
-        }
-
-        // avoid flip of triangle normal
-        bool flipped = false;
-        for (int tidx : vert_to_triangles[vidx1]) {
-            if (triangles_deleted[tidx]) {
-                continue;
-            }
-
-            const Eigen::Vector3i& tria = mesh->triangles_[tidx];
-            bool has_vidx0 =
-                    vidx0 == tria(0) || vidx0 == tria(1) || vidx0 == tria(2);
-            bool has_vidx1 =
-                    vidx1 == tria(0) || vidx1 == tria(1) || vidx1 == tria(2);
-            if (has_vidx0 && has_vidx1) {
-                continue;
-            }
-
-            Eigen::Vector3d vert0 = mesh->vertices_[tria(0)];
-            Eigen::Vector3d vert1 = mesh->vertices_[tria(1)];
-            Eigen::Vector3d vert2 = mesh->vertices_[tria(2)];
-            Eigen::Vector3d norm_before = (vert1 - vert0).cross(vert2 - vert0);
-            norm_before /= norm_before.norm();
-
-            if (vidx1 == tria(0)) {
-                vert0 = vbars[edge];
-            } else if (vidx1 == tria(1)) {
-                vert1 = vbars[edge];
-            } else if (vidx1 == tria(2)) {
-                vert2 = vbars[edge];
-            }
-
-            Eigen::Vector3d norm_after = (vert1 - vert0).cross(vert2 - vert0);
-            norm_after /= norm_after.norm();
-            if (norm_before.dot(norm_after) < 0) {
-                flipped = true;
-                break;
+    std::vector<uint64_t> keys(num_vertices);
+    std::vector<int> partners(num_vertices);
+    std::vector<Eigen::Vector3d> vbars(num_vertices);
+    std::vector<uint8_t> claimed(num_vertices);
+    std::vector<uint8_t> dirty(num_vertices, 1);
+    std::vector<uint8_t> flipped(num_vertices);
+    std::vector<uint64_t> candidate_keys;
+    std::vector<int> collapses;
+    int n_triangles = num_triangles;
+    while (n_triangles > target_number_of_triangles) {
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+            std::vector<int> neighbors;
+            std::vector<std::pair<double, int>> proposals;
+            std::vector<Eigen::Vector3d> proposal_vbars;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 256)
+#endif
+            for (int vidx = 0; vidx < num_vertices; vidx++) {
+                claimed[vidx] = 0;
+                if (!dirty[vidx]) {
+                    continue;
+                }
+                keys[vidx] = kNoCollapse;
+                neighbors.clear();
+                for (const int* t = TrianglesBegin(vidx);
+                     t != TrianglesEnd(vidx); t++) {
+                    for (int i = 0; i < 3; i++) {
+                        if (triangles[*t](i) != vidx) {
+                            neighbors.push_back(triangles[*t](i));
+                        }
+                    }
+                }
+                std::sort(neighbors.begin(), neighbors.end());
+                neighbors.erase(std::unique(neighbors.begin(), neighbors.end()),
+                                neighbors.end());
+                // Test the cheapest edges first, the test for flipped
+                // triangles is more expensive than the cost.
+                proposals.clear();
+                proposal_vbars.resize(neighbors.size());
+                for (size_t i = 0; i < neighbors.size(); i++) {
+                    double cost = ComputeCollapse(
+                            std::min(vidx, neighbors[i]),
+                            std::max(vidx, neighbors[i]), proposal_vbars[i]);
+                    if (std::isfinite(cost)) {
+                        proposals.emplace_back(cost, int(i));
+                    }
+                }
+                std::sort(proposals.begin(), proposals.end());
+                flipped[vidx] = 0;
+                for (const auto& proposal : proposals) {
+                    int other = neighbors[proposal.second];
+                    const Eigen::Vector3d& vbar =
+                            proposal_vbars[proposal.second];
+                    if (FlipsTriangle(vidx, other, vbar)) {
+                        flipped[vidx] = 1;
+                        continue;
+                    }
+                    keys[vidx] = GetCollapseKey(proposal.first, vidx);
+                    partners[vidx] = other;
+                    vbars[vidx] = vbar;
+                    break;
+                }
             }
         }
-        if (flipped) {
-            continue;
-        }
-
-        // Connect triangles from vidx1 to vidx0, or mark deleted
-        for (int tidx : vert_to_triangles[vidx1]) {
-            if (triangles_deleted[tidx]) {
-                continue;
-            }
-
-            Eigen::Vector3i& tria = mesh->triangles_[tidx];
-            bool has_vidx0 =
-                    vidx0 == tria(0) || vidx0 == tria(1) || vidx0 == tria(2);
-            bool has_vidx1 =
-                    vidx1 == tria(0) || vidx1 == tria(1) || vidx1 == tria(2);
 
-            if (has_vidx0 && has_vidx1) {
-                triangles_deleted[tidx] = true;
-                n_triangles--;
-                continue;
+        // Only the cheapest proposals take part, and not more than needed to
+        // reach the target if every collapse removes two triangles.
+        candidate_keys.clear();
+        for (int vidx = 0; vidx < num_vertices; vidx++) {
+            if (keys[vidx] != kNoCollapse) {
+                candidate_keys.push_back(keys[vidx]);
             }
-
-            if (vidx1 == tria(0)) {
-                tria(0) = vidx0;
-            } else if (vidx1 == tria(1)) {
-                tria(1) = vidx0;
-            } else if (vidx1 == tria(2)) {
-                tria(2) = vidx0;
-            }
-            vert_to_triangles[vidx0].insert(tidx);
         }
-
-        // update vertex vidx0 to vbar
-        mesh->vertices_[vidx0] = vbars[edge];
-        Qs[vidx0] += Qs[vidx1];
-        if (has_vert_normal) {
-            mesh->vertex_normals_[vidx0] = 0.5 * (mesh->vertex_normals_[vidx0] +
-                                                  mesh->vertex_normals_[vidx1]);
+        if (candidate_keys.empty()) {
+            break;
         }
-        if (has_vert_color) {
-            mesh->vertex_colors_[vidx0] = 0.5 * (mesh->vertex_colors_[vidx0] +
-                                                 mesh->vertex_colors_[vidx1]);
+        size_t num_selected =
+                std::min((size_t)(n_triangles - target_number_of_triangles +
+                                  1) / 2,
+                         std::max(candidate_keys.size() / 4, size_t(1)));
+        num_selected = std::max(num_selected, size_t(1));
+        std::partial_sort(candidate_keys.begin(),
+                          candidate_keys.begin() + num_selected,
+                          candidate_keys.end());
+
+        // Accept the selected proposals in order of cost unless their
+        // neighborhood overlaps an accepted one, so the collapses of a round
+        // are independent.
+        collapses.clear();
+        for (size_t i = 0; i < num_selected; i++) {
+            int vidx = int(candidate_keys[i] & 0xffffffff);
+            if (ForEachCollapseVertex(vidx, partners[vidx],
+                                      [&](int v) { return !claimed[v]; })) {
+                ForEachCollapseVertex(vidx, partners[vidx], [&](int v) {
+                    claimed[v] = 1;
+                    return true;
+                });
+                collapses.push_back(vidx);
+            }
         }
-        vertices_deleted[vidx1] = true;
-
-        // Update edge costs for all triangles connecting to vidx0
-        for (const auto& tidx : vert_to_triangles[vidx0]) {
-            if (triangles_deleted[tidx]) {
-                continue;
+        int n_deleted = 0;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) reduction(+ : n_deleted)
+#endif
+        for (int cidx = 0; cidx < int(collapses.size()); cidx++) {
+            const int vidx = collapses[cidx];
+            // Connect triangles from vidx1 to vidx0, or mark deleted
+            const int vidx0 = std::min(vidx, partners[vidx]);
+            const int vidx1 = std::max(vidx, partners[vidx]);
+            for (const int* t = TrianglesBegin(vidx1); t != TrianglesEnd(vidx1);
+                 t++) {
+                Eigen::Vector3i& tria = triangles[*t];
+                if (vidx0 == tria(0) || vidx0 == tria(1) || vidx0 == tria(2)) {
+                    triangles_deleted[*t] = 1;
+                    n_deleted++;
+                    continue;
+                }
+                for (int i = 0; i < 3; i++) {
+                    if (tria(i) == vidx1) {
+                        tria(i) = vidx0;
+                    }
+                }
             }
-            const Eigen::Vector3i& tria = mesh->triangles_[tidx];
-            if (tria(0) == vidx0 || tria(1) == vidx0) {
-                AddEdge(tria(0), tria(1), true);
+
+            // update vertex vidx0 to vbar
+            vertices[vidx0] = vbars[vidx];
+            Qs[vidx0] += Qs[vidx1];
+            if (has_vert_normal) {
+                mesh->vertex_normals_[vidx0] =
+                        0.5 * (mesh->vertex_normals_[vidx0] +
+                               mesh->vertex_normals_[vidx1]);
             }
-            if (tria(1) == vidx0 || tria(2) == vidx0) {
-                AddEdge(tria(1), tria(2), true);
+            if (has_vert_color) {
+                mesh->vertex_colors_[vidx0] =
+                        0.5 * (mesh->vertex_colors_[vidx0] +
+                               mesh->vertex_colors_[vidx1]);
             }
-            if (tria(2) == vidx0 || tria(0) == vidx0) {
-                AddEdge(tria(2), tria(0), true);
+            vertices_deleted[vidx1] = 1;
+        }
+        n_triangles -= n_deleted;
+        ComputeVertexTriangles(triangles, triangles_deleted, num_vertices,
+                               vertex_triangles);
+
+        // A collapse changes the quadrics and triangles of its neighborhood
+        // only. Outside of it the costs stay the same, and a proposal changes
+        // if its partner is inside or if a cheaper edge into it flipped a
+        // triangle.
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int vidx = 0; vidx < num_vertices; vidx++) {
+            dirty[vidx] = claimed[vidx] || (keys[vidx] != kNoCollapse &&
+                                            claimed[partners[vidx]]);
+            for (const int* t = TrianglesBegin(vidx);
+                 flipped[vidx] && !dirty[vidx] && t != TrianglesEnd(vidx);
+                 t++) {
+                dirty[vidx] = claimed[triangles[*t](0)] ||
+                              claimed[triangles[*t](1)] ||
+                              claimed[triangles[*t](2)];
             }
         }
     }
 
     // Apply changes to the triangle mesh
     int next_free = 0;
-    std::unordered_map<int, int> vert_remapping;
-    for (size_t idx = 0; idx < mesh->vertices_.size(); ++idx) {
+    std::vector<int> vert_remapping(num_vertices, -1);
+    for (int idx = 0; idx < num_vertices; ++idx) {
         if (!vertices_deleted[idx]) {
-            vert_remapping[int(idx)] = next_free;
+            vert_remapping[idx] = next_free;
             mesh->vertices_[next_free] = mesh->vertices_[idx];
             if (has_vert_normal) {
                 mesh->vertex_normals_[next_free] = mesh->vertex_normals_[idx];
@@ -530,7 +729,7 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyQuadricDecimation(
     }
 
     next_free = 0;
-    for (size_t idx = 0; idx < mesh->triangles_.size(); ++idx) {
+    for (int idx = 0; idx < num_triangles; ++idx) {
         if (!triangles_deleted[idx]) {
             Eigen::Vector3i tria = mesh->triangles_[idx];
             mesh->triangles_[next_free](0) = vert_remapping[tria(0)];
@@ -27,14 +27,197 @@
 #include "Open3D/Geometry/TriangleMesh.h"
 
 #include <Eigen/Dense>
-#include <queue>
-#include <tuple>
+#include <atomic>
+#include <utility>
 
 #include "Open3D/Utility/Console.h"
 
 namespace open3d {
 namespace geometry {
 
+namespace {
+
+/// Unique edges of the triangles of a mesh. Corner 3 * tidx + i of a triangle
+/// stands for its edge from vertex i to vertex (i + 1) % 3.
+struct TriangleEdges {
+    /// Ordered vertex indices of every edge. Edges are numbered in the order
+    /// in which they first appear in the triangles.
+    std::vector<Eigen::Vector2i> edges_;
+    /// Corners of every edge in increasing order.
+    MeshAdjacency edge_corners_;
+    /// Edge of every corner.
+    std::vector<int> corner_edges_;
+};
+
+TriangleEdges ComputeTriangleEdges(
+        const std::vector<Eigen::Vector3i> &triangles) {
+    const int num_corners = 3 * int(triangles.size());
+    auto GetCornerEdge = [&](int corner) {
+        const Eigen::Vector3i &triangle = triangles[corner / 3];
+        return TriangleMesh::GetOrderedEdge(triangle(corner % 3),
+                                            triangle((corner + 1) % 3));
+    };
+
+    // Sort the corners by edge, every run of equal edges is a unique edge.
+    std::vector<std::pair<uint64_t, int>> keyed(num_corners);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int corner = 0; corner < num_corners; corner++) {
+        Eigen::Vector2i edge = GetCornerEdge(corner);
+        keyed[corner] = std::make_pair(
+                (uint64_t(uint32_t(edge(0))) << 32) | uint32_t(edge(1)),
+                corner);
+    }
+    utility::ParallelSort(keyed.begin(), keyed.end(),
+                          std::less<std::pair<uint64_t, int>>());
+    auto IsRunStart = [&](int pos) {
+        return pos == 0 || keyed[pos].first != keyed[pos - 1].first;
+    };
+
+    // Number the edges by their first corner and count their corners.
+    TriangleEdges result;
+    result.corner_edges_.assign(num_corners, -1);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int pos = 0; pos < num_corners; pos++) {
+        if (IsRunStart(pos)) {
+            result.corner_edges_[keyed[pos].second] = 0;
+        }
+    }
+    int num_edges = 0;
+    for (int corner = 0; corner < num_corners; corner++) {
+        if (result.corner_edges_[corner] == 0) {
+            result.corner_edges_[corner] = num_edges++;
+        }
+    }
+    std::vector<int> &offsets = result.edge_corners_.offsets_;
+    offsets.resize(num_edges + 1);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int pos = 0; pos < num_corners; pos++) {
+        if (IsRunStart(pos)) {
+            int end = pos + 1;
+            while (end < num_corners && !IsRunStart(end)) {
+                end++;
+            }
+            offsets[result.corner_edges_[keyed[pos].second] + 1] = end - pos;
+        }
+    }
+    offsets[0] = 0;
+    for (int eidx = 0; eidx < num_edges; eidx++) {
+        offsets[eidx + 1] += offsets[eidx];
+    }
+
+    result.edges_.resize(num_edges);
+    result.edge_corners_.indices_.resize(num_corners);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int pos = 0; pos < num_corners; pos++) {
+        if (IsRunStart(pos)) {
+            int eidx = result.corner_edges_[keyed[pos].second];
+            result.edges_[eidx] = GetCornerEdge(keyed[pos].second);
+            for (int i = offsets[eidx]; i < offsets[eidx + 1]; i++) {
+                int corner = keyed[pos + i - offsets[eidx]].second;
+                result.edge_corners_.indices_[i] = corner;
+                result.corner_edges_[corner] = eidx;
+            }
+        }
+    }
+    return result;
+}
+
+/// Computes the edges incident to every vertex, in increasing order.
+MeshAdjacency ComputeVertexEdges(const std::vector<Eigen::Vector2i> &edges,
+                                 int num_vertices) {
+    const int num_edges = int(edges.size());
+    std::vector<std::atomic<int>> cursors(num_vertices);
+    for (auto &cursor : cursors) {
+        cursor.store(0, std::memory_order_relaxed);
+    }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int eidx = 0; eidx < num_edges; eidx++) {
+        cursors[edges[eidx](0)].fetch_add(1, std::memory_order_relaxed);
+        if (edges[eidx](1) != edges[eidx](0)) {
+            cursors[edges[eidx](1)].fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    MeshAdjacency adjacency;
+    adjacency.offsets_.resize(num_vertices + 1);
+    adjacency.offsets_[0] = 0;
+    for (int vidx = 0; vidx < num_vertices; vidx++) {
+        adjacency.offsets_[vidx + 1] =
+                adjacency.offsets_[vidx] + cursors[vidx].load();
+        cursors[vidx].store(adjacency.offsets_[vidx]);
+    }
+    adjacency.indices_.resize(adjacency.offsets_[num_vertices]);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int eidx = 0; eidx < num_edges; eidx++) {
+        adjacency.indices_[cursors[edges[eidx](0)].fetch_add(1)] = eidx;
+        if (edges[eidx](1) != edges[eidx](0)) {
+            adjacency.indices_[cursors[edges[eidx](1)].fetch_add(1)] = eidx;
+        }
+    }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int vidx = 0; vidx < num_vertices; vidx++) {
+        std::sort(adjacency.indices_.begin() + adjacency.offsets_[vidx],
+                  adjacency.indices_.begin() + adjacency.offsets_[vidx + 1]);
+    }
+    return adjacency;
+}
+
+/// Splits every triangle into four triangles. The vertex of edge eidx is
+/// num_vertices + eidx.
+std::vector<Eigen::Vector3i> SplitTriangles(
+        const std::vector<Eigen::Vector3i> &triangles,
+        const TriangleEdges &edges,
+        int num_vertices) {
+    std::vector<Eigen::Vector3i> new_triangles(4 * triangles.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int tidx = 0; tidx < int(triangles.size()); tidx++) {
+        const Eigen::Vector3i &triangle = triangles[tidx];
+        int vidx01 = num_vertices + edges.corner_edges_[3 * tidx + 0];
+        int vidx12 = num_vertices + edges.corner_edges_[3 * tidx + 1];
+        int vidx20 = num_vertices + edges.corner_edges_[3 * tidx + 2];
+        new_triangles[tidx * 4 + 0] =
+                Eigen::Vector3i(triangle(0), vidx01, vidx20);
+        new_triangles[tidx * 4 + 1] =
+                Eigen::Vector3i(vidx01, triangle(1), vidx12);
+        new_triangles[tidx * 4 + 2] =
+                Eigen::Vector3i(vidx12, triangle(2), vidx20);
+        new_triangles[tidx * 4 + 3] = Eigen::Vector3i(vidx01, vidx12, vidx20);
+    }
+    return new_triangles;
+}
+
+/// Returns the per-vertex arrays of the mesh that are interpolated by the
+/// subdivision.
+std::vector<std::vector<Eigen::Vector3d> *> GetVertexAttributes(
+        TriangleMesh &mesh) {
+    std::vector<std::vector<Eigen::Vector3d> *> attributes = {&mesh.vertices_};
+    if (mesh.HasVertexNormals()) {
+        attributes.push_back(&mesh.vertex_normals_);
+    }
+    if (mesh.HasVertexColors()) {
+        attributes.push_back(&mesh.vertex_colors_);
+    }
+    return attributes;
+}
+
+}  // unnamed namespace
+
 std::shared_ptr<TriangleMesh> TriangleMesh::SubdivideMidpoint(
         int number_of_iterations) const {
     if (HasTriangleUvs()) {
@@ -47,63 +230,30 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SubdivideMidpoint(
     mesh->vertex_colors_ = vertex_colors_;
     mesh->vertex_normals_ = vertex_normals_;
     mesh->triangles_ = triangles_;
+    auto attributes = GetVertexAttributes(*mesh);
 
-    bool has_vert_normal = HasVertexNormals();
-    bool has_vert_color = HasVertexColors();
-
-    // Compute and return midpoint.
-    // Also adds edge - new vertex refrence to new_verts map.
-    auto SubdivideEdge =
-            [&](std::unordered_map<Eigen::Vector2i, int,
-                                   utility::hash_eigen::hash<Eigen::Vector2i>>&
-                        new_verts,
-                int vidx0, int vidx1) {
-                int min = std::min(vidx0, vidx1);
-                int max = std::max(vidx0, vidx1);
-                Eigen::Vector2i edge(min, max);
-                if (new_verts.count(edge) == 0) {
-                    mesh->vertices_.push_back(0.5 * (mesh->vertices_[min] +
-                                                     mesh->vertices_[max]));
-                    if (has_vert_normal) {
-                        mesh->vertex_normals_.push_back(
-                                0.5 * (mesh->vertex_normals_[min] +
-                                       mesh->vertex_normals_[max]));
-                    }
-                    if (has_vert_color) {
-                        mesh->vertex_colors_.push_back(
-                                0.5 * (mesh->vertex_colors_[min] +
-                                       mesh->vertex_colors_[max]));
-                    }
-                    int vidx01 = int(mesh->vertices_.size()) - 1;
-                    new_verts[edge] = vidx01;
-                    return vidx01;
-                } else {
-                    return new_verts[edge];
-                }
-            };
+    // The old vertices are kept, so every level appends the midpoints of the
+    // edges to the vertex arrays.
     for (int iter = 0; iter < number_of_iterations; ++iter) {
-        std::unordered_map<Eigen::Vector2i, int,
-                           utility::hash_eigen::hash<Eigen::Vector2i>>
-                new_verts;
-        std::vector<Eigen::Vector3i> new_triangles(4 * mesh->triangles_.size());
-        for (size_t tidx = 0; tidx < mesh->triangles_.size(); ++tidx) {
-            const auto& triangle = mesh->triangles_[tidx];
-            int vidx0 = triangle(0);
-            int vidx1 = triangle(1);
-            int vidx2 = triangle(2);
-            int vidx01 = SubdivideEdge(new_verts, vidx0, vidx1);
-            int vidx12 = SubdivideEdge(new_verts, vidx1, vidx2);
-            int vidx20 = SubdivideEdge(new_verts, vidx2, vidx0);
-            new_triangles[tidx * 4 + 0] =
-                    Eigen::Vector3i(vidx0, vidx01, vidx20);
-            new_triangles[tidx * 4 + 1] =
-                    Eigen::Vector3i(vidx01, vidx1, vidx12);
-            new_triangles[tidx * 4 + 2] =
-                    Eigen::Vector3i(vidx12, vidx2, vidx20);
-            new_triangles[tidx * 4 + 3] =
-                    Eigen::Vector3i(vidx01, vidx12, vidx20);
+        TriangleEdges edges = ComputeTriangleEdges(mesh->triangles_);
+        const int num_vertices = int(mesh->vertices_.size());
+        const int num_edges = int(edges.edges_.size());
+        for (auto attribute : attributes) {
+            attribute->resize(num_vertices + num_edges);
+        }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int eidx = 0; eidx < num_edges; eidx++) {
+            const Eigen::Vector2i &edge = edges.edges_[eidx];
+            for (auto attribute : attributes) {
+                std::vector<Eigen::Vector3d> &values = *attribute;
+                values[num_vertices + eidx] =
+                        0.5 * (values[edge(0)] + values[edge(1)]);
+            }
         }
-        mesh->triangles_ = new_triangles;
+        mesh->triangles_ =
+                SplitTriangles(mesh->triangles_, edges, num_vertices);
     }
 
     if (HasTriangleNormals()) {
@@ -120,260 +270,118 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SubdivideLoop(
                 "[SubdivideLoop] This mesh contains triangle uvs that are not "
                 "handled in this function");
     }
-    typedef std::unordered_map<Eigen::Vector2i, int,
-                               utility::hash_eigen::hash<Eigen::Vector2i>>
-            EdgeNewVertMap;
-    typedef std::unordered_map<Eigen::Vector2i, std::unordered_set<int>,
-                               utility::hash_eigen::hash<Eigen::Vector2i>>
-            EdgeTrianglesMap;
-    typedef std::vector<std::unordered_set<int>> VertexNeighbours;
-
-    bool has_vert_normal = HasVertexNormals();
-    bool has_vert_color = HasVertexColors();
-
-    auto UpdateVertex = [&](int vidx,
-                            const std::shared_ptr<TriangleMesh>& old_mesh,
-                            std::shared_ptr<TriangleMesh>& new_mesh,
-                            const std::unordered_set<int>& nbs,
-                            const EdgeTrianglesMap& edge_to_triangles) {
-        // check if boundary edge and get nb vertices in that case
-        std::unordered_set<int> boundary_nbs;
-        for (int nb : nbs) {
-            const Eigen::Vector2i edge = GetOrderedEdge(vidx, nb);
-            if (edge_to_triangles.at(edge).size() == 1) {
-                boundary_nbs.insert(nb);
-            }
-        }
-
-        // in manifold meshes this should not happen
-        if (boundary_nbs.size() > 2) {
-            utility::LogWarning(
-                    "[SubdivideLoop] boundary edge with > 2 neighbours, maybe "
-                    "mesh is not manifold.");
-        }
-
-        double beta, alpha;
-        if (boundary_nbs.size() >= 2) {
-            beta = 1. / 8.;
-            alpha = 1. - boundary_nbs.size() * beta;
-        } else if (nbs.size() == 3) {
-            beta = 3. / 16.;
-            alpha = 1. - nbs.size() * beta;
-        } else {
-            beta = 3. / (8. * nbs.size());
-            alpha = 1. - nbs.size() * beta;
-        }
-
-        new_mesh->vertices_[vidx] = alpha * old_mesh->vertices_[vidx];
-        if (has_vert_normal) {
-            new_mesh->vertex_normals_[vidx] =
-                    alpha * old_mesh->vertex_normals_[vidx];
-        }
-        if (has_vert_color) {
-            new_mesh->vertex_colors_[vidx] =
-                    alpha * old_mesh->vertex_colors_[vidx];
-        }
+    auto mesh = std::make_shared<TriangleMesh>();
+    mesh->vertices_ = vertices_;
+    mesh->vertex_colors_ = vertex_colors_;
+    mesh->vertex_normals_ = vertex_normals_;
+    mesh->triangles_ = triangles_;
+    auto attributes = GetVertexAttributes(*mesh);
+    // The old vertices move, so every level writes to a second set of vertex
+    // arrays that is swapped with the arrays of the mesh afterwards.
+    std::vector<std::vector<Eigen::Vector3d>> new_attributes(attributes.size());
 
-        auto Update = [&](int nb) {
-            new_mesh->vertices_[vidx] += beta * old_mesh->vertices_[nb];
-            if (has_vert_normal) {
-                new_mesh->vertex_normals_[vidx] +=
-                        beta * old_mesh->vertex_normals_[nb];
-            }
-            if (has_vert_color) {
-                new_mesh->vertex_colors_[vidx] +=
-                        beta * old_mesh->vertex_colors_[nb];
-            }
+    for (int iter = 0; iter < number_of_iterations; ++iter) {
+        TriangleEdges edges = ComputeTriangleEdges(mesh->triangles_);
+        const int num_vertices = int(mesh->vertices_.size());
+        const int num_edges = int(edges.edges_.size());
+        MeshAdjacency vertex_edges =
+                ComputeVertexEdges(edges.edges_, num_vertices);
+        auto NumEdgeTriangles = [&](int eidx) {
+            return int(edges.edge_corners_[eidx].size());
         };
-        if (boundary_nbs.size() >= 2) {
-            for (int nb : boundary_nbs) {
-                Update(nb);
-            }
-        } else {
-            for (int nb : nbs) {
-                Update(nb);
-            }
+        for (auto &new_values : new_attributes) {
+            new_values.resize(num_vertices + num_edges);
         }
-    };
-
-    auto SubdivideEdge = [&](int vidx0, int vidx1,
-                             const std::shared_ptr<TriangleMesh>& old_mesh,
-                             std::shared_ptr<TriangleMesh>& new_mesh,
-                             EdgeNewVertMap& new_verts,
-                             const EdgeTrianglesMap& edge_to_triangles) {
-        Eigen::Vector2i edge = GetOrderedEdge(vidx0, vidx1);
-        if (new_verts.count(edge) == 0) {
-            Eigen::Vector3d new_vert =
-                    old_mesh->vertices_[vidx0] + old_mesh->vertices_[vidx1];
-            Eigen::Vector3d new_normal;
-            if (has_vert_normal) {
-                new_normal = old_mesh->vertex_normals_[vidx0] +
-                             old_mesh->vertex_normals_[vidx1];
-            }
-            Eigen::Vector3d new_color;
-            if (has_vert_color) {
-                new_color = old_mesh->vertex_colors_[vidx0] +
-                            old_mesh->vertex_colors_[vidx1];
-            }
 
-            const auto& edge_triangles = edge_to_triangles.at(edge);
-            if (edge_triangles.size() < 2) {
-                new_vert *= 0.5;
-                if (has_vert_normal) {
-                    new_normal *= 0.5;
+        bool non_manifold = false;
+        bool boundary_warning = false;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) reduction(|| : non_manifold)
+#endif
+        for (int eidx = 0; eidx < num_edges; eidx++) {
+            const Eigen::Vector2i &edge = edges.edges_[eidx];
+            const int num_edge_triangles = NumEdgeTriangles(eidx);
+            non_manifold = non_manifold || num_edge_triangles > 2;
+            for (size_t a = 0; a < attributes.size(); a++) {
+                const std::vector<Eigen::Vector3d> &values = *attributes[a];
+                Eigen::Vector3d value = values[edge(0)] + values[edge(1)];
+                if (num_edge_triangles < 2) {
+                    value *= 0.5;
+                } else {
+                    value *= 3. / 8.;
+                    double scale = 1. / (4. * num_edge_triangles);
+                    for (int corner : edges.edge_corners_[eidx]) {
+                        const Eigen::Vector3i &triangle =
+                                mesh->triangles_[corner / 3];
+                        value += scale * values[triangle((corner + 2) % 3)];
+                    }
                 }
-                if (has_vert_color) {
-                    new_color *= 0.5;
+                new_attributes[a][num_vertices + eidx] = value;
+            }
+        }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) reduction(|| : boundary_warning)
+#endif
+        for (int vidx = 0; vidx < num_vertices; vidx++) {
+            int num_nbs = int(vertex_edges[vidx].size());
+            int num_boundary_nbs = 0;
+            for (int eidx : vertex_edges[vidx]) {
+                if (NumEdgeTriangles(eidx) == 1) {
+                    num_boundary_nbs++;
                 }
+            }
+            // in manifold meshes this should not happen
+            boundary_warning = boundary_warning || num_boundary_nbs > 2;
+
+            bool boundary = num_boundary_nbs >= 2;
+            double beta, alpha;
+            if (boundary) {
+                beta = 1. / 8.;
+                alpha = 1. - num_boundary_nbs * beta;
+            } else if (num_nbs == 0) {
+                beta = 0.;
+                alpha = 1.;
+            } else if (num_nbs == 3) {
+                beta = 3. / 16.;
+                alpha = 1. - num_nbs * beta;
             } else {
-                new_vert *= 3. / 8.;
-                if (has_vert_normal) {
-                    new_normal *= 3. / 8.;
-                }
-                if (has_vert_color) {
-                    new_color *= 3. / 8.;
-                }
-                size_t n_adjacent_trias = edge_triangles.size();
-                double scale = 1. / (4. * n_adjacent_trias);
-                for (int tidx : edge_triangles) {
-                    const auto& tria = old_mesh->triangles_[tidx];
-                    int vidx2 =
-                            (tria(0) != vidx0 && tria(0) != vidx1)
-                                    ? tria(0)
-                                    : ((tria(1) != vidx0 && tria(1) != vidx1)
-                                               ? tria(1)
-                                               : tria(2));
-                    new_vert += scale * old_mesh->vertices_[vidx2];
-                    if (has_vert_normal) {
-                        new_normal += scale * old_mesh->vertex_normals_[vidx2];
-                    }
-                    if (has_vert_color) {
-                        new_color += scale * old_mesh->vertex_colors_[vidx2];
+                beta = 3. / (8. * num_nbs);
+                alpha = 1. - num_nbs * beta;
+            }
+            for (size_t a = 0; a < attributes.size(); a++) {
+                const std::vector<Eigen::Vector3d> &values = *attributes[a];
+                Eigen::Vector3d value = alpha * values[vidx];
+                for (int eidx : vertex_edges[vidx]) {
+                    if (!boundary || NumEdgeTriangles(eidx) == 1) {
+                        const Eigen::Vector2i &edge = edges.edges_[eidx];
+                        int nb = edge(0) == vidx ? edge(1) : edge(0);
+                        value += beta * values[nb];
                     }
                 }
+                new_attributes[a][vidx] = value;
             }
-
-            int vidx01 = int(old_mesh->vertices_.size() + new_verts.size());
-
-            new_mesh->vertices_[vidx01] = new_vert;
-            if (has_vert_normal) {
-                new_mesh->vertex_normals_[vidx01] = new_normal;
-            }
-            if (has_vert_color) {
-                new_mesh->vertex_colors_[vidx01] = new_color;
-            }
-
-            new_verts[edge] = vidx01;
-            return vidx01;
-        } else {
-            int vidx01 = new_verts[edge];
-            return vidx01;
         }
-    };
-
-    auto InsertTriangle = [&](int tidx, int vidx0, int vidx1, int vidx2,
-                              std::shared_ptr<TriangleMesh>& mesh,
-                              EdgeTrianglesMap& edge_to_triangles,
-                              VertexNeighbours& vertex_neighbours) {
-        mesh->triangles_[tidx] = Eigen::Vector3i(vidx0, vidx1, vidx2);
-        edge_to_triangles[GetOrderedEdge(vidx0, vidx1)].insert(tidx);
-        edge_to_triangles[GetOrderedEdge(vidx1, vidx2)].insert(tidx);
-        edge_to_triangles[GetOrderedEdge(vidx2, vidx0)].insert(tidx);
-        vertex_neighbours[vidx0].insert(vidx1);
-        vertex_neighbours[vidx0].insert(vidx2);
-        vertex_neighbours[vidx1].insert(vidx0);
-        vertex_neighbours[vidx1].insert(vidx2);
-        vertex_neighbours[vidx2].insert(vidx0);
-        vertex_neighbours[vidx2].insert(vidx1);
-    };
-
-    EdgeTrianglesMap edge_to_triangles;
-    VertexNeighbours vertex_neighbours(vertices_.size());
-    for (size_t tidx = 0; tidx < triangles_.size(); ++tidx) {
-        const auto& tria = triangles_[tidx];
-        Eigen::Vector2i e0 = GetOrderedEdge(tria(0), tria(1));
-        edge_to_triangles[e0].insert(int(tidx));
-        Eigen::Vector2i e1 = GetOrderedEdge(tria(1), tria(2));
-        edge_to_triangles[e1].insert(int(tidx));
-        Eigen::Vector2i e2 = GetOrderedEdge(tria(2), tria(0));
-        edge_to_triangles[e2].insert(int(tidx));
-
-        if (edge_to_triangles[e0].size() > 2 ||
-            edge_to_triangles[e1].size() > 2 ||
-            edge_to_triangles[e2].size() > 2) {
+        if (non_manifold) {
             utility::LogWarning("[SubdivideLoop] non-manifold edge.");
         }
-
-        vertex_neighbours[tria(0)].insert(tria(1));
-        vertex_neighbours[tria(0)].insert(tria(2));
-        vertex_neighbours[tria(1)].insert(tria(0));
-        vertex_neighbours[tria(1)].insert(tria(2));
-        vertex_neighbours[tria(2)].insert(tria(0));
-        vertex_neighbours[tria(2)].insert(tria(1));
-    }
-
-    auto old_mesh = std::make_shared<TriangleMesh>();
-    old_mesh->vertices_ = vertices_;
-    old_mesh->vertex_colors_ = vertex_colors_;
-    old_mesh->vertex_normals_ = vertex_normals_;
-    old_mesh->triangles_ = triangles_;
-
-    for (int iter = 0; iter < number_of_iterations; ++iter) {
-        size_t n_new_vertices =
-                old_mesh->vertices_.size() + edge_to_triangles.size();
-        size_t n_new_triangles = 4 * old_mesh->triangles_.size();
-        auto new_mesh = std::make_shared<TriangleMesh>();
-        new_mesh->vertices_.resize(n_new_vertices);
-        if (has_vert_normal) {
-            new_mesh->vertex_normals_.resize(n_new_vertices);
-        }
-        if (has_vert_color) {
-            new_mesh->vertex_colors_.resize(n_new_vertices);
-        }
-        new_mesh->triangles_.resize(n_new_triangles);
-
-        EdgeNewVertMap new_verts;
-        EdgeTrianglesMap new_edge_to_triangles;
-        VertexNeighbours new_vertex_neighbours(n_new_vertices);
-
-        for (size_t vidx = 0; vidx < old_mesh->vertices_.size(); ++vidx) {
-            UpdateVertex(int(vidx), old_mesh, new_mesh, vertex_neighbours[vidx],
-                         edge_to_triangles);
+        if (boundary_warning) {
+            utility::LogWarning(
+                    "[SubdivideLoop] boundary edge with > 2 neighbours, maybe "
+                    "mesh is not manifold.");
         }
 
-        for (size_t tidx = 0; tidx < old_mesh->triangles_.size(); ++tidx) {
-            const auto& triangle = old_mesh->triangles_[tidx];
-            int vidx0 = triangle(0);
-            int vidx1 = triangle(1);
-            int vidx2 = triangle(2);
-
-            int vidx01 = SubdivideEdge(vidx0, vidx1, old_mesh, new_mesh,
-                                       new_verts, edge_to_triangles);
-            int vidx12 = SubdivideEdge(vidx1, vidx2, old_mesh, new_mesh,
-                                       new_verts, edge_to_triangles);
-            int vidx20 = SubdivideEdge(vidx2, vidx0, old_mesh, new_mesh,
-                                       new_verts, edge_to_triangles);
-
-            InsertTriangle(int(tidx) * 4 + 0, vidx0, vidx01, vidx20, new_mesh,
-                           new_edge_to_triangles, new_vertex_neighbours);
-            InsertTriangle(int(tidx) * 4 + 1, vidx01, vidx1, vidx12, new_mesh,
-                           new_edge_to_triangles, new_vertex_neighbours);
-            InsertTriangle(int(tidx) * 4 + 2, vidx12, vidx2, vidx20, new_mesh,
-                           new_edge_to_triangles, new_vertex_neighbours);
-            InsertTriangle(int(tidx) * 4 + 3, vidx01, vidx12, vidx20, new_mesh,
-                           new_edge_to_triangles, new_vertex_neighbours);
+        for (size_t a = 0; a < attributes.size(); a++) {
+            attributes[a]->swap(new_attributes[a]);
         }
-
-        old_mesh = std::move(new_mesh);
-        edge_to_triangles = std::move(new_edge_to_triangles);
-        vertex_neighbours = std::move(new_vertex_neighbours);
+        mesh->triangles_ =
+                SplitTriangles(mesh->triangles_, edges, num_vertices);
     }
 
     if (HasTriangleNormals()) {
-        old_mesh->ComputeTriangleNormals();
+        mesh->ComputeTriangleNormals();
     }
 
-    return old_mesh;
+    return mesh;
 }
 
 }  // namespace geometry
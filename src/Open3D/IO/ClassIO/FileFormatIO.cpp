@@ -38,10 +38,12 @@ static std::map<std::string, FileGeometry (*)(const std::string&)> gExt2Func = {
         {"gltf", ReadFileGeometryTypeGLTF},
         {"obj", ReadFileGeometryTypeOBJ},
         {"off", ReadFileGeometryTypeOFF},
+        {"opc", ReadFileGeometryTypeOPC},
         {"pcd", ReadFileGeometryTypePCD},
         {"ply", ReadFileGeometryTypePLY},
         {"pts", ReadFileGeometryTypePTS},
         {"stl", ReadFileGeometryTypeSTL},
+        {"tpc", ReadFileGeometryTypeTPC},
         {"xyz", ReadFileGeometryTypeXYZ},
         {"xyzn", ReadFileGeometryTypeXYZN},
         {"xyzrgb", ReadFileGeometryTypeXYZRGB},
@@ -47,9 +47,11 @@ FileGeometry ReadFileGeometryTypeGLTF(const std::string& path);
 FileGeometry ReadFileGeometryTypeOBJ(const std::string& path);
 FileGeometry ReadFileGeometryTypeOFF(const std::string& path);
 FileGeometry ReadFileGeometryTypePCD(const std::string& path);
+FileGeometry ReadFileGeometryTypeOPC(const std::string& path);
 FileGeometry ReadFileGeometryTypePLY(const std::string& path);
 FileGeometry ReadFileGeometryTypePTS(const std::string& path);
 FileGeometry ReadFileGeometryTypeSTL(const std::string& path);
+FileGeometry ReadFileGeometryTypeTPC(const std::string& path);
 FileGeometry ReadFileGeometryTypeXYZ(const std::string& path);
 FileGeometry ReadFileGeometryTypeXYZN(const std::string& path);
 FileGeometry ReadFileGeometryTypeXYZRGB(const std::string& path);
@@ -40,6 +40,7 @@ static const std::unordered_map<
         std::function<bool(const std::string &, geometry::Octree &)>>
         file_extension_to_octree_read_function{
                 {"json", ReadOctreeFromJson},
+                {"opc", ReadOctreeFromOPC},
         };
 
 static const std::unordered_map<
@@ -47,6 +48,7 @@ static const std::unordered_map<
         std::function<bool(const std::string &, const geometry::Octree &)>>
         file_extension_to_octree_write_function{
                 {"json", WriteOctreeToJson},
+                {"opc", WriteOctreeToOPC},
         };
 
 std::shared_ptr<geometry::Octree> CreateOctreeFromFile(
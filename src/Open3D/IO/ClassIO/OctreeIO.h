@@ -26,7 +26,9 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
+#include <vector>
 
 #include "Open3D/Geometry/Octree.h"
 
@@ -57,5 +59,31 @@ bool ReadOctreeFromJson(const std::string &filename, geometry::Octree &octree);
 bool WriteOctreeToJson(const std::string &filename,
                        const geometry::Octree &octree);
 
+/// Reads an octree compressed file (.opc), see DecodeOctreeFromOPC().
+bool ReadOctreeFromOPC(const std::string &filename, geometry::Octree &octree);
+
+/// Writes an octree compressed file (.opc), see EncodeOctreeToOPC().
+bool WriteOctreeToOPC(const std::string &filename,
+                      const geometry::Octree &octree);
+
+/// Encodes the structure and leaf colors of \p octree into an in-memory
+/// .opc stream. All leaves must be at max_depth_, i.e. the octree must be
+/// built by ConvertFromPointCloud() or InsertPoint(), and max_depth_ must be
+/// at most 21. Colors are stored with 8 bits per channel.
+bool EncodeOctreeToOPC(const geometry::Octree &octree,
+                       std::vector<std::uint8_t> &buffer);
+
+/// Decodes an in-memory .opc stream into an octree of OctreeColorLeafNode
+/// leaves. Point clouds encoded with EncodePointCloudToOPC() decode to the
+/// octree of their leaves.
+bool DecodeOctreeFromOPC(const std::vector<std::uint8_t> &buffer,
+                         geometry::Octree &octree);
+
+/// Decodes the .opc stream of \p size bytes at \p buffer, e.g. a memory
+/// mapped file, see DecodeOctreeFromOPC().
+bool DecodeOctreeFromOPC(const std::uint8_t *buffer,
+                         size_t size,
+                         geometry::Octree &octree);
+
 }  // namespace io
 }  // namespace open3d
@@ -47,6 +47,8 @@ static const std::unordered_map<
                 {"ply", ReadPointCloudFromPLY},
                 {"pcd", ReadPointCloudFromPCD},
                 {"pts", ReadPointCloudFromPTS},
+                {"opc", ReadPointCloudFromOPC},
+                {"tpc", ReadPointCloudFromTPC},
         };
 
 static const std::unordered_map<std::string,
@@ -62,6 +64,8 @@ static const std::unordered_map<std::string,
                 {"ply", WritePointCloudToPLY},
                 {"pcd", WritePointCloudToPCD},
                 {"pts", WritePointCloudToPTS},
+                {"opc", WritePointCloudToOPC},
+                {"tpc", WritePointCloudToTPC},
         };
 }  // unnamed namespace
 
@@ -115,6 +119,27 @@ bool ReadPointCloud(const std::string &filename,
     return success;
 }
 
+bool ReadPointCloud(const std::string &filename,
+                    geometry::PointCloud &pointcloud,
+                    const geometry::AxisAlignedBoundingBox &bbox,
+                    int level,
+                    bool print_progress) {
+    if (utility::filesystem::GetFileExtensionInLowerCase(filename) == "tpc") {
+        bool success = ReadPointCloudRegionFromTPC(filename, pointcloud, bbox,
+                                                   level, print_progress);
+        utility::LogDebug("Read geometry::PointCloud: {:d} vertices.",
+                          (int)pointcloud.points_.size());
+        return success;
+    }
+    geometry::PointCloud full_pointcloud;
+    if (!ReadPointCloud(filename, full_pointcloud, "auto", true, true,
+                        print_progress)) {
+        return false;
+    }
+    pointcloud = *full_pointcloud.Crop(bbox);
+    return true;
+}
+
 bool WritePointCloud(const std::string &filename,
                      const geometry::PointCloud &pointcloud,
                      bool write_ascii /* = false*/,
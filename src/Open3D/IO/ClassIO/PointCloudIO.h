@@ -26,8 +26,11 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
+#include <vector>
 
+#include "Open3D/Geometry/BoundingVolume.h"
 #include "Open3D/Geometry/PointCloud.h"
 
 namespace open3d {
@@ -50,6 +53,18 @@ bool ReadPointCloud(const std::string &filename,
                     bool remove_infinite_points = true,
                     bool print_progress = false);
 
+/// Reads the part of a PointCloud that lies inside \p bbox.
+/// Tiled point cloud files (.tpc) only decode the tiles intersecting \p bbox,
+/// up to the level of detail \p level (0 is the coarsest level, -1 reads all
+/// points). Other formats are read completely and cropped, \p level is
+/// ignored for them.
+/// \return return true if the read function is successful, false otherwise.
+bool ReadPointCloud(const std::string &filename,
+                    geometry::PointCloud &pointcloud,
+                    const geometry::AxisAlignedBoundingBox &bbox,
+                    int level = -1,
+                    bool print_progress = false);
+
 /// The general entrance for writing a PointCloud to a file
 /// The function calls write functions based on the extension name of filename.
 /// If the write function supports binary encoding and compression, the later
@@ -121,5 +136,97 @@ bool WritePointCloudToPTS(const std::string &filename,
                           bool compressed = false,
                           bool print_progress = false);
 
+/// \struct TiledPointCloudOption
+///
+/// \brief Parameters of the tiled point cloud (.tpc) writer.
+///
+/// The points are split into the leaves of an octree holding at most
+/// max_points_per_tile_ points each. Every tile stores num_levels_ levels of
+/// detail, level l holding about 1 / 4^(num_levels_ - 1 - l) of its points,
+/// with at most 32 levels. Each level of a tile is compressed independently.
+struct TiledPointCloudOption {
+    int max_points_per_tile_ = 65536;
+    int num_levels_ = 4;
+    /// If positive, positions are stored as integer multiples of this step
+    /// relative to their tile, otherwise as float32 offsets to the tile.
+    double quantization_step_ = 0.0;
+};
+
+bool ReadPointCloudFromTPC(const std::string &filename,
+                           geometry::PointCloud &pointcloud,
+                           bool print_progress = false);
+
+/// Reads the points of a .tpc file inside \p bbox, see ReadPointCloud().
+bool ReadPointCloudRegionFromTPC(const std::string &filename,
+                                 geometry::PointCloud &pointcloud,
+                                 const geometry::AxisAlignedBoundingBox &bbox,
+                                 int level = -1,
+                                 bool print_progress = false);
+
+/// Writes a .tpc file with the default TiledPointCloudOption. The format is
+/// always binary and compressed, \p write_ascii and \p compressed are
+/// ignored.
+bool WritePointCloudToTPC(const std::string &filename,
+                          const geometry::PointCloud &pointcloud,
+                          bool write_ascii = false,
+                          bool compressed = false,
+                          bool print_progress = false);
+
+bool WritePointCloudToTPCWithOption(const std::string &filename,
+                                    const geometry::PointCloud &pointcloud,
+                                    const TiledPointCloudOption &option,
+                                    bool print_progress = false);
+
+/// \struct OctreeCompressionOption
+///
+/// \brief Parameters of the octree compressed point cloud (.opc) encoder.
+///
+/// The points are quantized to the leaves of an octree of depth depth_ over
+/// the bounding cube of the cloud, so the coding is lossless at that
+/// resolution. Colors are stored with 8 bits per channel, normals are not
+/// stored.
+struct OctreeCompressionOption {
+    /// Depth of the octree, in [0, 21].
+    int depth_ = 12;
+    /// If true, every point is kept with its own color. Otherwise the points
+    /// of a leaf are merged into one point with their average color.
+    bool keep_duplicates_ = false;
+};
+
+/// Encodes \p pointcloud into an in-memory .opc stream.
+bool EncodePointCloudToOPC(const geometry::PointCloud &pointcloud,
+                           std::vector<std::uint8_t> &buffer,
+                           const OctreeCompressionOption &option =
+                                   OctreeCompressionOption());
+
+/// Decodes an in-memory .opc stream. The points are the centers of the
+/// octree leaves, ordered by leaf.
+bool DecodePointCloudFromOPC(const std::vector<std::uint8_t> &buffer,
+                             geometry::PointCloud &pointcloud);
+
+/// Decodes the .opc stream of \p size bytes at \p buffer, e.g. a memory
+/// mapped file, see DecodePointCloudFromOPC().
+bool DecodePointCloudFromOPC(const std::uint8_t *buffer,
+                             size_t size,
+                             geometry::PointCloud &pointcloud);
+
+bool ReadPointCloudFromOPC(const std::string &filename,
+                           geometry::PointCloud &pointcloud,
+                           bool print_progress = false);
+
+/// Writes a .opc file with the default OctreeCompressionOption. The format is
+/// always binary and compressed, \p write_ascii and \p compressed are
+/// ignored.
+bool WritePointCloudToOPC(const std::string &filename,
+                          const geometry::PointCloud &pointcloud,
+                          bool write_ascii = false,
+                          bool compressed = false,
+                          bool print_progress = false);
+
+bool WritePointCloudToOPCWithOption(const std::string &filename,
+                                    const geometry::PointCloud &pointcloud,
+                                    const OctreeCompressionOption &option,
+                                    bool print_progress = false);
+
 }  // namespace io
 }  // namespace open3d
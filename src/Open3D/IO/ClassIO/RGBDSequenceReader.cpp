@@ -0,0 +1,215 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/IO/ClassIO/RGBDSequenceReader.h"
+
+#include <algorithm>
+#include <cstdio>
+
+#include "Open3D/IO/ClassIO/ImageIO.h"
+#include "Open3D/IO/ClassIO/PinholeCameraTrajectoryIO.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/FileSystem.h"
+#include "Open3D/Utility/Helper.h"
+
+namespace open3d {
+
+namespace {
+
+// Exchanges the pixel buffers of two images without copying them.
+void SwapImageBuffers(geometry::Image &image0, geometry::Image &image1) {
+    std::swap(image0.width_, image1.width_);
+    std::swap(image0.height_, image1.height_);
+    std::swap(image0.num_of_channels_, image1.num_of_channels_);
+    std::swap(image0.bytes_per_channel_, image1.bytes_per_channel_);
+    image0.data_.swap(image1.data_);
+}
+
+}  // unnamed namespace
+
+namespace io {
+
+RGBDSequenceReader::RGBDSequenceReader(int num_threads /* = 2*/,
+                                       int max_buffered_frames /* = 8*/)
+    : num_threads_(std::max(num_threads, 1)),
+      max_buffered_frames_(std::max(max_buffered_frames, 1)) {}
+
+RGBDSequenceReader::~RGBDSequenceReader() { Close(); }
+
+bool RGBDSequenceReader::Open(const std::vector<std::string> &color_filenames,
+                              const std::vector<std::string> &depth_filenames) {
+    Close();
+    if (color_filenames.size() != depth_filenames.size()) {
+        utility::LogWarning(
+                "[RGBDSequenceReader] {:d} color images do not match {:d} "
+                "depth images.",
+                color_filenames.size(), depth_filenames.size());
+        return false;
+    }
+    if (color_filenames.empty()) {
+        utility::LogWarning("[RGBDSequenceReader] Empty image sequence.");
+        return false;
+    }
+    color_filenames_ = color_filenames;
+    depth_filenames_ = depth_filenames;
+    slots_.resize(max_buffered_frames_);
+    int num_threads = std::min(num_threads_, GetNumFrames());
+    for (int i = 0; i < num_threads; i++) {
+        workers_.emplace_back(&RGBDSequenceReader::DecodeFrames, this);
+    }
+    return true;
+}
+
+bool RGBDSequenceReader::Open(const std::vector<std::string> &color_filenames,
+                              const std::vector<std::string> &depth_filenames,
+                              const std::string &trajectory_filename) {
+    Close();
+    camera::PinholeCameraTrajectory trajectory;
+    if (!ReadPinholeCameraTrajectory(trajectory_filename, trajectory)) {
+        return false;
+    }
+    if (trajectory.parameters_.size() < color_filenames.size()) {
+        utility::LogWarning(
+                "[RGBDSequenceReader] Trajectory {} has {:d} poses for {:d} "
+                "frames.",
+                trajectory_filename, trajectory.parameters_.size(),
+                color_filenames.size());
+        return false;
+    }
+    if (!Open(color_filenames, depth_filenames)) {
+        return false;
+    }
+    trajectory_ = trajectory;
+    return true;
+}
+
+bool RGBDSequenceReader::OpenAssociationFile(const std::string &filename) {
+    Close();
+    FILE *file = utility::filesystem::FOpen(filename, "r");
+    if (file == NULL) {
+        utility::LogWarning("Unable to open file {}", filename);
+        return false;
+    }
+    std::string dir_name =
+            utility::filesystem::GetFileParentDirectory(filename);
+    std::vector<std::string> color_filenames;
+    std::vector<std::string> depth_filenames;
+    char buffer[DEFAULT_IO_BUFFER_SIZE];
+    while (fgets(buffer, DEFAULT_IO_BUFFER_SIZE, file)) {
+        std::vector<std::string> st;
+        utility::SplitString(st, buffer, "\t\r\n ");
+        if (st.size() >= 2) {
+            depth_filenames.push_back(dir_name + st[0]);
+            color_filenames.push_back(dir_name + st[1]);
+        }
+    }
+    fclose(file);
+    return Open(color_filenames, depth_filenames);
+}
+
+void RGBDSequenceReader::Close() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    slot_released_.notify_all();
+    for (auto &worker : workers_) {
+        worker.join();
+    }
+    workers_.clear();
+    slots_.clear();
+    color_filenames_.clear();
+    depth_filenames_.clear();
+    trajectory_.parameters_.clear();
+    next_frame_ = 0;
+    next_decode_ = 0;
+    stop_ = false;
+}
+
+bool RGBDSequenceReader::NextFrame(geometry::Image &color,
+                                   geometry::Image &depth) {
+    if (!IsOpened() || IsEOF()) {
+        return false;
+    }
+    int frame_index = next_frame_;
+    bool success;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        FrameSlot &slot = slots_[frame_index % slots_.size()];
+        frame_decoded_.wait(lock, [&slot, frame_index] {
+            return slot.ready_ && slot.frame_index_ == frame_index;
+        });
+        success = slot.success_;
+        // The previous buffers of the caller are recycled for later frames.
+        SwapImageBuffers(slot.color_, color);
+        SwapImageBuffers(slot.depth_, depth);
+        slot.ready_ = false;
+        next_frame_++;
+    }
+    slot_released_.notify_all();
+    if (!success) {
+        utility::LogWarning(
+                "[RGBDSequenceReader] Failed to read frame {:d} ({}, {}).",
+                frame_index, color_filenames_[frame_index],
+                depth_filenames_[frame_index]);
+    }
+    return success;
+}
+
+void RGBDSequenceReader::DecodeFrames() {
+    while (true) {
+        int frame_index;
+        FrameSlot *slot;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            // Frame i is decoded into slot i % max_buffered_frames_, which
+            // is free once frame i - max_buffered_frames_ is handed out.
+            slot_released_.wait(lock, [this] {
+                return stop_ || next_decode_ >= GetNumFrames() ||
+                       next_decode_ < next_frame_ + max_buffered_frames_;
+            });
+            if (stop_ || next_decode_ >= GetNumFrames()) {
+                return;
+            }
+            frame_index = next_decode_++;
+            slot = &slots_[frame_index % slots_.size()];
+        }
+        // The slot is owned by this thread until it is marked ready.
+        bool success =
+                ReadImage(color_filenames_[frame_index], slot->color_) &&
+                ReadImage(depth_filenames_[frame_index], slot->depth_);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            slot->frame_index_ = frame_index;
+            slot->success_ = success;
+            slot->ready_ = true;
+        }
+        frame_decoded_.notify_all();
+    }
+}
+
+}  // namespace io
+}  // namespace open3d
@@ -0,0 +1,131 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Open3D/Camera/PinholeCameraTrajectory.h"
+#include "Open3D/Geometry/Image.h"
+
+namespace open3d {
+namespace io {
+
+/// \class RGBDSequenceReader
+///
+/// Reads a sequence of color and depth image files on background threads.
+/// Frames are decoded ahead of time into a bounded ring of image buffers and
+/// are handed out in order by NextFrame(), so that image decoding overlaps
+/// with the processing of the previous frames.
+class RGBDSequenceReader {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param num_threads Number of decoding threads.
+    /// \param max_buffered_frames Maximum number of frames decoded ahead of
+    /// the last frame returned by NextFrame().
+    RGBDSequenceReader(int num_threads = 2, int max_buffered_frames = 8);
+    RGBDSequenceReader(const RGBDSequenceReader &) = delete;
+    RGBDSequenceReader &operator=(const RGBDSequenceReader &) = delete;
+    ~RGBDSequenceReader();
+
+    /// Check if a sequence is opened.
+    bool IsOpened() const { return !workers_.empty(); }
+    /// Check if all the frames of the sequence are read.
+    bool IsEOF() const { return next_frame_ >= GetNumFrames(); }
+
+    /// \brief Open a sequence of color and depth image files and start
+    /// decoding.
+    ///
+    /// \param color_filenames Paths to the color images.
+    /// \param depth_filenames Paths to the depth images, one per color image.
+    bool Open(const std::vector<std::string> &color_filenames,
+              const std::vector<std::string> &depth_filenames);
+    /// \brief Open a sequence of color and depth image files along with the
+    /// camera trajectory of the sequence (log, tum or json file).
+    bool Open(const std::vector<std::string> &color_filenames,
+              const std::vector<std::string> &depth_filenames,
+              const std::string &trajectory_filename);
+    /// \brief Open a sequence from an association file, in which every line
+    /// holds the depth and the color image paths relative to the file.
+    bool OpenAssociationFile(const std::string &filename);
+    /// Stop decoding and close the sequence.
+    void Close();
+
+    /// \brief Get the next frame of the sequence.
+    ///
+    /// Blocks until the frame is decoded. The buffers of \p color and \p depth
+    /// are recycled for decoding the following frames.
+    /// \return If the frame is read successfully.
+    bool NextFrame(geometry::Image &color, geometry::Image &depth);
+
+    /// Number of frames in the sequence.
+    int GetNumFrames() const { return (int)color_filenames_.size(); }
+    /// Index of the frame returned by the next call to NextFrame().
+    int GetFrameIndex() const { return next_frame_; }
+    /// Check if a camera trajectory is loaded with the sequence.
+    bool HasTrajectory() const { return !trajectory_.parameters_.empty(); }
+    /// Camera trajectory of the sequence.
+    const camera::PinholeCameraTrajectory &GetTrajectory() const {
+        return trajectory_;
+    }
+
+private:
+    struct FrameSlot {
+        geometry::Image color_;
+        geometry::Image depth_;
+        int frame_index_ = -1;
+        bool ready_ = false;
+        bool success_ = false;
+    };
+
+    void DecodeFrames();
+
+private:
+    int num_threads_;
+    int max_buffered_frames_;
+    std::vector<std::string> color_filenames_;
+    std::vector<std::string> depth_filenames_;
+    camera::PinholeCameraTrajectory trajectory_;
+
+    std::vector<FrameSlot> slots_;
+    std::vector<std::thread> workers_;
+    std::mutex mutex_;
+    std::condition_variable frame_decoded_;
+    std::condition_variable slot_released_;
+    /// Next frame to be handed out by NextFrame().
+    int next_frame_ = 0;
+    /// Next frame to be claimed by a decoding thread.
+    int next_decode_ = 0;
+    bool stop_ = false;
+};
+
+}  // namespace io
+}  // namespace open3d
@@ -172,14 +172,20 @@ bool IsPointInsidePolygon(const Eigen::MatrixX2d &polygon, double x, double y) {
 
 bool AddTrianglesByEarClipping(geometry::TriangleMesh &mesh,
                                std::vector<unsigned int> &indices) {
+    return AddTrianglesByEarClipping(mesh.vertices_, indices, mesh.triangles_);
+}
+
+bool AddTrianglesByEarClipping(const std::vector<Eigen::Vector3d> &vertices,
+                               std::vector<unsigned int> &indices,
+                               std::vector<Eigen::Vector3i> &triangles) {
     int n = int(indices.size());
     Eigen::Vector3d face_normal = Eigen::Vector3d::Zero();
     if (n > 3) {
         for (int i = 0; i < n; i++) {
-            const Eigen::Vector3d &v1 = mesh.vertices_[indices[(i + 1) % n]] -
-                                        mesh.vertices_[indices[i % n]];
-            const Eigen::Vector3d &v2 = mesh.vertices_[indices[(i + 2) % n]] -
-                                        mesh.vertices_[indices[(i + 1) % n]];
+            const Eigen::Vector3d &v1 = vertices[indices[(i + 1) % n]] -
+                                        vertices[indices[i % n]];
+            const Eigen::Vector3d &v2 = vertices[indices[(i + 2) % n]] -
+                                        vertices[indices[(i + 1) % n]];
             face_normal += v1.cross(v2);
         }
         double l = std::sqrt(face_normal.dot(face_normal));
@@ -197,9 +203,9 @@ bool AddTrianglesByEarClipping(geometry::TriangleMesh &mesh,
         found_ear = false;
         for (int i = 1; i < n - 2; i++) {
             const Eigen::Vector3d &v1 =
-                    mesh.vertices_[indices[i]] - mesh.vertices_[indices[i - 1]];
+                    vertices[indices[i]] - vertices[indices[i - 1]];
             const Eigen::Vector3d &v2 =
-                    mesh.vertices_[indices[i + 1]] - mesh.vertices_[indices[i]];
+                    vertices[indices[i + 1]] - vertices[indices[i]];
             bool is_convex = (face_normal.dot(v1.cross(v2)) > 0.0);
             bool is_ear = true;
             if (is_convex) {
@@ -207,15 +213,15 @@ bool AddTrianglesByEarClipping(geometry::TriangleMesh &mesh,
                 // (no vertices within triangle v[i-1], v[i], v[i+1])
                 Eigen::MatrixX2d polygon(3, 2);
                 for (int j = 0; j < 3; j++) {
-                    polygon(j, 0) = mesh.vertices_[indices[i + j - 1]](0);
-                    polygon(j, 1) = mesh.vertices_[indices[i + j - 1]](1);
+                    polygon(j, 0) = vertices[indices[i + j - 1]](0);
+                    polygon(j, 1) = vertices[indices[i + j - 1]](1);
                 }
 
                 for (int j = 0; j < n; j++) {
                     if (j == i - 1 || j == i || j == i + 1) {
                         continue;
                     }
-                    const Eigen::Vector3d &v = mesh.vertices_[indices[j]];
+                    const Eigen::Vector3d &v = vertices[indices[j]];
                     if (IsPointInsidePolygon(polygon, v(0), v(1))) {
                         is_ear = false;
                         break;
@@ -224,7 +230,7 @@ bool AddTrianglesByEarClipping(geometry::TriangleMesh &mesh,
 
                 if (is_ear) {
                     found_ear = true;
-                    mesh.triangles_.push_back(Eigen::Vector3i(
+                    triangles.push_back(Eigen::Vector3i(
                             indices[i - 1], indices[i], indices[i + 1]));
                     indices.erase(indices.begin() + i);
                     n = int(indices.size());
@@ -233,8 +239,7 @@ bool AddTrianglesByEarClipping(geometry::TriangleMesh &mesh,
             }
         }
     }
-    mesh.triangles_.push_back(
-            Eigen::Vector3i(indices[0], indices[1], indices[2]));
+    triangles.push_back(Eigen::Vector3i(indices[0], indices[1], indices[2]));
 
     return true;
 }
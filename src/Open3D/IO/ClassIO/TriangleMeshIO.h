@@ -136,5 +136,12 @@ bool WriteTriangleMeshToGLTF(const std::string &filename,
 bool AddTrianglesByEarClipping(geometry::TriangleMesh &mesh,
                                std::vector<unsigned int> &indices);
 
+/// Same as above, but reads the vertices from \p vertices and appends the
+/// triangles to \p triangles, so that polygons can be triangulated in
+/// parallel.
+bool AddTrianglesByEarClipping(const std::vector<Eigen::Vector3d> &vertices,
+                               std::vector<unsigned int> &indices,
+                               std::vector<Eigen::Vector3i> &triangles);
+
 }  // namespace io
 }  // namespace open3d
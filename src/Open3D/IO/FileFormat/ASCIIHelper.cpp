@@ -0,0 +1,232 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/IO/FileFormat/ASCIIHelper.h"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <locale>
+#include <sstream>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace open3d {
+
+namespace {
+
+inline bool IsBlank(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+inline bool IsDigit(char c) { return c >= '0' && c <= '9'; }
+
+inline bool MatchesCaseInsensitive(const char *p,
+                                   const char *end,
+                                   const char *word) {
+    for (; *word != '\0'; p++, word++) {
+        if (p >= end || (*p | 0x20) != *word) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Slow path for numbers that cannot be converted exactly with one double
+/// operation, the classic locale keeps '.' as the decimal separator.
+bool ParseDoubleWithStream(const char *begin,
+                           const char *end,
+                           double &value) {
+    std::istringstream stream(std::string(begin, end));
+    stream.imbue(std::locale::classic());
+    stream >> value;
+    if (stream.fail()) {
+        // Out of range numbers are parsed as by strtod.
+        if (std::abs(value) == std::numeric_limits<double>::max()) {
+            value = std::copysign(std::numeric_limits<double>::infinity(),
+                                  value);
+        } else if (value != 0.0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // unnamed namespace
+
+namespace io {
+
+const char *ParseASCIIDouble(const char *p, const char *end, double &value) {
+    while (p < end && IsBlank(*p)) {
+        p++;
+    }
+    const char *begin = p;
+    bool is_negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        is_negative = (*p == '-');
+        p++;
+    }
+
+    if (p < end && !IsDigit(*p) && *p != '.') {
+        // Special values, as accepted by strtod.
+        double special;
+        if (MatchesCaseInsensitive(p, end, "infinity")) {
+            special = std::numeric_limits<double>::infinity();
+            p += 8;
+        } else if (MatchesCaseInsensitive(p, end, "inf")) {
+            special = std::numeric_limits<double>::infinity();
+            p += 3;
+        } else if (MatchesCaseInsensitive(p, end, "nan")) {
+            special = std::numeric_limits<double>::quiet_NaN();
+            p += 3;
+        } else {
+            return nullptr;
+        }
+        value = is_negative ? -special : special;
+        return p;
+    }
+
+    // Up to 19 significant digits fit into the mantissa.
+    uint64_t mantissa = 0;
+    int num_digits = 0;
+    int exponent = 0;
+    bool has_digits = false;
+    bool is_exact = true;
+    for (; p < end && IsDigit(*p); p++) {
+        has_digits = true;
+        if (num_digits < 19) {
+            mantissa = mantissa * 10 + (*p - '0');
+            num_digits += (mantissa != 0);
+        } else {
+            exponent++;
+            is_exact = false;
+        }
+    }
+    if (p < end && *p == '.') {
+        p++;
+        for (; p < end && IsDigit(*p); p++) {
+            has_digits = true;
+            if (num_digits < 19) {
+                mantissa = mantissa * 10 + (*p - '0');
+                num_digits += (mantissa != 0);
+                exponent--;
+            } else {
+                is_exact = false;
+            }
+        }
+    }
+    if (!has_digits) {
+        return nullptr;
+    }
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        const char *q = p + 1;
+        bool is_exponent_negative = false;
+        if (q < end && (*q == '-' || *q == '+')) {
+            is_exponent_negative = (*q == '-');
+            q++;
+        }
+        if (q < end && IsDigit(*q)) {
+            int exponent_value = 0;
+            for (; q < end && IsDigit(*q); q++) {
+                if (exponent_value < 100000) {
+                    exponent_value = exponent_value * 10 + (*q - '0');
+                }
+            }
+            exponent += is_exponent_negative ? -exponent_value
+                                             : exponent_value;
+            p = q;
+        }
+    }
+
+    // Mantissas up to 2^53 and powers of ten up to 1e22 are exact doubles,
+    // so a single multiplication or division is correctly rounded.
+    static const double kPowersOfTen[] = {
+            1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+            1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+            1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+    if (is_exact && mantissa <= (uint64_t(1) << 53) && exponent >= -22 &&
+        exponent <= 22) {
+        double result = (double)mantissa;
+        if (exponent < 0) {
+            result /= kPowersOfTen[-exponent];
+        } else {
+            result *= kPowersOfTen[exponent];
+        }
+        value = is_negative ? -result : result;
+    } else if (mantissa == 0 && is_exact) {
+        value = is_negative ? -0.0 : 0.0;
+    } else if (!ParseDoubleWithStream(begin, p, value)) {
+        return nullptr;
+    }
+    return p;
+}
+
+std::vector<ASCIIChunk> SplitASCIIChunks(const char *data, size_t size) {
+    int num_threads = 1;
+#ifdef _OPENMP
+    num_threads = omp_get_max_threads();
+#endif
+    // Several chunks per thread for load balancing, but not too small.
+    const size_t min_chunk_size = 1 << 20;
+    size_t num_chunks = std::max(
+            size_t(1),
+            std::min(size_t(num_threads) * 8, size / min_chunk_size));
+    const size_t chunk_size = size / num_chunks;
+
+    std::vector<ASCIIChunk> chunks;
+    const char *begin = data;
+    const char *data_end = data + size;
+    for (size_t c = 0; c < num_chunks && begin < data_end; c++) {
+        const char *end = data_end;
+        if (c + 1 < num_chunks && begin + chunk_size < data_end) {
+            end = static_cast<const char *>(std::memchr(
+                    begin + chunk_size, '\n', data_end - begin - chunk_size));
+            end = (end == nullptr) ? data_end : end + 1;
+        }
+        chunks.push_back(ASCIIChunk{begin, end, 0, 0});
+        begin = end;
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int c = 0; c < (int)chunks.size(); c++) {
+        size_t num_lines = 0;
+        ForEachASCIILine(chunks[c],
+                         [&](const char *, const char *) { num_lines++; });
+        chunks[c].num_lines_ = num_lines;
+    }
+    for (size_t c = 1; c < chunks.size(); c++) {
+        chunks[c].line_offset_ =
+                chunks[c - 1].line_offset_ + chunks[c - 1].num_lines_;
+    }
+    return chunks;
+}
+
+}  // namespace io
+}  // namespace open3d
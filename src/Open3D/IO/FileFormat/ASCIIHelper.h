@@ -0,0 +1,194 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace io {
+
+/// \brief Parses a floating point number independently of the locale.
+///
+/// Blanks before the number are skipped, the number itself has the syntax
+/// accepted by strtod in the "C" locale (without hexadecimal numbers).
+/// \param p Start of the text.
+/// \param end End of the text.
+/// \param value The parsed number.
+/// \return The position after the number, or nullptr if there is no number.
+const char *ParseASCIIDouble(const char *p, const char *end, double &value);
+
+/// Parses \p count numbers separated by blanks starting at \p p, and advances
+/// \p p past them. Returns false if there are fewer than \p count numbers.
+inline bool ParseASCIIDoubles(const char *&p,
+                              const char *end,
+                              double *values,
+                              int count) {
+    for (int i = 0; i < count; i++) {
+        p = ParseASCIIDouble(p, end, values[i]);
+        if (p == nullptr) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Part of a text buffer that starts and ends at a line boundary.
+struct ASCIIChunk {
+    const char *begin_;
+    const char *end_;
+    /// Index of the first line of the chunk in the whole text.
+    size_t line_offset_;
+    size_t num_lines_;
+};
+
+/// Splits a text buffer into chunks for parallel parsing and counts the
+/// lines of each chunk in parallel.
+std::vector<ASCIIChunk> SplitASCIIChunks(const char *data, size_t size);
+
+/// Returns the total number of lines of \p chunks.
+inline size_t CountASCIILines(const std::vector<ASCIIChunk> &chunks) {
+    if (chunks.empty()) {
+        return 0;
+    }
+    return chunks.back().line_offset_ + chunks.back().num_lines_;
+}
+
+/// Calls f(line_begin, line_end) for every line of \p chunk. The line end
+/// excludes the '\n'.
+template <typename F>
+void ForEachASCIILine(const ASCIIChunk &chunk, F f) {
+    const char *p = chunk.begin_;
+    while (p < chunk.end_) {
+        const char *line_end = static_cast<const char *>(
+                std::memchr(p, '\n', chunk.end_ - p));
+        if (line_end == nullptr) {
+            line_end = chunk.end_;
+        }
+        f(p, line_end);
+        p = line_end + 1;
+    }
+}
+
+/// \brief Parses the lines of all chunks in parallel.
+///
+/// The output must be sized for the total number of lines of the chunks.
+/// parse_line(line_begin, line_end, index) stores the content of a line at
+/// \p index and returns false if the line is skipped. The stored lines are
+/// made contiguous with move_line(from, to) afterwards.
+/// \param progress_bar Optional progress bar, advanced once per chunk.
+/// \return The number of stored lines.
+template <typename ParseLine, typename MoveLine>
+size_t ParseASCIILines(const std::vector<ASCIIChunk> &chunks,
+                       ParseLine parse_line,
+                       MoveLine move_line,
+                       utility::ConsoleProgressBar *progress_bar = nullptr) {
+    std::vector<size_t> num_parsed(chunks.size(), 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int c = 0; c < (int)chunks.size(); c++) {
+        size_t index = chunks[c].line_offset_;
+        ForEachASCIILine(chunks[c], [&](const char *begin, const char *end) {
+            if (parse_line(begin, end, index)) {
+                index++;
+            }
+        });
+        num_parsed[c] = index - chunks[c].line_offset_;
+        if (progress_bar != nullptr) {
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+            ++(*progress_bar);
+        }
+    }
+    size_t num_lines = 0;
+    for (size_t c = 0; c < chunks.size(); c++) {
+        if (num_lines != chunks[c].line_offset_) {
+            for (size_t i = 0; i < num_parsed[c]; i++) {
+                move_line(chunks[c].line_offset_ + i, num_lines + i);
+            }
+        }
+        num_lines += num_parsed[c];
+    }
+    return num_lines;
+}
+
+/// Number of lines that WriteASCIILines() formats into one buffer.
+inline size_t GetNumASCIILinesPerBlock() { return 1 << 14; }
+
+/// \brief Formats lines in parallel and writes them to \p file in order.
+///
+/// format_line(index, buffer) appends line \p index to the std::string
+/// \p buffer. Blocks of lines are formatted in parallel into separate buffers
+/// that are written with one fwrite each.
+/// \param progress_bar Optional progress bar, advanced once per block of
+/// GetNumASCIILinesPerBlock() lines.
+/// \return false if writing fails.
+template <typename FormatLine>
+bool WriteASCIILines(FILE *file,
+                     size_t num_lines,
+                     FormatLine format_line,
+                     utility::ConsoleProgressBar *progress_bar = nullptr) {
+    const size_t block_size = GetNumASCIILinesPerBlock();
+    const size_t num_blocks = (num_lines + block_size - 1) / block_size;
+    const size_t blocks_per_batch = 64;
+    std::vector<std::string> buffers(blocks_per_batch);
+    for (size_t batch = 0; batch < num_blocks; batch += blocks_per_batch) {
+        const int num_batch_blocks =
+                (int)std::min(blocks_per_batch, num_blocks - batch);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+        for (int b = 0; b < num_batch_blocks; b++) {
+            const size_t begin = (batch + b) * block_size;
+            const size_t end = std::min(begin + block_size, num_lines);
+            buffers[b].clear();
+            for (size_t i = begin; i < end; i++) {
+                format_line(i, buffers[b]);
+            }
+        }
+        for (int b = 0; b < num_batch_blocks; b++) {
+            if (fwrite(buffers[b].data(), 1, buffers[b].size(), file) !=
+                buffers[b].size()) {
+                return false;
+            }
+            if (progress_bar != nullptr) {
+                ++(*progress_bar);
+            }
+        }
+    }
+    return true;
+}
+
+}  // namespace io
+}  // namespace open3d
@@ -24,18 +24,180 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <cstdio>
+#include <cstring>
 #include <memory>
+#include <vector>
 
 #include "Open3D/IO/ClassIO/FeatureIO.h"
+#include "Open3D/IO/ClassIO/PinholeCameraTrajectoryIO.h"
+#include "Open3D/IO/ClassIO/PoseGraphIO.h"
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/FileSystem.h"
 
+// The BIN files start with a header holding a magic string, the format
+// version and the type of the serialized object, followed by the object in
+// fixed-size little-endian records. Feature files written before the header
+// was introduced hold the matrix only and are still readable.
+
 namespace open3d {
 
 namespace {
 using namespace io;
 
+const char kBINMagic[6] = {'O', '3', 'D', 'B', 'I', 'N'};
+const uint16_t kBINVersion = 1;
+
+enum class BINObjectType : uint32_t {
+    Feature = 0,
+    PoseGraph = 1,
+    PinholeCameraTrajectory = 2,
+};
+
+// Records are read and written in blocks to limit the number of calls to
+// fread and fwrite.
+const size_t kBINRecordsPerBlock = 4096;
+
+const size_t kBINPoseGraphNodeSize = 16 * sizeof(double);
+const size_t kBINPoseGraphEdgeSize = 2 * sizeof(int32_t) + sizeof(uint8_t) +
+                                     (1 + 16 + 36) * sizeof(double);
+const size_t kBINCameraParametersSize =
+        2 * sizeof(int32_t) + (9 + 16) * sizeof(double);
+
+bool WriteBINHeader(FILE *file, BINObjectType type) {
+    uint32_t type_value = (uint32_t)type;
+    if (fwrite(kBINMagic, sizeof(kBINMagic), 1, file) < 1 ||
+        fwrite(&kBINVersion, sizeof(uint16_t), 1, file) < 1 ||
+        fwrite(&type_value, sizeof(uint32_t), 1, file) < 1) {
+        utility::LogWarning("Write BIN failed: unexpected error.");
+        return false;
+    }
+    return true;
+}
+
+/// Checks the header of the file. If \p allow_legacy is true, a file without
+/// header is rewound and accepted.
+bool ReadBINHeader(FILE *file, BINObjectType type, bool allow_legacy) {
+    char magic[sizeof(kBINMagic)];
+    if (fread(magic, sizeof(magic), 1, file) < 1 ||
+        memcmp(magic, kBINMagic, sizeof(kBINMagic)) != 0) {
+        if (allow_legacy) {
+            rewind(file);
+            return true;
+        }
+        utility::LogWarning("Read BIN failed: missing header.");
+        return false;
+    }
+    uint16_t version;
+    uint32_t type_value;
+    if (fread(&version, sizeof(uint16_t), 1, file) < 1 ||
+        fread(&type_value, sizeof(uint32_t), 1, file) < 1) {
+        utility::LogWarning("Read BIN failed: unexpected EOF.");
+        return false;
+    }
+    if (version > kBINVersion) {
+        utility::LogWarning("Read BIN failed: unsupported version {:d}.",
+                            version);
+        return false;
+    }
+    if (type_value != (uint32_t)type) {
+        utility::LogWarning("Read BIN failed: the file holds another type.");
+        return false;
+    }
+    return true;
+}
+
+template <typename T>
+const char *ReadBINValue(const char *ptr, T &value) {
+    memcpy(&value, ptr, sizeof(T));
+    return ptr + sizeof(T);
+}
+
+template <typename T>
+char *WriteBINValue(char *ptr, const T &value) {
+    memcpy(ptr, &value, sizeof(T));
+    return ptr + sizeof(T);
+}
+
+template <typename Derived>
+const char *ReadBINMatrix(const char *ptr, Eigen::MatrixBase<Derived> &mat) {
+    memcpy(mat.derived().data(), ptr, mat.size() * sizeof(double));
+    return ptr + mat.size() * sizeof(double);
+}
+
+template <typename Derived>
+char *WriteBINMatrix(char *ptr, const Eigen::MatrixBase<Derived> &mat) {
+    memcpy(ptr, mat.derived().data(), mat.size() * sizeof(double));
+    return ptr + mat.size() * sizeof(double);
+}
+
+/// Reads the number of records followed by the records of \p record_size
+/// bytes into \p records. Each record is decoded by \p func.
+template <typename T, typename Func>
+bool ReadBINRecords(FILE *file,
+                    size_t record_size,
+                    std::vector<T> &records,
+                    Func func) {
+    uint64_t num_records;
+    if (fread(&num_records, sizeof(uint64_t), 1, file) < 1) {
+        utility::LogWarning("Read BIN failed: unexpected EOF.");
+        return false;
+    }
+    // Reject corrupted counts before allocating memory for them.
+    long position = ftell(file);
+    fseek(file, 0, SEEK_END);
+    long end = ftell(file);
+    fseek(file, position, SEEK_SET);
+    if (num_records > uint64_t(end - position) / record_size) {
+        utility::LogWarning("Read BIN failed: unexpected EOF.");
+        return false;
+    }
+    records.resize((size_t)num_records);
+    std::vector<char> buffer(std::min(records.size(), kBINRecordsPerBlock) *
+                             record_size);
+    for (size_t begin = 0; begin < records.size();
+         begin += kBINRecordsPerBlock) {
+        size_t count = std::min(kBINRecordsPerBlock, records.size() - begin);
+        if (fread(buffer.data(), record_size, count, file) < count) {
+            utility::LogWarning("Read BIN failed: unexpected EOF.");
+            return false;
+        }
+        for (size_t i = 0; i < count; i++) {
+            func(buffer.data() + i * record_size, records[begin + i]);
+        }
+    }
+    return true;
+}
+
+/// Writes the number of records followed by the records of \p record_size
+/// bytes, each of them encoded by \p func.
+template <typename T, typename Func>
+bool WriteBINRecords(FILE *file,
+                     size_t record_size,
+                     const std::vector<T> &records,
+                     Func func) {
+    uint64_t num_records = (uint64_t)records.size();
+    if (fwrite(&num_records, sizeof(uint64_t), 1, file) < 1) {
+        utility::LogWarning("Write BIN failed: unexpected error.");
+        return false;
+    }
+    std::vector<char> buffer(std::min(records.size(), kBINRecordsPerBlock) *
+                             record_size);
+    for (size_t begin = 0; begin < records.size();
+         begin += kBINRecordsPerBlock) {
+        size_t count = std::min(kBINRecordsPerBlock, records.size() - begin);
+        for (size_t i = 0; i < count; i++) {
+            func(buffer.data() + i * record_size, records[begin + i]);
+        }
+        if (fwrite(buffer.data(), record_size, count, file) < count) {
+            utility::LogWarning("Write BIN failed: unexpected error.");
+            return false;
+        }
+    }
+    return true;
+}
+
 bool ReadMatrixXdFromBINFile(FILE *file, Eigen::MatrixXd &mat) {
     uint32_t rows, cols;
     if (fread(&rows, sizeof(uint32_t), 1, file) < 1) {
@@ -84,7 +246,8 @@ bool ReadFeatureFromBIN(const std::string &filename,
                             filename);
         return false;
     }
-    bool success = ReadMatrixXdFromBINFile(fid, feature.data_);
+    bool success = ReadBINHeader(fid, BINObjectType::Feature, true) &&
+                   ReadMatrixXdFromBINFile(fid, feature.data_);
     fclose(fid);
     return success;
 }
@@ -97,7 +260,131 @@ bool WriteFeatureToBIN(const std::string &filename,
                             filename);
         return false;
     }
-    bool success = WriteMatrixXdToBINFile(fid, feature.data_);
+    bool success = WriteBINHeader(fid, BINObjectType::Feature) &&
+                   WriteMatrixXdToBINFile(fid, feature.data_);
+    fclose(fid);
+    return success;
+}
+
+bool ReadPoseGraphFromBIN(const std::string &filename,
+                          registration::PoseGraph &pose_graph) {
+    FILE *fid = utility::filesystem::FOpen(filename, "rb");
+    if (fid == NULL) {
+        utility::LogWarning("Read BIN failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    bool success =
+            ReadBINHeader(fid, BINObjectType::PoseGraph, false) &&
+            ReadBINRecords(fid, kBINPoseGraphNodeSize, pose_graph.nodes_,
+                           [](const char *ptr,
+                              registration::PoseGraphNode &node) {
+                               ReadBINMatrix(ptr, node.pose_);
+                           }) &&
+            ReadBINRecords(fid, kBINPoseGraphEdgeSize, pose_graph.edges_,
+                           [](const char *ptr,
+                              registration::PoseGraphEdge &edge) {
+                               int32_t source, target;
+                               uint8_t uncertain;
+                               ptr = ReadBINValue(ptr, source);
+                               ptr = ReadBINValue(ptr, target);
+                               ptr = ReadBINValue(ptr, uncertain);
+                               ptr = ReadBINValue(ptr, edge.confidence_);
+                               ptr = ReadBINMatrix(ptr, edge.transformation_);
+                               ReadBINMatrix(ptr, edge.information_);
+                               edge.source_node_id_ = source;
+                               edge.target_node_id_ = target;
+                               edge.uncertain_ = uncertain != 0;
+                           });
+    fclose(fid);
+    return success;
+}
+
+bool WritePoseGraphToBIN(const std::string &filename,
+                         const registration::PoseGraph &pose_graph) {
+    FILE *fid = utility::filesystem::FOpen(filename, "wb");
+    if (fid == NULL) {
+        utility::LogWarning("Write BIN failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    bool success =
+            WriteBINHeader(fid, BINObjectType::PoseGraph) &&
+            WriteBINRecords(fid, kBINPoseGraphNodeSize, pose_graph.nodes_,
+                            [](char *ptr,
+                               const registration::PoseGraphNode &node) {
+                                WriteBINMatrix(ptr, node.pose_);
+                            }) &&
+            WriteBINRecords(fid, kBINPoseGraphEdgeSize, pose_graph.edges_,
+                            [](char *ptr,
+                               const registration::PoseGraphEdge &edge) {
+                                ptr = WriteBINValue(
+                                        ptr, (int32_t)edge.source_node_id_);
+                                ptr = WriteBINValue(
+                                        ptr, (int32_t)edge.target_node_id_);
+                                ptr = WriteBINValue(ptr,
+                                                    (uint8_t)edge.uncertain_);
+                                ptr = WriteBINValue(ptr, edge.confidence_);
+                                ptr = WriteBINMatrix(ptr,
+                                                     edge.transformation_);
+                                WriteBINMatrix(ptr, edge.information_);
+                            });
+    fclose(fid);
+    return success;
+}
+
+bool ReadPinholeCameraTrajectoryFromBIN(
+        const std::string &filename,
+        camera::PinholeCameraTrajectory &trajectory) {
+    FILE *fid = utility::filesystem::FOpen(filename, "rb");
+    if (fid == NULL) {
+        utility::LogWarning("Read BIN failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    bool success =
+            ReadBINHeader(fid, BINObjectType::PinholeCameraTrajectory,
+                          false) &&
+            ReadBINRecords(
+                    fid, kBINCameraParametersSize, trajectory.parameters_,
+                    [](const char *ptr,
+                       camera::PinholeCameraParameters &parameters) {
+                        int32_t width, height;
+                        ptr = ReadBINValue(ptr, width);
+                        ptr = ReadBINValue(ptr, height);
+                        ptr = ReadBINMatrix(
+                                ptr, parameters.intrinsic_.intrinsic_matrix_);
+                        ReadBINMatrix(ptr, parameters.extrinsic_);
+                        parameters.intrinsic_.width_ = width;
+                        parameters.intrinsic_.height_ = height;
+                    });
+    fclose(fid);
+    return success;
+}
+
+bool WritePinholeCameraTrajectoryToBIN(
+        const std::string &filename,
+        const camera::PinholeCameraTrajectory &trajectory) {
+    FILE *fid = utility::filesystem::FOpen(filename, "wb");
+    if (fid == NULL) {
+        utility::LogWarning("Write BIN failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    bool success =
+            WriteBINHeader(fid, BINObjectType::PinholeCameraTrajectory) &&
+            WriteBINRecords(
+                    fid, kBINCameraParametersSize, trajectory.parameters_,
+                    [](char *ptr,
+                       const camera::PinholeCameraParameters &parameters) {
+                        ptr = WriteBINValue(
+                                ptr, (int32_t)parameters.intrinsic_.width_);
+                        ptr = WriteBINValue(
+                                ptr, (int32_t)parameters.intrinsic_.height_);
+                        ptr = WriteBINMatrix(
+                                ptr, parameters.intrinsic_.intrinsic_matrix_);
+                        WriteBINMatrix(ptr, parameters.extrinsic_);
+                    });
     fclose(fid);
     return success;
 }
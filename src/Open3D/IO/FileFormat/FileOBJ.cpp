@@ -24,131 +24,618 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <fstream>
+#include <map>
 #include <numeric>
+#include <set>
 #include <vector>
 
 #include "Open3D/IO/ClassIO/FileFormatIO.h"
 #include "Open3D/IO/ClassIO/ImageIO.h"
 #include "Open3D/IO/ClassIO/TriangleMeshIO.h"
+#include "Open3D/IO/FileFormat/ASCIIHelper.h"
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/FileSystem.h"
+#include "Open3D/Utility/Helper.h"
+#include "Open3D/Utility/MappedFile.h"
 
 #define TINYOBJLOADER_IMPLEMENTATION
 #include "tinyobjloader/tiny_obj_loader.h"
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 namespace open3d {
-namespace io {
 
-FileGeometry ReadFileGeometryTypeOBJ(const std::string& path) {
-    return FileGeometry(CONTAINS_TRIANGLES | CONTAINS_POINTS);
+namespace {
+using namespace io;
+
+namespace obj_reader {
+
+/// Indices of a face corner. Absent indices are -1.
+struct OBJCorner {
+    int vertex_;
+    int texcoord_;
+    int normal_;
+};
+
+/// A chunk of lines of the file along with the number of elements it defines
+/// and their offsets in the whole file.
+struct OBJChunk {
+    ASCIIChunk lines_;
+    size_t num_vertices_ = 0;
+    size_t num_texcoords_ = 0;
+    size_t num_normals_ = 0;
+    size_t num_triangles_ = 0;
+    size_t vertex_offset_ = 0;
+    size_t texcoord_offset_ = 0;
+    size_t normal_offset_ = 0;
+    size_t triangle_offset_ = 0;
+    /// Material of the last usemtl statement of the chunk.
+    bool has_material_ = false;
+    std::string last_material_;
+    /// Material in effect at the start of the chunk.
+    int material_id_ = -1;
+    std::vector<std::string> material_libraries_;
+    std::string unknown_material_;
+    bool success_ = true;
+};
+
+enum class OBJLineType {
+    Vertex,
+    Texcoord,
+    Normal,
+    Face,
+    UseMaterial,
+    MaterialLibrary,
+    Other,
+};
+
+inline bool IsOBJBlank(char c) { return c == ' ' || c == '\t' || c == '\r'; }
+
+inline const char* SkipOBJBlanks(const char* p, const char* end) {
+    while (p < end && IsOBJBlank(*p)) {
+        p++;
+    }
+    return p;
 }
 
-bool ReadTriangleMeshFromOBJ(const std::string& filename,
-                             geometry::TriangleMesh& mesh,
-                             bool print_progress) {
-    tinyobj::attrib_t attrib;
-    std::vector<tinyobj::shape_t> shapes;
-    std::vector<tinyobj::material_t> materials;
-    std::string warn;
-    std::string err;
+/// Returns the type of the line and advances \p p past its keyword.
+OBJLineType ParseOBJKeyword(const char*& p, const char* end) {
+    p = SkipOBJBlanks(p, end);
+    const char* keyword = p;
+    while (p < end && !IsOBJBlank(*p)) {
+        p++;
+    }
+    size_t length = p - keyword;
+    if (length == 1 && keyword[0] == 'v') {
+        return OBJLineType::Vertex;
+    } else if (length == 1 && keyword[0] == 'f') {
+        return OBJLineType::Face;
+    } else if (length == 2 && keyword[0] == 'v' && keyword[1] == 't') {
+        return OBJLineType::Texcoord;
+    } else if (length == 2 && keyword[0] == 'v' && keyword[1] == 'n') {
+        return OBJLineType::Normal;
+    } else if (length == 6 && strncmp(keyword, "usemtl", 6) == 0) {
+        return OBJLineType::UseMaterial;
+    } else if (length == 6 && strncmp(keyword, "mtllib", 6) == 0) {
+        return OBJLineType::MaterialLibrary;
+    }
+    return OBJLineType::Other;
+}
 
-    std::string mtl_base_path =
-            utility::filesystem::GetFileParentDirectory(filename);
-    bool ret = tinyobj::LoadObj(&attrib, &shapes, &materials, &warn, &err,
-                                filename.c_str(), mtl_base_path.c_str());
-    if (!warn.empty()) {
-        utility::LogWarning("Read OBJ failed: {}", warn);
+/// Returns the rest of the line without leading and trailing blanks.
+std::string ParseOBJName(const char* p, const char* end) {
+    p = SkipOBJBlanks(p, end);
+    while (end > p && IsOBJBlank(end[-1])) {
+        end--;
     }
-    if (!err.empty()) {
-        utility::LogWarning("Read OBJ failed: {}", err);
+    return std::string(p, end);
+}
+
+int CountOBJFaceCorners(const char* p, const char* end) {
+    int num_corners = 0;
+    while ((p = SkipOBJBlanks(p, end)) < end) {
+        num_corners++;
+        while (p < end && !IsOBJBlank(*p)) {
+            p++;
+        }
     }
+    return num_corners;
+}
 
-    if (!ret) {
+/// Parses an optionally signed integer, returns false if there is none.
+inline bool ParseOBJIndex(const char*& p, const char* end, int& value) {
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = *p == '-';
+        p++;
+    }
+    if (p == end || *p < '0' || *p > '9') {
         return false;
     }
+    value = 0;
+    while (p < end && *p >= '0' && *p <= '9') {
+        value = value * 10 + (*p - '0');
+        p++;
+    }
+    if (negative) {
+        value = -value;
+    }
+    return true;
+}
 
-    mesh.Clear();
-
-    // copy vertex and data
-    for (size_t vidx = 0; vidx < attrib.vertices.size(); vidx += 3) {
-        tinyobj::real_t vx = attrib.vertices[vidx + 0];
-        tinyobj::real_t vy = attrib.vertices[vidx + 1];
-        tinyobj::real_t vz = attrib.vertices[vidx + 2];
-        mesh.vertices_.push_back(Eigen::Vector3d(vx, vy, vz));
+/// Converts a 1-based or negative (relative to the \p count elements defined
+/// so far) index to a 0-based index, returns -1 if it is invalid.
+inline int ResolveOBJIndex(int index, size_t count, size_t total) {
+    long long resolved = index > 0 ? (long long)index - 1
+                                   : (long long)count + (long long)index;
+    if (index == 0 || resolved < 0 || resolved >= (long long)total) {
+        return -1;
     }
+    return (int)resolved;
+}
 
-    for (size_t vidx = 0; vidx < attrib.colors.size(); vidx += 3) {
-        tinyobj::real_t r = attrib.colors[vidx + 0];
-        tinyobj::real_t g = attrib.colors[vidx + 1];
-        tinyobj::real_t b = attrib.colors[vidx + 2];
-        mesh.vertex_colors_.push_back(Eigen::Vector3d(r, g, b));
+/// Parses a corner of a face (v, v/vt, v//vn or v/vt/vn) into raw indices,
+/// absent indices are 0.
+bool ParseOBJCorner(const char*& p, const char* end, int raw[3]) {
+    raw[0] = raw[1] = raw[2] = 0;
+    if (!ParseOBJIndex(p, end, raw[0])) {
+        return false;
+    }
+    if (p < end && *p == '/') {
+        p++;
+        ParseOBJIndex(p, end, raw[1]);
+        if (p < end && *p == '/') {
+            p++;
+            ParseOBJIndex(p, end, raw[2]);
+        }
     }
+    return p == end || IsOBJBlank(*p);
+}
 
-    // resize normal data and create bool indicator vector
-    mesh.vertex_normals_.resize(mesh.vertices_.size());
-    std::vector<bool> normals_indicator(mesh.vertices_.size(), false);
+/// First pass over a chunk: counts the elements and records the material
+/// statements.
+void ScanOBJChunk(OBJChunk& chunk) {
+    ForEachASCIILine(chunk.lines_, [&](const char* p, const char* end) {
+        switch (ParseOBJKeyword(p, end)) {
+            case OBJLineType::Vertex:
+                chunk.num_vertices_++;
+                break;
+            case OBJLineType::Texcoord:
+                chunk.num_texcoords_++;
+                break;
+            case OBJLineType::Normal:
+                chunk.num_normals_++;
+                break;
+            case OBJLineType::Face:
+                chunk.num_triangles_ +=
+                        std::max(CountOBJFaceCorners(p, end) - 2, 0);
+                break;
+            case OBJLineType::UseMaterial:
+                chunk.has_material_ = true;
+                chunk.last_material_ = ParseOBJName(p, end);
+                break;
+            case OBJLineType::MaterialLibrary:
+                chunk.material_libraries_.push_back(ParseOBJName(p, end));
+                break;
+            default:
+                break;
+        }
+    });
+}
 
-    // copy face data and copy normals data
-    // append face-wise uv data
-    for (size_t s = 0; s < shapes.size(); s++) {
-        size_t index_offset = 0;
-        for (size_t f = 0; f < shapes[s].mesh.num_face_vertices.size(); f++) {
-            int fv = shapes[s].mesh.num_face_vertices[f];
-            if (fv != 3) {
-                utility::LogWarning(
-                        "Read OBJ failed: facet with number of vertices not "
-                        "equal to 3");
-                return false;
+/// Second pass over a chunk: parses the elements into their final position.
+/// Faces are triangulated as fans.
+void ParseOBJChunk(OBJChunk& chunk,
+                   const std::map<std::string, int>& material_map,
+                   size_t num_vertices,
+                   size_t num_texcoords,
+                   size_t num_normals,
+                   geometry::TriangleMesh& mesh,
+                   std::vector<Eigen::Vector2d>& texcoords,
+                   std::vector<Eigen::Vector3d>& normals,
+                   std::vector<OBJCorner>& corners) {
+    size_t vertex_index = chunk.vertex_offset_;
+    size_t texcoord_index = chunk.texcoord_offset_;
+    size_t normal_index = chunk.normal_offset_;
+    size_t triangle_index = chunk.triangle_offset_;
+    int material_id = chunk.material_id_;
+    std::vector<OBJCorner> face;
+    ForEachASCIILine(chunk.lines_, [&](const char* p, const char* end) {
+        if (!chunk.success_) {
+            return;
+        }
+        double values[3];
+        switch (ParseOBJKeyword(p, end)) {
+            case OBJLineType::Vertex: {
+                if (!ParseASCIIDoubles(p, end, values, 3)) {
+                    chunk.success_ = false;
+                    return;
+                }
+                mesh.vertices_[vertex_index] =
+                        Eigen::Vector3d(values[0], values[1], values[2]);
+                // Vertices without color are white, as in tinyobjloader.
+                if (!ParseASCIIDoubles(p, end, values, 3)) {
+                    values[0] = values[1] = values[2] = 1.0;
+                }
+                mesh.vertex_colors_[vertex_index] =
+                        Eigen::Vector3d(values[0], values[1], values[2]);
+                vertex_index++;
+                break;
             }
-
-            Eigen::Vector3i facet;
-            for (int v = 0; v < fv; v++) {
-                tinyobj::index_t idx = shapes[s].mesh.indices[index_offset + v];
-                int vidx = idx.vertex_index;
-                facet(v) = vidx;
-
-                if (!attrib.normals.empty() && !normals_indicator[vidx] &&
-                    (3 * idx.normal_index + 2) < int(attrib.normals.size())) {
-                    tinyobj::real_t nx =
-                            attrib.normals[3 * idx.normal_index + 0];
-                    tinyobj::real_t ny =
-                            attrib.normals[3 * idx.normal_index + 1];
-                    tinyobj::real_t nz =
-                            attrib.normals[3 * idx.normal_index + 2];
-                    mesh.vertex_normals_[vidx](0) = nx;
-                    mesh.vertex_normals_[vidx](1) = ny;
-                    mesh.vertex_normals_[vidx](2) = nz;
-                    normals_indicator[vidx] = true;
+            case OBJLineType::Texcoord: {
+                if (!ParseASCIIDoubles(p, end, values, 1)) {
+                    chunk.success_ = false;
+                    return;
+                }
+                if (!ParseASCIIDoubles(p, end, values + 1, 1)) {
+                    values[1] = 0.0;
+                }
+                texcoords[texcoord_index++] =
+                        Eigen::Vector2d(values[0], values[1]);
+                break;
+            }
+            case OBJLineType::Normal: {
+                if (!ParseASCIIDoubles(p, end, values, 3)) {
+                    chunk.success_ = false;
+                    return;
+                }
+                normals[normal_index++] =
+                        Eigen::Vector3d(values[0], values[1], values[2]);
+                break;
+            }
+            case OBJLineType::Face: {
+                face.clear();
+                while ((p = SkipOBJBlanks(p, end)) < end) {
+                    int raw[3];
+                    if (!ParseOBJCorner(p, end, raw)) {
+                        chunk.success_ = false;
+                        return;
+                    }
+                    OBJCorner corner;
+                    corner.vertex_ =
+                            ResolveOBJIndex(raw[0], vertex_index, num_vertices);
+                    corner.texcoord_ = ResolveOBJIndex(raw[1], texcoord_index,
+                                                       num_texcoords);
+                    corner.normal_ =
+                            ResolveOBJIndex(raw[2], normal_index, num_normals);
+                    if (corner.vertex_ < 0) {
+                        chunk.success_ = false;
+                        return;
+                    }
+                    face.push_back(corner);
                 }
+                for (size_t k = 2; k < face.size(); k++) {
+                    corners[3 * triangle_index] = face[0];
+                    corners[3 * triangle_index + 1] = face[k - 1];
+                    corners[3 * triangle_index + 2] = face[k];
+                    mesh.triangles_[triangle_index] = Eigen::Vector3i(
+                            face[0].vertex_, face[k - 1].vertex_,
+                            face[k].vertex_);
+                    mesh.triangle_material_ids_[triangle_index] = material_id;
+                    triangle_index++;
+                }
+                break;
+            }
+            case OBJLineType::UseMaterial: {
+                std::string name = ParseOBJName(p, end);
+                auto it = material_map.find(name);
+                material_id = it == material_map.end() ? -1 : it->second;
+                if (it == material_map.end() &&
+                    chunk.unknown_material_.empty()) {
+                    chunk.unknown_material_ = name;
+                }
+                break;
+            }
+            default:
+                break;
+        }
+    });
+}
 
-                if (!attrib.texcoords.empty() &&
-                    2 * idx.texcoord_index + 1 < int(attrib.texcoords.size())) {
-                    tinyobj::real_t tx =
-                            attrib.texcoords[2 * idx.texcoord_index + 0];
-                    tinyobj::real_t ty =
-                            attrib.texcoords[2 * idx.texcoord_index + 1];
-                    mesh.triangle_uvs_.push_back(Eigen::Vector2d(tx, ty));
+/// Loads the materials of the mtllib statements, each of which lists
+/// alternative file names.
+void LoadOBJMaterials(const std::vector<OBJChunk>& chunks,
+                      const std::string& mtl_base_path,
+                      std::vector<tinyobj::material_t>& materials,
+                      std::map<std::string, int>& material_map) {
+    tinyobj::MaterialFileReader reader(mtl_base_path);
+    for (const auto& chunk : chunks) {
+        for (const auto& library : chunk.material_libraries_) {
+            std::vector<std::string> filenames;
+            utility::SplitString(filenames, library, " \t");
+            std::string warn, err;
+            bool found = false;
+            for (const auto& filename : filenames) {
+                if (reader(filename, &materials, &material_map, &warn, &err)) {
+                    found = true;
+                    break;
                 }
             }
-            mesh.triangles_.push_back(facet);
-            mesh.triangle_material_ids_.push_back(
-                    shapes[s].mesh.material_ids[f]);
-            index_offset += fv;
+            if (!found) {
+                utility::LogWarning(
+                        "Read OBJ failed: unable to load material file {}",
+                        library);
+            } else if (!warn.empty()) {
+                utility::LogWarning("Read OBJ failed: {}", warn);
+            }
+        }
+    }
+}
+
+/// \brief Sets the vertex normals from the normal indices of the corners.
+///
+/// A vertex referenced with several normals is duplicated for each
+/// additional normal. The corners are bucketed by vertex once, then shards
+/// of vertices walk their own buckets concurrently, and the duplicates are
+/// appended in the order of their first use. Returns false if some vertices
+/// have no normal, in which case the mesh is left unchanged.
+bool SetOBJVertexNormals(const std::vector<Eigen::Vector3d>& normals,
+                         const std::vector<OBJCorner>& corners,
+                         geometry::TriangleMesh& mesh) {
+    const int num_vertices = (int)mesh.vertices_.size();
+    int num_shards = 1;
+#ifdef _OPENMP
+    num_shards = omp_get_max_threads();
+#endif
+    // Counting sort of the corners with a normal by vertex, each bucket
+    // lists its corners in increasing order.
+    std::vector<size_t> bucket_offsets(num_vertices + 1, 0);
+    for (const auto& corner : corners) {
+        if (corner.normal_ >= 0) {
+            bucket_offsets[corner.vertex_ + 1]++;
+        }
+    }
+    std::partial_sum(bucket_offsets.begin(), bucket_offsets.end(),
+                     bucket_offsets.begin());
+    std::vector<size_t> bucket_corners(bucket_offsets[num_vertices]);
+    {
+        std::vector<size_t> bucket_ends(bucket_offsets.begin(),
+                                        bucket_offsets.end() - 1);
+        for (size_t c = 0; c < corners.size(); c++) {
+            if (corners[c].normal_ >= 0) {
+                bucket_corners[bucket_ends[corners[c].vertex_]++] = c;
+            }
         }
     }
 
-    // if not all normals have been set, then remove the vertex normals
-    bool all_normals_set =
-            std::accumulate(normals_indicator.begin(), normals_indicator.end(),
-                            true, [](bool a, bool b) { return a && b; });
+    // The normal of the first corner of a vertex is its own, the first
+    // corner of each other normal creates a duplicate as (corner, normal).
+    // Each corner records the first corner of its vertex with the same
+    // normal.
+    std::vector<int> vertex_normals(num_vertices, -1);
+    std::vector<size_t> first_corners(corners.size());
+    std::vector<std::vector<std::pair<size_t, int>>> duplicates(num_shards);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1)
+#endif
+    for (int shard = 0; shard < num_shards; shard++) {
+        const int begin = (int)((int64_t)num_vertices * shard / num_shards);
+        const int end =
+                (int)((int64_t)num_vertices * (shard + 1) / num_shards);
+        std::vector<std::pair<int, size_t>> bucket;
+        for (int v = begin; v < end; v++) {
+            if (bucket_offsets[v] == bucket_offsets[v + 1]) {
+                continue;
+            }
+            bucket.clear();
+            for (size_t i = bucket_offsets[v]; i < bucket_offsets[v + 1];
+                 i++) {
+                size_t c = bucket_corners[i];
+                bucket.emplace_back(corners[c].normal_, c);
+            }
+            vertex_normals[v] = bucket[0].first;
+            std::sort(bucket.begin(), bucket.end());
+            for (size_t i = 0; i < bucket.size(); i++) {
+                if (i == 0 || bucket[i].first != bucket[i - 1].first) {
+                    first_corners[bucket[i].second] = bucket[i].second;
+                    if (bucket[i].first != vertex_normals[v]) {
+                        duplicates[shard].emplace_back(bucket[i].second,
+                                                       bucket[i].first);
+                    }
+                } else {
+                    first_corners[bucket[i].second] =
+                            first_corners[bucket[i - 1].second];
+                }
+            }
+        }
+    }
+    bool all_normals_set = true;
+#ifdef _OPENMP
+#pragma omp parallel for reduction(&& : all_normals_set)
+#endif
+    for (int i = 0; i < num_vertices; i++) {
+        all_normals_set = all_normals_set && vertex_normals[i] >= 0;
+    }
     if (!all_normals_set) {
-        mesh.vertex_normals_.clear();
+        return false;
+    }
+
+    // Appends the duplicates in the order of their first corner, so that
+    // the result does not depend on the number of shards.
+    std::vector<std::pair<size_t, int>> all_duplicates;
+    for (const auto& shard_duplicates : duplicates) {
+        all_duplicates.insert(all_duplicates.end(), shard_duplicates.begin(),
+                              shard_duplicates.end());
+    }
+    std::sort(all_duplicates.begin(), all_duplicates.end());
+    // Index of the duplicate created by each first corner.
+    std::vector<int> duplicate_index(all_duplicates.empty() ? 0
+                                                            : corners.size());
+    mesh.vertices_.resize(num_vertices + all_duplicates.size());
+    mesh.vertex_colors_.resize(num_vertices + all_duplicates.size());
+    mesh.vertex_normals_.resize(num_vertices + all_duplicates.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < (int)all_duplicates.size(); i++) {
+        int vertex = corners[all_duplicates[i].first].vertex_;
+        int normal = all_duplicates[i].second;
+        mesh.vertices_[num_vertices + i] = mesh.vertices_[vertex];
+        mesh.vertex_colors_[num_vertices + i] = mesh.vertex_colors_[vertex];
+        mesh.vertex_normals_[num_vertices + i] = normals[normal];
+        duplicate_index[all_duplicates[i].first] = num_vertices + i;
+    }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < num_vertices; i++) {
+        mesh.vertex_normals_[i] = normals[vertex_normals[i]];
+    }
+    if (!all_duplicates.empty()) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int c = 0; c < (int)corners.size(); c++) {
+            const OBJCorner& corner = corners[c];
+            if (corner.normal_ >= 0 &&
+                corner.normal_ != vertex_normals[corner.vertex_]) {
+                mesh.triangles_[c / 3](c % 3) =
+                        duplicate_index[first_corners[c]];
+            }
+        }
+    }
+    return true;
+}
+
+/// \brief Reads the geometry of an OBJ file in two parallel passes over
+/// chunks of lines.
+///
+/// The first pass counts the elements of each chunk, so that the second one
+/// parses them directly into presized buffers.
+bool ReadOBJ(const char* data,
+             size_t size,
+             const std::string& mtl_base_path,
+             geometry::TriangleMesh& mesh,
+             std::vector<tinyobj::material_t>& materials,
+             bool print_progress) {
+    std::vector<ASCIIChunk> lines = SplitASCIIChunks(data, size);
+    std::vector<OBJChunk> chunks(lines.size());
+    for (size_t c = 0; c < lines.size(); c++) {
+        chunks[c].lines_ = lines[c];
+    }
+    utility::ConsoleProgressBar progress_bar(2 * chunks.size(),
+                                             "Reading OBJ: ", print_progress);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int c = 0; c < (int)chunks.size(); c++) {
+        ScanOBJChunk(chunks[c]);
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+        ++progress_bar;
+    }
+
+    std::map<std::string, int> material_map;
+    LoadOBJMaterials(chunks, mtl_base_path, materials, material_map);
+    size_t num_vertices = 0, num_texcoords = 0, num_normals = 0;
+    size_t num_triangles = 0;
+    int material_id = -1;
+    for (auto& chunk : chunks) {
+        chunk.vertex_offset_ = num_vertices;
+        chunk.texcoord_offset_ = num_texcoords;
+        chunk.normal_offset_ = num_normals;
+        chunk.triangle_offset_ = num_triangles;
+        chunk.material_id_ = material_id;
+        num_vertices += chunk.num_vertices_;
+        num_texcoords += chunk.num_texcoords_;
+        num_normals += chunk.num_normals_;
+        num_triangles += chunk.num_triangles_;
+        if (chunk.has_material_) {
+            auto it = material_map.find(chunk.last_material_);
+            material_id = it == material_map.end() ? -1 : it->second;
+        }
+    }
+
+    mesh.vertices_.resize(num_vertices);
+    mesh.vertex_colors_.resize(num_vertices);
+    mesh.triangles_.resize(num_triangles);
+    mesh.triangle_material_ids_.resize(num_triangles);
+    std::vector<Eigen::Vector2d> texcoords(num_texcoords);
+    std::vector<Eigen::Vector3d> normals(num_normals);
+    std::vector<OBJCorner> corners(3 * num_triangles);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int c = 0; c < (int)chunks.size(); c++) {
+        ParseOBJChunk(chunks[c], material_map, num_vertices, num_texcoords,
+                      num_normals, mesh, texcoords, normals, corners);
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+        ++progress_bar;
     }
+    std::set<std::string> unknown_materials;
+    for (const auto& chunk : chunks) {
+        if (!chunk.success_) {
+            utility::LogWarning(
+                    "Read OBJ failed: invalid element in the lines {:d} to "
+                    "{:d}.",
+                    chunk.lines_.line_offset_ + 1,
+                    chunk.lines_.line_offset_ + chunk.lines_.num_lines_);
+            mesh.Clear();
+            return false;
+        }
+        if (!chunk.unknown_material_.empty() &&
+            unknown_materials.insert(chunk.unknown_material_).second) {
+            utility::LogWarning("Read OBJ: material [ {} ] not found.",
+                                chunk.unknown_material_);
+        }
+    }
+
+    // Triangle uvs are kept only if all corners have one.
+    bool all_uvs_set = !texcoords.empty();
+#ifdef _OPENMP
+#pragma omp parallel for reduction(&& : all_uvs_set)
+#endif
+    for (int c = 0; c < (int)corners.size(); c++) {
+        all_uvs_set = all_uvs_set && corners[c].texcoord_ >= 0;
+    }
+    if (all_uvs_set) {
+        mesh.triangle_uvs_.resize(corners.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int c = 0; c < (int)corners.size(); c++) {
+            mesh.triangle_uvs_[c] = texcoords[corners[c].texcoord_];
+        }
+    }
+    if (!normals.empty()) {
+        SetOBJVertexNormals(normals, corners, mesh);
+    }
+    return true;
+}
+
+}  // namespace obj_reader
+
+}  // unnamed namespace
+
+namespace io {
 
-    // if not all triangles have corresponding uvs, then remove uvs
-    if (3 * mesh.triangles_.size() != mesh.triangle_uvs_.size()) {
-        mesh.triangle_uvs_.clear();
+FileGeometry ReadFileGeometryTypeOBJ(const std::string& path) {
+    return FileGeometry(CONTAINS_TRIANGLES | CONTAINS_POINTS);
+}
+
+bool ReadTriangleMeshFromOBJ(const std::string& filename,
+                             geometry::TriangleMesh& mesh,
+                             bool print_progress) {
+    utility::filesystem::MappedFile file;
+    if (!file.Open(filename)) {
+        utility::LogWarning("Read OBJ failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    std::string mtl_base_path =
+            utility::filesystem::GetFileParentDirectory(filename);
+    std::vector<tinyobj::material_t> materials;
+    mesh.Clear();
+    if (!obj_reader::ReadOBJ(file.Data(), file.Size(), mtl_base_path, mesh,
+                             materials, print_progress)) {
+        return false;
     }
 
     auto textureLoader = [&mtl_base_path](std::string& relativePath) {
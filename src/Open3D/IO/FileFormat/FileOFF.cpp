@@ -24,14 +24,70 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <fstream>
+#include <sstream>
+#include <utility>
 #include <vector>
 
 #include "Open3D/IO/ClassIO/FileFormatIO.h"
 #include "Open3D/IO/ClassIO/TriangleMeshIO.h"
+#include "Open3D/IO/FileFormat/ASCIIHelper.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/Helper.h"
+#include "Open3D/Utility/MappedFile.h"
 
 namespace open3d {
+
+namespace {
+using namespace io;
+
+/// Skips blanks and parses an unsigned integer. Returns the position after
+/// the number, or nullptr if there is none.
+const char *ParseOFFIndex(const char *p,
+                          const char *end,
+                          unsigned int &value) {
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) {
+        p++;
+    }
+    if (p == end || *p < '0' || *p > '9') {
+        return nullptr;
+    }
+    std::uint64_t number = 0;
+    for (; p < end && *p >= '0' && *p <= '9'; p++) {
+        number = number * 10 + (*p - '0');
+        if (number > UINT32_MAX) {
+            return nullptr;
+        }
+    }
+    value = (unsigned int)number;
+    return p;
+}
+
+/// Parses the vertex indices of a face line into \p indices.
+bool ParseOFFFace(const char *p,
+                  const char *end,
+                  std::vector<unsigned int> &indices) {
+    unsigned int n;
+    p = ParseOFFIndex(p, end, n);
+    // Every index takes at least two characters.
+    if (p == nullptr || n > (unsigned int)(end - p) / 2) {
+        return false;
+    }
+    indices.resize(n);
+    for (unsigned int i = 0; i < n; i++) {
+        p = ParseOFFIndex(p, end, indices[i]);
+        if (p == nullptr) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // unnamed namespace
+
 namespace io {
 
 FileGeometry ReadFileGeometryTypeOFF(const std::string &path) {
@@ -41,16 +97,25 @@ FileGeometry ReadFileGeometryTypeOFF(const std::string &path) {
 bool ReadTriangleMeshFromOFF(const std::string &filename,
                              geometry::TriangleMesh &mesh,
                              bool print_progress) {
-    std::ifstream file(filename.c_str(), std::ios::in);
-    if (!file) {
+    utility::filesystem::MappedFile file;
+    if (!file.Open(filename)) {
         utility::LogWarning("Read OFF failed: unable to open file: {}",
                             filename);
         return false;
     }
+    const char *p = file.Data();
+    const char *data_end = file.Data() + file.Size();
 
-    auto GetNextLine = [](std::ifstream &file) -> std::string {
-        for (std::string line; std::getline(file, line);) {
-            line = utility::StripString(line);
+    auto GetNextLine = [&p, data_end]() -> std::string {
+        while (p < data_end) {
+            const char *line_end = static_cast<const char *>(
+                    std::memchr(p, '\n', data_end - p));
+            if (line_end == nullptr) {
+                line_end = data_end;
+            }
+            std::string line(p, line_end);
+            utility::StripString(line);
+            p = std::min(line_end + 1, data_end);
             if (!line.empty() && line[0] != '#') {
                 return line;
             }
@@ -58,7 +123,7 @@ bool ReadTriangleMeshFromOFF(const std::string &filename,
         return "";
     };
 
-    std::string header = GetNextLine(file);
+    std::string header = GetNextLine();
     if (header != "OFF" && header != "COFF" && header != "NOFF" &&
         header != "CNOFF") {
         utility::LogWarning(
@@ -66,7 +131,7 @@ bool ReadTriangleMeshFromOFF(const std::string &filename,
         return false;
     }
 
-    std::string info = GetNextLine(file);
+    std::string info = GetNextLine();
     unsigned int num_of_vertices, num_of_faces, num_of_edges;
     std::istringstream iss(info);
     if (!(iss >> num_of_vertices >> num_of_faces >> num_of_edges)) {
@@ -79,6 +144,38 @@ bool ReadTriangleMeshFromOFF(const std::string &filename,
         return false;
     }
 
+    // Collects the lines that are not blank or comments in parallel.
+    std::vector<ASCIIChunk> chunks = SplitASCIIChunks(p, data_end - p);
+    utility::ConsoleProgressBar progress_bar(chunks.size() + 2,
+                                             "Reading OFF: ", print_progress);
+    std::vector<std::pair<const char *, const char *>> lines(
+            CountASCIILines(chunks));
+    const size_t num_lines = ParseASCIILines(
+            chunks,
+            [&](const char *begin, const char *end, size_t index) {
+                while (begin < end && (*begin == ' ' || *begin == '\t' ||
+                                       *begin == '\r')) {
+                    begin++;
+                }
+                if (begin == end || *begin == '#') {
+                    return false;
+                }
+                lines[index] = std::make_pair(begin, end);
+                return true;
+            },
+            [&](size_t from, size_t to) { lines[to] = lines[from]; },
+            &progress_bar);
+    if (num_lines < (size_t)num_of_vertices) {
+        utility::LogWarning(
+                "Read OFF failed: could not read all vertex values.");
+        return false;
+    }
+    if (num_lines - num_of_vertices < (size_t)num_of_faces) {
+        utility::LogWarning(
+                "Read OFF failed: could not read all vertex indices.");
+        return false;
+    }
+
     mesh.Clear();
     mesh.vertices_.resize(num_of_vertices);
     bool parse_vertex_normals = false;
@@ -92,74 +189,139 @@ bool ReadTriangleMeshFromOFF(const std::string &filename,
         mesh.vertex_colors_.resize(num_of_vertices);
     }
 
-    utility::ConsoleProgressBar progress_bar(num_of_vertices + num_of_faces,
-                                             "Reading OFF: ", print_progress);
-
-    float vx, vy, vz;
-    float nx, ny, nz;
-    float r, g, b, alpha;
-    for (size_t vidx = 0; vidx < num_of_vertices; vidx++) {
-        std::string line = GetNextLine(file);
-        std::istringstream iss(line);
-        if (!(iss >> vx >> vy >> vz)) {
-            utility::LogWarning(
-                    "Read OFF failed: could not read all vertex values.");
-            return false;
+    bool vertices_valid = true;
+    bool normals_valid = true;
+    bool colors_valid = true;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) \
+        reduction(&& : vertices_valid, normals_valid, colors_valid)
+#endif
+    for (int vidx = 0; vidx < (int)num_of_vertices; vidx++) {
+        const char *q = lines[vidx].first;
+        const char *line_end = lines[vidx].second;
+        Eigen::Vector3d vertex;
+        if (!ParseASCIIDoubles(q, line_end, vertex.data(), 3)) {
+            vertices_valid = false;
+            continue;
         }
-        mesh.vertices_[vidx] = Eigen::Vector3d(vx, vy, vz);
-
-        if (parse_vertex_normals) {
-            if (!(iss >> nx >> ny >> nz)) {
-                utility::LogWarning(
-                        "Read OFF failed: could not read all vertex normal "
-                        "values.");
-                return false;
-            }
-            mesh.vertex_normals_[vidx](0) = nx;
-            mesh.vertex_normals_[vidx](1) = ny;
-            mesh.vertex_normals_[vidx](2) = nz;
+        mesh.vertices_[vidx] = vertex;
+        if (parse_vertex_normals &&
+            !ParseASCIIDoubles(q, line_end, mesh.vertex_normals_[vidx].data(),
+                               3)) {
+            normals_valid = false;
+            continue;
         }
         if (parse_vertex_colors) {
-            if (!(iss >> r >> g >> b >> alpha)) {
-                utility::LogWarning(
-                        "Read OFF failed: could not read all vertex color "
-                        "values.");
-                return false;
+            double color[4];
+            if (!ParseASCIIDoubles(q, line_end, color, 4)) {
+                colors_valid = false;
+                continue;
             }
             mesh.vertex_colors_[vidx] =
-                    Eigen::Vector3d(r / 255, g / 255, b / 255);
+                    Eigen::Vector3d(color[0], color[1], color[2]) / 255.0;
         }
-
-        ++progress_bar;
+    }
+    ++progress_bar;
+    if (!vertices_valid) {
+        utility::LogWarning(
+                "Read OFF failed: could not read all vertex values.");
+        return false;
+    }
+    if (!normals_valid) {
+        utility::LogWarning(
+                "Read OFF failed: could not read all vertex normal values.");
+        return false;
+    }
+    if (!colors_valid) {
+        utility::LogWarning(
+                "Read OFF failed: could not read all vertex color values.");
+        return false;
     }
 
-    unsigned int n, vertex_index;
-    std::vector<unsigned int> indices;
+    // A polygon of n vertices is split into n - 2 triangles, the first pass
+    // finds where the triangles of every face start.
+    const auto *face_lines = lines.data() + num_of_vertices;
+    std::vector<size_t> triangle_offsets(num_of_faces + 1, 0);
+    bool indices_valid = true;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) reduction(&& : indices_valid)
+#endif
+    for (int tidx = 0; tidx < (int)num_of_faces; tidx++) {
+        unsigned int n;
+        if (ParseOFFIndex(face_lines[tidx].first, face_lines[tidx].second,
+                          n) == nullptr) {
+            indices_valid = false;
+            continue;
+        }
+        triangle_offsets[tidx + 1] = n < 3 ? 1 : n - 2;
+    }
+    if (!indices_valid) {
+        utility::LogWarning(
+                "Read OFF failed: could not read all vertex indices.");
+        return false;
+    }
     for (size_t tidx = 0; tidx < num_of_faces; tidx++) {
-        std::string line = GetNextLine(file);
-        std::istringstream iss(line);
-        iss >> n;
-        indices.clear();
-        for (size_t vidx = 0; vidx < n; vidx++) {
-            if (!(iss >> vertex_index)) {
-                utility::LogWarning(
-                        "Read OFF failed: could not read all vertex "
-                        "indices.");
-                return false;
+        triangle_offsets[tidx + 1] += triangle_offsets[tidx];
+    }
+
+    mesh.triangles_.resize(triangle_offsets.back());
+    int failed_face = (int)num_of_faces;
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<unsigned int> indices;
+        std::vector<Eigen::Vector3i> triangles;
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (int tidx = 0; tidx < (int)num_of_faces; tidx++) {
+            bool success = ParseOFFFace(face_lines[tidx].first,
+                                        face_lines[tidx].second, indices) &&
+                           indices.size() >= 3;
+            for (size_t i = 0; success && i < indices.size(); i++) {
+                success = indices[i] < num_of_vertices;
             }
-            indices.push_back(vertex_index);
+            if (success) {
+                triangles.clear();
+                success = AddTrianglesByEarClipping(mesh.vertices_, indices,
+                                                    triangles);
+            }
+            if (!success) {
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+                failed_face = std::min(failed_face, tidx);
+                continue;
+            }
+            std::copy(triangles.begin(), triangles.end(),
+                      mesh.triangles_.begin() + triangle_offsets[tidx]);
         }
-        if (!AddTrianglesByEarClipping(mesh, indices)) {
+    }
+    ++progress_bar;
+    if (failed_face < (int)num_of_faces) {
+        std::vector<unsigned int> indices;
+        mesh.Clear();
+        if (!ParseOFFFace(face_lines[failed_face].first,
+                          face_lines[failed_face].second, indices)) {
+            utility::LogWarning(
+                    "Read OFF failed: could not read all vertex indices.");
+        } else if (std::any_of(indices.begin(), indices.end(),
+                               [&](unsigned int index) {
+                                   return index >= num_of_vertices;
+                               })) {
+            utility::LogWarning(
+                    "Read OFF failed: vertex index out of range. Vertex "
+                    "indices: {}",
+                    indices);
+        } else {
             utility::LogWarning(
                     "Read OFF failed: A polygon in the mesh could not be "
                     "decomposed into triangles. Vertex indices: {}",
                     indices);
-            return false;
         }
-        ++progress_bar;
+        return false;
     }
-
-    file.close();
     return true;
 }
 
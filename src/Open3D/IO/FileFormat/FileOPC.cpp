@@ -0,0 +1,1091 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+#include "Open3D/IO/ClassIO/FileFormatIO.h"
+#include "Open3D/IO/ClassIO/OctreeIO.h"
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
+#include "Open3D/IO/FileFormat/MortonCode.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/FileSystem.h"
+#include "Open3D/Utility/MappedFile.h"
+
+// Octree compressed point cloud (.opc) layout, all values little-endian:
+//
+//   char[6]    magic "O3DOPC"
+//   uint16     version
+//   uint8      depth, uint8 split_depth, uint8 flags, uint8 reserved
+//   uint32     num_subtrees
+//   double     origin[3], double size
+//   uint64     num_points
+//   uint32     top_size
+//   top        range coded occupancy of the levels [0, split_depth)
+//   table      num_subtrees x {uint32 compressed_size, uint32 num_points}
+//   subtrees   range coded occupancy of the levels [split_depth, depth), then
+//              the point count of every leaf if kOPCHasCounts is set, then
+//              the colors of every point if kOPCHasColors is set
+//
+// The points are quantized to the leaves of an octree of the given depth over
+// the cube [origin, origin + size). Every internal node is stored as an
+// occupancy byte, in which bit i is set if child i (x + 2 y + 4 z) is
+// occupied, in breadth-first order. The nodes at split_depth are the roots of
+// subtrees that are coded independently, so that they can be encoded and
+// decoded in parallel. Colors are coded as differences to the previous point
+// of the subtree.
+
+namespace open3d {
+
+namespace {
+using namespace io;
+
+const char kOPCMagic[6] = {'O', '3', 'D', 'O', 'P', 'C'};
+const std::uint16_t kOPCVersion = 1;
+const std::uint8_t kOPCHasColors = 1 << 0;
+const std::uint8_t kOPCHasCounts = 1 << 1;
+const size_t kOPCHeaderSize = 60;
+// The subtrees are rooted at the first depth with at least this many nodes.
+const size_t kOPCMinSubtrees = 64;
+
+// Adaptive binary range coder, as used by LZMA. Probabilities are 11 bit
+// estimates of a bit being 0.
+const int kOPCProbBits = 11;
+const std::uint16_t kOPCProbInit = 1 << (kOPCProbBits - 1);
+const int kOPCMoveBits = 5;
+const std::uint32_t kOPCTopValue = 1 << 24;
+
+class OPCEncoder {
+public:
+    explicit OPCEncoder(std::vector<std::uint8_t> &output) : output_(output) {}
+
+    void EncodeBit(std::uint16_t &prob, int bit) {
+        const std::uint32_t bound = (range_ >> kOPCProbBits) * prob;
+        if (bit == 0) {
+            range_ = bound;
+            prob += ((1 << kOPCProbBits) - prob) >> kOPCMoveBits;
+        } else {
+            low_ += bound;
+            range_ -= bound;
+            prob -= prob >> kOPCMoveBits;
+        }
+        while (range_ < kOPCTopValue) {
+            range_ <<= 8;
+            ShiftLow();
+        }
+    }
+
+    void EncodeDirectBits(std::uint32_t value, int num_bits) {
+        for (int i = num_bits - 1; i >= 0; i--) {
+            range_ >>= 1;
+            if ((value >> i) & 1) {
+                low_ += range_;
+            }
+            while (range_ < kOPCTopValue) {
+                range_ <<= 8;
+                ShiftLow();
+            }
+        }
+    }
+
+    void Flush() {
+        for (int i = 0; i < 5; i++) {
+            ShiftLow();
+        }
+    }
+
+private:
+    void ShiftLow() {
+        if ((std::uint32_t)low_ < 0xFF000000u || (low_ >> 32) != 0) {
+            const std::uint8_t carry = (std::uint8_t)(low_ >> 32);
+            std::uint8_t byte = cache_;
+            do {
+                output_.push_back((std::uint8_t)(byte + carry));
+                byte = 0xFF;
+            } while (--cache_size_ != 0);
+            cache_ = (std::uint8_t)(low_ >> 24);
+        }
+        cache_size_++;
+        low_ = (low_ & 0x00FFFFFF) << 8;
+    }
+
+    std::vector<std::uint8_t> &output_;
+    std::uint64_t low_ = 0;
+    std::uint32_t range_ = 0xFFFFFFFF;
+    std::uint8_t cache_ = 0;
+    std::uint64_t cache_size_ = 1;
+};
+
+class OPCDecoder {
+public:
+    OPCDecoder(const std::uint8_t *data, size_t size)
+        : data_(data), size_(size) {
+        for (int i = 0; i < 5; i++) {
+            code_ = (code_ << 8) | NextByte();
+        }
+    }
+
+    int DecodeBit(std::uint16_t &prob) {
+        const std::uint32_t bound = (range_ >> kOPCProbBits) * prob;
+        int bit;
+        if (code_ < bound) {
+            range_ = bound;
+            prob += ((1 << kOPCProbBits) - prob) >> kOPCMoveBits;
+            bit = 0;
+        } else {
+            code_ -= bound;
+            range_ -= bound;
+            prob -= prob >> kOPCMoveBits;
+            bit = 1;
+        }
+        while (range_ < kOPCTopValue) {
+            range_ <<= 8;
+            code_ = (code_ << 8) | NextByte();
+        }
+        return bit;
+    }
+
+    std::uint32_t DecodeDirectBits(int num_bits) {
+        std::uint32_t value = 0;
+        for (int i = 0; i < num_bits; i++) {
+            range_ >>= 1;
+            std::uint32_t bit = code_ >= range_ ? 1 : 0;
+            code_ -= range_ & (0 - bit);
+            value = (value << 1) | bit;
+            while (range_ < kOPCTopValue) {
+                range_ <<= 8;
+                code_ = (code_ << 8) | NextByte();
+            }
+        }
+        return value;
+    }
+
+    /// True if the decoder read past the end of its data.
+    bool IsOverrun() const { return position_ > size_; }
+
+private:
+    std::uint8_t NextByte() {
+        return position_ < size_ ? data_[position_++] : (position_++, 0);
+    }
+
+    const std::uint8_t *data_;
+    size_t size_;
+    size_t position_ = 0;
+    std::uint32_t code_ = 0;
+    std::uint32_t range_ = 0xFFFFFFFF;
+};
+
+/// Adaptive probabilities of the symbols of a stream.
+struct OPCModel {
+    OPCModel() {
+        for (auto &probs : occupancy_) {
+            std::fill(probs.begin(), probs.end(), kOPCProbInit);
+        }
+        std::fill(count_.begin(), count_.end(), kOPCProbInit);
+        for (auto &probs : color_) {
+            std::fill(probs.begin(), probs.end(), kOPCProbInit);
+        }
+    }
+
+    /// Bit trees of the occupancy bytes, by number of occupied siblings.
+    std::array<std::array<std::uint16_t, 256>, 8> occupancy_;
+    /// Bit tree of the bit lengths of the point counts.
+    std::array<std::uint16_t, 64> count_;
+    /// Bit trees of the color differences, by channel.
+    std::array<std::array<std::uint16_t, 256>, 3> color_;
+};
+
+void EncodeOPCByte(OPCEncoder &encoder,
+                   std::array<std::uint16_t, 256> &probs,
+                   std::uint8_t byte) {
+    int node = 1;
+    for (int i = 7; i >= 0; i--) {
+        const int bit = (byte >> i) & 1;
+        encoder.EncodeBit(probs[node], bit);
+        node = (node << 1) | bit;
+    }
+}
+
+std::uint8_t DecodeOPCByte(OPCDecoder &decoder,
+                           std::array<std::uint16_t, 256> &probs) {
+    int node = 1;
+    for (int i = 0; i < 8; i++) {
+        node = (node << 1) | decoder.DecodeBit(probs[node]);
+    }
+    return (std::uint8_t)node;
+}
+
+/// Codes a point count as its bit length followed by the bits below the
+/// leading one.
+void EncodeOPCCount(OPCEncoder &encoder,
+                    OPCModel &model,
+                    std::uint32_t count) {
+    int num_bits = 0;
+    while (num_bits < 32 && (count >> num_bits) != 0) {
+        num_bits++;
+    }
+    int node = 1;
+    for (int i = 5; i >= 0; i--) {
+        const int bit = (num_bits >> i) & 1;
+        encoder.EncodeBit(model.count_[node], bit);
+        node = (node << 1) | bit;
+    }
+    if (num_bits > 1) {
+        encoder.EncodeDirectBits(count, num_bits - 1);
+    }
+}
+
+std::uint32_t DecodeOPCCount(OPCDecoder &decoder, OPCModel &model) {
+    int node = 1;
+    for (int i = 0; i < 6; i++) {
+        node = (node << 1) | decoder.DecodeBit(model.count_[node]);
+    }
+    const int num_bits = std::min(node - 64, 32);
+    if (num_bits <= 1) {
+        return (std::uint32_t)num_bits;
+    }
+    return (1u << (num_bits - 1)) | decoder.DecodeDirectBits(num_bits - 1);
+}
+
+// Context of the children of a node with the given occupancy byte.
+inline int GetOPCContext(std::uint8_t occupancy) {
+    int num_children = 0;
+    for (int i = 0; i < 8; i++) {
+        num_children += (occupancy >> i) & 1;
+    }
+    return num_children - 1;
+}
+// Context of the root.
+const int kOPCRootContext = 7;
+
+/// Leaves of the octree sorted by Morton code, along with their points.
+struct OPCLeaves {
+    std::vector<std::uint64_t> codes_;
+    /// Number of points of every leaf, empty if every leaf holds one point.
+    std::vector<std::uint32_t> counts_;
+    /// Colors of the points, empty if there are none.
+    std::vector<std::array<std::uint8_t, 3>> colors_;
+};
+
+struct OPCHeader {
+    int depth_ = 0;
+    int split_depth_ = 0;
+    std::uint8_t flags_ = 0;
+    std::uint32_t num_subtrees_ = 0;
+    Eigen::Vector3d origin_ = Eigen::Vector3d::Zero();
+    double size_ = 0.0;
+    std::uint64_t num_points_ = 0;
+    std::uint32_t top_size_ = 0;
+};
+
+template <typename T>
+void AppendOPCValue(std::vector<std::uint8_t> &buffer, const T &value) {
+    const size_t offset = buffer.size();
+    buffer.resize(offset + sizeof(T));
+    memcpy(buffer.data() + offset, &value, sizeof(T));
+}
+
+template <typename T>
+T ReadOPCValue(const std::uint8_t *&ptr) {
+    T value;
+    memcpy(&value, ptr, sizeof(T));
+    ptr += sizeof(T);
+    return value;
+}
+
+void AppendOPCHeader(std::vector<std::uint8_t> &buffer,
+                     const OPCHeader &header) {
+    for (char c : kOPCMagic) {
+        AppendOPCValue(buffer, c);
+    }
+    AppendOPCValue(buffer, kOPCVersion);
+    AppendOPCValue(buffer, (std::uint8_t)header.depth_);
+    AppendOPCValue(buffer, (std::uint8_t)header.split_depth_);
+    AppendOPCValue(buffer, header.flags_);
+    AppendOPCValue(buffer, (std::uint8_t)0);
+    AppendOPCValue(buffer, header.num_subtrees_);
+    for (int k = 0; k < 3; k++) {
+        AppendOPCValue(buffer, header.origin_(k));
+    }
+    AppendOPCValue(buffer, header.size_);
+    AppendOPCValue(buffer, header.num_points_);
+    AppendOPCValue(buffer, header.top_size_);
+}
+
+bool ReadOPCHeader(const std::uint8_t *data, size_t size, OPCHeader &header) {
+    if (size < kOPCHeaderSize ||
+        memcmp(data, kOPCMagic, sizeof(kOPCMagic)) != 0) {
+        utility::LogWarning("Read OPC failed: not an OPC stream.");
+        return false;
+    }
+    const std::uint8_t *ptr = data + sizeof(kOPCMagic);
+    const std::uint16_t version = ReadOPCValue<std::uint16_t>(ptr);
+    if (version > kOPCVersion) {
+        utility::LogWarning("Read OPC failed: unsupported version {:d}.",
+                            version);
+        return false;
+    }
+    header.depth_ = ReadOPCValue<std::uint8_t>(ptr);
+    header.split_depth_ = ReadOPCValue<std::uint8_t>(ptr);
+    header.flags_ = ReadOPCValue<std::uint8_t>(ptr);
+    ReadOPCValue<std::uint8_t>(ptr);
+    header.num_subtrees_ = ReadOPCValue<std::uint32_t>(ptr);
+    for (int k = 0; k < 3; k++) {
+        header.origin_(k) = ReadOPCValue<double>(ptr);
+    }
+    header.size_ = ReadOPCValue<double>(ptr);
+    header.num_points_ = ReadOPCValue<std::uint64_t>(ptr);
+    header.top_size_ = ReadOPCValue<std::uint32_t>(ptr);
+    if (header.depth_ > kMortonBitsPerAxis ||
+        header.split_depth_ > header.depth_) {
+        utility::LogWarning("Read OPC failed: invalid depth.");
+        return false;
+    }
+    return true;
+}
+
+/// \brief Encodes the occupancy bytes of the levels [begin_depth, end_depth)
+/// of the nodes holding the sorted leaf codes [begin, end).
+///
+/// \param nodes Prefixes of the nodes at begin_depth, replaced by the
+/// prefixes of the nodes at end_depth.
+/// \param contexts Contexts of the nodes, replaced like \p nodes.
+void EncodeOPCOccupancy(OPCEncoder &encoder,
+                        OPCModel &model,
+                        const std::uint64_t *begin,
+                        const std::uint64_t *end,
+                        int depth,
+                        int begin_depth,
+                        int end_depth,
+                        std::vector<std::uint64_t> &nodes,
+                        std::vector<int> &contexts) {
+    std::vector<std::uint64_t> children;
+    std::vector<int> child_contexts;
+    for (int d = begin_depth; d < end_depth; d++) {
+        const int shift = 3 * (depth - d - 1);
+        children.clear();
+        child_contexts.clear();
+        const std::uint64_t *code = begin;
+        for (size_t n = 0; n < nodes.size(); n++) {
+            std::uint8_t occupancy = 0;
+            while (code != end && ((*code >> shift) >> 3) == nodes[n]) {
+                const std::uint64_t child = *code >> shift;
+                occupancy |= 1 << (child & 7);
+                children.push_back(child);
+                // Skip the other leaves of the child.
+                while (code != end && (*code >> shift) == child) {
+                    code++;
+                }
+            }
+            EncodeOPCByte(encoder, model.occupancy_[contexts[n]], occupancy);
+            child_contexts.resize(children.size(), GetOPCContext(occupancy));
+        }
+        nodes.swap(children);
+        contexts.swap(child_contexts);
+    }
+}
+
+/// Decodes the occupancy bytes written by EncodeOPCOccupancy(). Returns false
+/// if the stream is corrupted.
+bool DecodeOPCOccupancy(OPCDecoder &decoder,
+                        OPCModel &model,
+                        int begin_depth,
+                        int end_depth,
+                        size_t max_nodes,
+                        std::vector<std::uint64_t> &nodes,
+                        std::vector<int> &contexts) {
+    std::vector<std::uint64_t> children;
+    std::vector<int> child_contexts;
+    for (int d = begin_depth; d < end_depth; d++) {
+        children.clear();
+        child_contexts.clear();
+        for (size_t n = 0; n < nodes.size(); n++) {
+            const std::uint8_t occupancy =
+                    DecodeOPCByte(decoder, model.occupancy_[contexts[n]]);
+            if (occupancy == 0 || decoder.IsOverrun()) {
+                return false;
+            }
+            for (int i = 0; i < 8; i++) {
+                if ((occupancy >> i) & 1) {
+                    children.push_back((nodes[n] << 3) | i);
+                }
+            }
+            child_contexts.resize(children.size(), GetOPCContext(occupancy));
+        }
+        if (children.size() > max_nodes) {
+            return false;
+        }
+        nodes.swap(children);
+        contexts.swap(child_contexts);
+    }
+    return true;
+}
+
+/// \brief Encodes the sorted leaves of an octree.
+///
+/// The leaves are split into subtrees at the first depth with at least
+/// kOPCMinSubtrees nodes, which are encoded in parallel.
+void EncodeOPC(const OPCLeaves &leaves,
+               OPCHeader &header,
+               std::vector<std::uint8_t> &buffer) {
+    const std::vector<std::uint64_t> &codes = leaves.codes_;
+    const int depth = header.depth_;
+    header.flags_ = (leaves.counts_.empty() ? 0 : kOPCHasCounts) |
+                    (leaves.colors_.empty() ? 0 : kOPCHasColors);
+    header.num_points_ =
+            leaves.colors_.empty()
+                    ? (leaves.counts_.empty()
+                               ? codes.size()
+                               : std::accumulate(leaves.counts_.begin(),
+                                                 leaves.counts_.end(),
+                                                 std::uint64_t(0)))
+                    : leaves.colors_.size();
+
+    // Find the split depth.
+    int split_depth = depth;
+    for (int d = 0; d < depth; d++) {
+        const int shift = 3 * (depth - d);
+        size_t num_nodes = 0;
+        for (size_t i = 0; i < codes.size() && num_nodes < kOPCMinSubtrees;
+             i++) {
+            if (i == 0 || (codes[i] >> shift) != (codes[i - 1] >> shift)) {
+                num_nodes++;
+            }
+        }
+        if (num_nodes >= kOPCMinSubtrees) {
+            split_depth = d;
+            break;
+        }
+    }
+    header.split_depth_ = codes.empty() ? 0 : split_depth;
+
+    // Levels above the subtrees.
+    std::vector<std::uint8_t> top;
+    std::vector<std::uint64_t> nodes;
+    std::vector<int> contexts;
+    if (!codes.empty()) {
+        OPCEncoder encoder(top);
+        OPCModel model;
+        nodes.push_back(0);
+        contexts.push_back(kOPCRootContext);
+        EncodeOPCOccupancy(encoder, model, codes.data(),
+                           codes.data() + codes.size(), depth, 0,
+                           header.split_depth_, nodes, contexts);
+        encoder.Flush();
+    }
+    header.num_subtrees_ = (std::uint32_t)nodes.size();
+    header.top_size_ = (std::uint32_t)top.size();
+
+    // Leaf and point ranges of the subtrees.
+    const int subtree_shift = 3 * (depth - header.split_depth_);
+    std::vector<size_t> leaf_offsets(nodes.size() + 1, codes.size());
+    std::vector<size_t> point_offsets(nodes.size() + 1,
+                                      (size_t)header.num_points_);
+    for (size_t i = 0, n = 0, point = 0; i < codes.size(); i++) {
+        if (i == 0 || (codes[i] >> subtree_shift) !=
+                              (codes[i - 1] >> subtree_shift)) {
+            leaf_offsets[n] = i;
+            point_offsets[n] = point;
+            n++;
+        }
+        point += leaves.counts_.empty() ? 1 : leaves.counts_[i];
+    }
+
+    std::vector<std::vector<std::uint8_t>> subtrees(nodes.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int s = 0; s < (int)nodes.size(); s++) {
+        OPCEncoder encoder(subtrees[s]);
+        OPCModel model;
+        std::vector<std::uint64_t> subtree_nodes(1, nodes[s]);
+        std::vector<int> subtree_contexts(1, contexts[s]);
+        EncodeOPCOccupancy(encoder, model, codes.data() + leaf_offsets[s],
+                           codes.data() + leaf_offsets[s + 1], depth,
+                           header.split_depth_, depth, subtree_nodes,
+                           subtree_contexts);
+        if (!leaves.counts_.empty()) {
+            for (size_t i = leaf_offsets[s]; i < leaf_offsets[s + 1]; i++) {
+                EncodeOPCCount(encoder, model, leaves.counts_[i]);
+            }
+        }
+        if (!leaves.colors_.empty()) {
+            std::array<std::uint8_t, 3> previous = {0, 0, 0};
+            for (size_t i = point_offsets[s]; i < point_offsets[s + 1]; i++) {
+                for (int k = 0; k < 3; k++) {
+                    EncodeOPCByte(encoder, model.color_[k],
+                                  (std::uint8_t)(leaves.colors_[i][k] -
+                                                 previous[k]));
+                }
+                previous = leaves.colors_[i];
+            }
+        }
+        encoder.Flush();
+    }
+
+    buffer.clear();
+    AppendOPCHeader(buffer, header);
+    buffer.insert(buffer.end(), top.begin(), top.end());
+    for (size_t s = 0; s < subtrees.size(); s++) {
+        AppendOPCValue(buffer, (std::uint32_t)subtrees[s].size());
+        AppendOPCValue(buffer, (std::uint32_t)(point_offsets[s + 1] -
+                                               point_offsets[s]));
+    }
+    for (const auto &subtree : subtrees) {
+        buffer.insert(buffer.end(), subtree.begin(), subtree.end());
+    }
+}
+
+/// \brief Decodes the leaves of an octree in parallel over the subtrees.
+///
+/// The point counts of the header and of the subtree table are not trusted
+/// for allocations before the subtrees are decoded consistently with them:
+/// the memory used while decoding is bounded by the size of the stream.
+/// \param subtrees The leaves of every subtree, holding the full Morton codes.
+/// \param point_offsets Index of the first point of every subtree, followed by
+/// the number of points.
+bool DecodeOPC(const std::uint8_t *data,
+               size_t size,
+               OPCHeader &header,
+               std::vector<OPCLeaves> &subtrees,
+               std::vector<size_t> &point_offsets) {
+    if (!ReadOPCHeader(data, size, header)) {
+        return false;
+    }
+    const std::uint8_t *ptr = data + kOPCHeaderSize;
+    const std::uint8_t *data_end = data + size;
+    const size_t table_size = 8 * (size_t)header.num_subtrees_;
+    if ((size_t)(data_end - ptr) < (size_t)header.top_size_ + table_size) {
+        utility::LogWarning("Read OPC failed: unexpected end of stream.");
+        return false;
+    }
+
+    std::vector<std::uint64_t> nodes;
+    std::vector<int> contexts;
+    if (header.num_subtrees_ > 0) {
+        OPCDecoder decoder(ptr, header.top_size_);
+        OPCModel model;
+        nodes.push_back(0);
+        contexts.push_back(kOPCRootContext);
+        if (!DecodeOPCOccupancy(decoder, model, 0, header.split_depth_,
+                                header.num_subtrees_, nodes, contexts) ||
+            nodes.size() != header.num_subtrees_) {
+            utility::LogWarning("Read OPC failed: corrupted stream.");
+            return false;
+        }
+    }
+    ptr += header.top_size_;
+
+    std::vector<size_t> stream_offsets(header.num_subtrees_ + 1, 0);
+    point_offsets.assign(header.num_subtrees_ + 1, 0);
+    for (size_t s = 0; s < header.num_subtrees_; s++) {
+        stream_offsets[s + 1] =
+                stream_offsets[s] + ReadOPCValue<std::uint32_t>(ptr);
+        point_offsets[s + 1] =
+                point_offsets[s] + ReadOPCValue<std::uint32_t>(ptr);
+    }
+    if (stream_offsets.back() > (size_t)(data_end - ptr) ||
+        point_offsets.back() != header.num_points_) {
+        utility::LogWarning("Read OPC failed: corrupted stream.");
+        return false;
+    }
+
+    const bool has_counts = (header.flags_ & kOPCHasCounts) != 0;
+    const bool has_colors = (header.flags_ & kOPCHasColors) != 0;
+    subtrees.clear();
+    subtrees.resize(header.num_subtrees_);
+    bool success = true;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int s = 0; s < (int)header.num_subtrees_; s++) {
+        OPCDecoder decoder(ptr + stream_offsets[s],
+                           stream_offsets[s + 1] - stream_offsets[s]);
+        OPCModel model;
+        OPCLeaves &leaves = subtrees[s];
+        const size_t num_points = point_offsets[s + 1] - point_offsets[s];
+        leaves.codes_.assign(1, nodes[s]);
+        std::vector<int> subtree_contexts(1, contexts[s]);
+        bool subtree_success = DecodeOPCOccupancy(
+                decoder, model, header.split_depth_, header.depth_,
+                num_points, leaves.codes_, subtree_contexts);
+        if (subtree_success && has_counts) {
+            leaves.counts_.resize(leaves.codes_.size());
+            size_t total = 0;
+            for (auto &count : leaves.counts_) {
+                count = DecodeOPCCount(decoder, model);
+                total += count;
+            }
+            subtree_success = total == num_points;
+        } else if (subtree_success) {
+            subtree_success = leaves.codes_.size() == num_points;
+        }
+        if (subtree_success && has_colors) {
+            // Colors are appended until the stream is exhausted, since
+            // num_points can be inflated when there are point counts.
+            std::array<std::uint8_t, 3> previous = {0, 0, 0};
+            for (size_t i = 0; i < num_points && !decoder.IsOverrun(); i++) {
+                std::array<std::uint8_t, 3> color;
+                for (int k = 0; k < 3; k++) {
+                    color[k] = (std::uint8_t)(
+                            previous[k] +
+                            DecodeOPCByte(decoder, model.color_[k]));
+                }
+                leaves.colors_.push_back(color);
+                previous = color;
+            }
+        }
+        if (!subtree_success || decoder.IsOverrun()) {
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+            success = false;
+        }
+    }
+    if (!success) {
+        utility::LogWarning("Read OPC failed: corrupted stream.");
+    }
+    return success;
+}
+
+/// Center of the leaf with the given Morton code.
+inline Eigen::Vector3d GetOPCLeafCenter(const OPCHeader &header,
+                                        std::uint64_t code) {
+    const double cell_size = header.size_ / (double)(1 << header.depth_);
+    return header.origin_ +
+           cell_size * Eigen::Vector3d(CompactMortonBits(code) + 0.5,
+                                       CompactMortonBits(code >> 1) + 0.5,
+                                       CompactMortonBits(code >> 2) + 0.5);
+}
+
+inline std::array<std::uint8_t, 3> QuantizeOPCColor(
+        const Eigen::Vector3d &color) {
+    std::array<std::uint8_t, 3> quantized;
+    for (int k = 0; k < 3; k++) {
+        quantized[k] = (std::uint8_t)std::round(
+                std::min(std::max(color(k), 0.0), 1.0) * 255.0);
+    }
+    return quantized;
+}
+
+inline Eigen::Vector3d DequantizeOPCColor(
+        const std::array<std::uint8_t, 3> &color) {
+    return Eigen::Vector3d(color[0], color[1], color[2]) / 255.0;
+}
+
+/// Collects the leaves of an octree in Morton order. Returns false if a leaf
+/// is not at the maximum depth.
+bool CollectOPCLeaves(const std::shared_ptr<geometry::OctreeNode> &node,
+                      std::uint64_t code,
+                      int depth,
+                      int max_depth,
+                      OPCLeaves &leaves) {
+    if (auto internal_node =
+                std::dynamic_pointer_cast<geometry::OctreeInternalNode>(
+                        node)) {
+        if (depth == max_depth) {
+            return false;
+        }
+        for (size_t i = 0; i < 8; i++) {
+            if (internal_node->children_[i] != nullptr &&
+                !CollectOPCLeaves(internal_node->children_[i], (code << 3) | i,
+                                  depth + 1, max_depth, leaves)) {
+                return false;
+            }
+        }
+        return true;
+    }
+    if (depth != max_depth) {
+        return false;
+    }
+    leaves.codes_.push_back(code);
+    if (auto color_node =
+                std::dynamic_pointer_cast<geometry::OctreeColorLeafNode>(
+                        node)) {
+        leaves.colors_.push_back(QuantizeOPCColor(color_node->color_));
+    }
+    return true;
+}
+
+}  // unnamed namespace
+
+namespace io {
+
+FileGeometry ReadFileGeometryTypeOPC(const std::string &path) {
+    return CONTAINS_POINTS;
+}
+
+bool EncodePointCloudToOPC(const geometry::PointCloud &pointcloud,
+                           std::vector<std::uint8_t> &buffer,
+                           const OctreeCompressionOption &option) {
+    if (option.depth_ < 0 || option.depth_ > kMortonBitsPerAxis) {
+        utility::LogWarning("Write OPC failed: depth must be in [0, {:d}].",
+                            kMortonBitsPerAxis);
+        return false;
+    }
+    OPCHeader header;
+    header.depth_ = option.depth_;
+    const int64_t num_points = (int64_t)pointcloud.points_.size();
+    if (num_points > 0) {
+        header.origin_ = pointcloud.GetMinBound();
+        header.size_ = std::max(
+                (pointcloud.GetMaxBound() - header.origin_).maxCoeff(), 1e-12);
+    }
+
+    // Sort the points by the Morton code of their leaf.
+    const std::uint64_t max_cell = (1 << header.depth_) - 1;
+    const double scale = (double)(1 << header.depth_) / header.size_;
+    std::vector<std::pair<std::uint64_t, size_t>> codes(num_points);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < (int)num_points; i++) {
+        std::uint64_t code = 0;
+        for (int k = 0; k < 3; k++) {
+            const double cell = std::floor(
+                    (pointcloud.points_[i](k) - header.origin_(k)) * scale);
+            code |= SpreadMortonBits((std::uint64_t)std::min(
+                            std::max(cell, 0.0), (double)max_cell))
+                    << k;
+        }
+        codes[i] = std::make_pair(code, (size_t)i);
+    }
+    // Sort by the nodes at depth 3 first, then every node in parallel.
+    const int bucket_depth = std::min(header.depth_, 3);
+    const int bucket_shift = 3 * (header.depth_ - bucket_depth);
+    std::vector<size_t> bucket_offsets((1 << (3 * bucket_depth)) + 1, 0);
+    for (const auto &code : codes) {
+        bucket_offsets[(code.first >> bucket_shift) + 1]++;
+    }
+    for (size_t b = 1; b < bucket_offsets.size(); b++) {
+        bucket_offsets[b] += bucket_offsets[b - 1];
+    }
+    std::vector<std::pair<std::uint64_t, size_t>> sorted_codes(num_points);
+    std::vector<size_t> bucket_positions(bucket_offsets.begin(),
+                                         bucket_offsets.end() - 1);
+    for (const auto &code : codes) {
+        sorted_codes[bucket_positions[code.first >> bucket_shift]++] = code;
+    }
+    codes.clear();
+    codes.shrink_to_fit();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int b = 0; b < (int)bucket_offsets.size() - 1; b++) {
+        std::sort(sorted_codes.begin() + bucket_offsets[b],
+                  sorted_codes.begin() + bucket_offsets[b + 1]);
+    }
+
+    OPCLeaves leaves;
+    std::vector<size_t> leaf_offsets;
+    for (size_t i = 0; i < sorted_codes.size(); i++) {
+        if (i == 0 || sorted_codes[i].first != sorted_codes[i - 1].first) {
+            leaves.codes_.push_back(sorted_codes[i].first);
+            leaf_offsets.push_back(i);
+        }
+    }
+    leaf_offsets.push_back(sorted_codes.size());
+    const int num_leaves = (int)leaves.codes_.size();
+    if (option.keep_duplicates_ && num_leaves < num_points) {
+        leaves.counts_.resize(num_leaves);
+        for (int i = 0; i < num_leaves; i++) {
+            leaves.counts_[i] =
+                    (std::uint32_t)(leaf_offsets[i + 1] - leaf_offsets[i]);
+        }
+    }
+    if (pointcloud.HasColors()) {
+        if (option.keep_duplicates_) {
+            leaves.colors_.resize(num_points);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+            for (int i = 0; i < (int)num_points; i++) {
+                leaves.colors_[i] = QuantizeOPCColor(
+                        pointcloud.colors_[sorted_codes[i].second]);
+            }
+        } else {
+            // Every leaf gets the average color of its points.
+            leaves.colors_.resize(num_leaves);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+            for (int i = 0; i < num_leaves; i++) {
+                Eigen::Vector3d color(0, 0, 0);
+                for (size_t j = leaf_offsets[i]; j < leaf_offsets[i + 1];
+                     j++) {
+                    color += pointcloud.colors_[sorted_codes[j].second];
+                }
+                leaves.colors_[i] = QuantizeOPCColor(
+                        color / double(leaf_offsets[i + 1] - leaf_offsets[i]));
+            }
+        }
+    }
+    EncodeOPC(leaves, header, buffer);
+    return true;
+}
+
+bool DecodePointCloudFromOPC(const std::uint8_t *buffer,
+                             size_t size,
+                             geometry::PointCloud &pointcloud) {
+    OPCHeader header;
+    std::vector<OPCLeaves> subtrees;
+    std::vector<size_t> point_offsets;
+    if (!DecodeOPC(buffer, size, header, subtrees, point_offsets)) {
+        return false;
+    }
+    const bool has_colors = (header.flags_ & kOPCHasColors) != 0;
+    pointcloud.Clear();
+    pointcloud.points_.resize(header.num_points_);
+    if (has_colors) {
+        pointcloud.colors_.resize(header.num_points_);
+    }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int s = 0; s < (int)subtrees.size(); s++) {
+        const OPCLeaves &leaves = subtrees[s];
+        size_t point = point_offsets[s];
+        for (size_t i = 0; i < leaves.codes_.size(); i++) {
+            const Eigen::Vector3d center =
+                    GetOPCLeafCenter(header, leaves.codes_[i]);
+            const size_t count = leaves.counts_.empty() ? 1 : leaves.counts_[i];
+            for (size_t j = 0; j < count; j++) {
+                pointcloud.points_[point++] = center;
+            }
+        }
+        for (size_t i = 0; i < leaves.colors_.size(); i++) {
+            pointcloud.colors_[point_offsets[s] + i] =
+                    DequantizeOPCColor(leaves.colors_[i]);
+        }
+    }
+    return true;
+}
+
+bool DecodePointCloudFromOPC(const std::vector<std::uint8_t> &buffer,
+                             geometry::PointCloud &pointcloud) {
+    return DecodePointCloudFromOPC(buffer.data(), buffer.size(), pointcloud);
+}
+
+bool EncodeOctreeToOPC(const geometry::Octree &octree,
+                       std::vector<std::uint8_t> &buffer) {
+    if (octree.max_depth_ > (size_t)kMortonBitsPerAxis) {
+        utility::LogWarning("Write OPC failed: depth must be in [0, {:d}].",
+                            kMortonBitsPerAxis);
+        return false;
+    }
+    OPCHeader header;
+    header.depth_ = (int)octree.max_depth_;
+    header.origin_ = octree.origin_;
+    header.size_ = octree.size_;
+    OPCLeaves leaves;
+    if (octree.root_node_ != nullptr &&
+        !CollectOPCLeaves(octree.root_node_, 0, 0, header.depth_, leaves)) {
+        utility::LogWarning(
+                "Write OPC failed: leaves must be at the maximum depth.");
+        return false;
+    }
+    if (!leaves.colors_.empty() &&
+        leaves.colors_.size() != leaves.codes_.size()) {
+        leaves.colors_.clear();
+    }
+    EncodeOPC(leaves, header, buffer);
+    return true;
+}
+
+bool DecodeOctreeFromOPC(const std::uint8_t *buffer,
+                         size_t size,
+                         geometry::Octree &octree) {
+    OPCHeader header;
+    std::vector<OPCLeaves> subtrees;
+    std::vector<size_t> point_offsets;
+    if (!DecodeOPC(buffer, size, header, subtrees, point_offsets)) {
+        return false;
+    }
+    // The subtrees are built in parallel and attached to the upper levels
+    // afterwards.
+    std::vector<std::shared_ptr<geometry::OctreeNode>> subtree_roots(
+            subtrees.size());
+    std::vector<std::uint64_t> subtree_codes(subtrees.size());
+    const int subtree_depth = header.depth_ - header.split_depth_;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int s = 0; s < (int)subtrees.size(); s++) {
+        const OPCLeaves &leaves = subtrees[s];
+        const std::vector<std::uint64_t> &codes = leaves.codes_;
+        subtree_codes[s] = codes[0] >> (3 * subtree_depth);
+        std::shared_ptr<geometry::OctreeNode> root;
+        size_t point = 0;
+        for (size_t i = 0; i < codes.size(); i++) {
+            auto leaf = std::make_shared<geometry::OctreeColorLeafNode>();
+            if (!leaves.colors_.empty()) {
+                leaf->color_ = DequantizeOPCColor(leaves.colors_[point]);
+            }
+            point += leaves.counts_.empty() ? 1 : leaves.counts_[i];
+            if (subtree_depth == 0) {
+                root = leaf;
+                continue;
+            }
+            if (root == nullptr) {
+                root = std::make_shared<geometry::OctreeInternalNode>();
+            }
+            auto node = std::static_pointer_cast<geometry::OctreeInternalNode>(
+                    root);
+            for (int d = subtree_depth - 1; d > 0; d--) {
+                auto &child = node->children_[(codes[i] >> (3 * d)) & 7];
+                if (child == nullptr) {
+                    child = std::make_shared<geometry::OctreeInternalNode>();
+                }
+                node = std::static_pointer_cast<geometry::OctreeInternalNode>(
+                        child);
+            }
+            node->children_[codes[i] & 7] = leaf;
+        }
+        subtree_roots[s] = root;
+    }
+    octree.Clear();
+    octree.origin_ = header.origin_;
+    octree.size_ = header.size_;
+    octree.max_depth_ = header.depth_;
+    for (size_t s = 0; s < subtree_roots.size(); s++) {
+        if (header.split_depth_ == 0) {
+            octree.root_node_ = subtree_roots[s];
+            continue;
+        }
+        if (octree.root_node_ == nullptr) {
+            octree.root_node_ =
+                    std::make_shared<geometry::OctreeInternalNode>();
+        }
+        auto node = std::static_pointer_cast<geometry::OctreeInternalNode>(
+                octree.root_node_);
+        for (int d = header.split_depth_ - 1; d > 0; d--) {
+            auto &child = node->children_[(subtree_codes[s] >> (3 * d)) & 7];
+            if (child == nullptr) {
+                child = std::make_shared<geometry::OctreeInternalNode>();
+            }
+            node = std::static_pointer_cast<geometry::OctreeInternalNode>(
+                    child);
+        }
+        node->children_[subtree_codes[s] & 7] = subtree_roots[s];
+    }
+    return true;
+}
+
+bool DecodeOctreeFromOPC(const std::vector<std::uint8_t> &buffer,
+                         geometry::Octree &octree) {
+    return DecodeOctreeFromOPC(buffer.data(), buffer.size(), octree);
+}
+
+bool ReadPointCloudFromOPC(const std::string &filename,
+                           geometry::PointCloud &pointcloud,
+                           bool print_progress) {
+    utility::filesystem::MappedFile file;
+    if (!file.Open(filename)) {
+        utility::LogWarning("Read OPC failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    const std::uint8_t *data =
+            reinterpret_cast<const std::uint8_t *>(file.Data());
+    return DecodePointCloudFromOPC(data, file.Size(), pointcloud);
+}
+
+bool WritePointCloudToOPC(const std::string &filename,
+                          const geometry::PointCloud &pointcloud,
+                          bool write_ascii /* = false*/,
+                          bool compressed /* = false*/,
+                          bool print_progress) {
+    return WritePointCloudToOPCWithOption(filename, pointcloud,
+                                          OctreeCompressionOption(),
+                                          print_progress);
+}
+
+bool WritePointCloudToOPCWithOption(const std::string &filename,
+                                    const geometry::PointCloud &pointcloud,
+                                    const OctreeCompressionOption &option,
+                                    bool print_progress) {
+    std::vector<std::uint8_t> buffer;
+    if (!EncodePointCloudToOPC(pointcloud, buffer, option)) {
+        return false;
+    }
+    FILE *file = utility::filesystem::FOpen(filename, "wb");
+    if (file == NULL) {
+        utility::LogWarning("Write OPC failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    bool success = fwrite(buffer.data(), 1, buffer.size(), file) ==
+                   buffer.size();
+    fclose(file);
+    if (!success) {
+        utility::LogWarning("Write OPC failed: unable to write file: {}",
+                            filename);
+    }
+    return success;
+}
+
+bool ReadOctreeFromOPC(const std::string &filename, geometry::Octree &octree) {
+    utility::filesystem::MappedFile file;
+    if (!file.Open(filename)) {
+        utility::LogWarning("Read OPC failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    const std::uint8_t *data =
+            reinterpret_cast<const std::uint8_t *>(file.Data());
+    return DecodeOctreeFromOPC(data, file.Size(), octree);
+}
+
+bool WriteOctreeToOPC(const std::string &filename,
+                      const geometry::Octree &octree) {
+    std::vector<std::uint8_t> buffer;
+    if (!EncodeOctreeToOPC(octree, buffer)) {
+        return false;
+    }
+    FILE *file = utility::filesystem::FOpen(filename, "wb");
+    if (file == NULL) {
+        utility::LogWarning("Write OPC failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    bool success = fwrite(buffer.data(), 1, buffer.size(), file) ==
+                   buffer.size();
+    fclose(file);
+    if (!success) {
+        utility::LogWarning("Write OPC failed: unable to write file: {}",
+                            filename);
+    }
+    return success;
+}
+
+}  // namespace io
+}  // namespace open3d
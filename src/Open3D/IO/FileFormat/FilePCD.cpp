@@ -28,6 +28,7 @@
 #include <cstdint>
 #include <cstdio>
 #include <sstream>
+#include <vector>
 
 #include "Open3D/IO/ClassIO/FileFormatIO.h"
 #include "Open3D/IO/ClassIO/PointCloudIO.h"
@@ -333,6 +334,122 @@ Eigen::Vector3d UnpackASCIIPCDColor(const char *data_ptr,
     }
 }
 
+// binary_compressed payloads are written as independently compressed blocks
+// of this many uncompressed bytes. The LZF streams of the blocks concatenate
+// into a single valid LZF stream, so PCL still reads the payload with one
+// lzf_decompress call, while we compress and decompress blocks in parallel.
+const std::uint32_t kPCDCompressionBlockSize = 1 << 20;
+// Number of blocks compressed in parallel before they are written, which
+// bounds the scratch memory of WritePCDData.
+const int kPCDCompressionBlocksPerBatch = 32;
+// Largest distance of an LZF back reference.
+const std::uint32_t kLZFMaxOffset = 1 << 13;
+
+struct LZFSegment {
+    std::uint32_t compressed_offset;
+    std::uint32_t uncompressed_offset;
+};
+
+/// Scans the tokens of an LZF stream and splits it close to every multiple of
+/// kPCDCompressionBlockSize at a token after which no back reference reaches
+/// into an earlier segment. The segments can then be decompressed
+/// independently. Streams written by WritePCDData split exactly at the block
+/// boundaries, streams from other writers split wherever it is possible.
+/// Returns false if the stream is corrupt.
+bool SplitLZFStream(const std::uint8_t *data,
+                    std::uint32_t compressed_size,
+                    std::uint32_t uncompressed_size,
+                    std::vector<LZFSegment> &segments) {
+    segments.assign(1, LZFSegment{0, 0});
+    std::uint32_t ip = 0;
+    std::uint32_t op = 0;
+    std::uint32_t next_split = kPCDCompressionBlockSize;
+    bool has_candidate = false;
+    LZFSegment candidate = {0, 0};
+    while (ip < compressed_size) {
+        if (has_candidate &&
+            op - candidate.uncompressed_offset >= kLZFMaxOffset) {
+            // No later token can reach back beyond the candidate.
+            segments.push_back(candidate);
+            has_candidate = false;
+            next_split = (candidate.uncompressed_offset /
+                                  kPCDCompressionBlockSize +
+                          1) * kPCDCompressionBlockSize;
+        }
+        if (!has_candidate && op >= next_split) {
+            has_candidate = true;
+            candidate = LZFSegment{ip, op};
+        }
+        std::uint32_t ctrl = data[ip++];
+        std::uint32_t length;
+        if (ctrl < (1 << 5)) {  // literal run
+            length = ctrl + 1;
+            if (length > compressed_size - ip) {
+                return false;
+            }
+            ip += length;
+        } else {  // back reference
+            length = ctrl >> 5;
+            if (ip >= compressed_size) {
+                return false;
+            }
+            if (length == 7) {
+                length += data[ip++];
+                if (ip >= compressed_size) {
+                    return false;
+                }
+            }
+            length += 2;
+            std::uint32_t offset = ((ctrl & 0x1f) << 8) + data[ip++] + 1;
+            if (offset > op) {
+                return false;
+            }
+            if (has_candidate && op - offset < candidate.uncompressed_offset) {
+                candidate = LZFSegment{ip, op + length};
+            }
+        }
+        if (length > uncompressed_size - op) {
+            return false;
+        }
+        op += length;
+    }
+    if (has_candidate && candidate.compressed_offset < compressed_size) {
+        segments.push_back(candidate);
+    }
+    return op == uncompressed_size;
+}
+
+bool DecompressPCDData(const char *compressed_data,
+                       std::uint32_t compressed_size,
+                       char *data,
+                       std::uint32_t uncompressed_size) {
+    std::vector<LZFSegment> segments;
+    if (!SplitLZFStream(reinterpret_cast<const std::uint8_t *>(compressed_data),
+                        compressed_size, uncompressed_size, segments)) {
+        return false;
+    }
+    utility::LogDebug("[ReadPCDData] Decompressing {:d} LZF segments.",
+                      segments.size());
+    segments.push_back(LZFSegment{compressed_size, uncompressed_size});
+    int num_failed = 0;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) reduction(+ : num_failed)
+#endif
+    for (int s = 0; s < (int)segments.size() - 1; s++) {
+        const LZFSegment &begin = segments[s];
+        const LZFSegment &end = segments[s + 1];
+        const unsigned int length =
+                end.uncompressed_offset - begin.uncompressed_offset;
+        if (lzf_decompress(compressed_data + begin.compressed_offset,
+                           end.compressed_offset - begin.compressed_offset,
+                           data + begin.uncompressed_offset,
+                           length) != length) {
+            num_failed++;
+        }
+    }
+    return num_failed == 0;
+}
+
 bool ReadPCDData(FILE *file,
                  const PCDHeader &header,
                  geometry::PointCloud &pointcloud) {
@@ -461,59 +578,51 @@ bool ReadPCDData(FILE *file,
             pointcloud.Clear();
             return false;
         }
+        if (uncompressed_size <
+            (std::uint64_t)header.pointsize * header.points) {
+            utility::LogWarning("[ReadPCDData] Invalid uncompressed size.");
+            pointcloud.Clear();
+            return false;
+        }
         std::unique_ptr<char[]> buffer(new char[uncompressed_size]);
-        if (lzf_decompress(buffer_compressed.get(),
-                           (unsigned int)compressed_size, buffer.get(),
-                           (unsigned int)uncompressed_size) !=
-            uncompressed_size) {
+        if (!DecompressPCDData(buffer_compressed.get(), compressed_size,
+                               buffer.get(), uncompressed_size)) {
             utility::LogWarning("[ReadPCDData] Uncompression failed.");
             pointcloud.Clear();
             return false;
         }
+        buffer_compressed.reset();
         for (const auto &field : header.fields) {
             const char *base_ptr = buffer.get() + field.offset * header.points;
-            if (field.name == "x") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.points_[i](0) = UnpackBinaryPCDElement(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
-            } else if (field.name == "y") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.points_[i](1) = UnpackBinaryPCDElement(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
-            } else if (field.name == "z") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.points_[i](2) = UnpackBinaryPCDElement(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
-            } else if (field.name == "normal_x") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.normals_[i](0) = UnpackBinaryPCDElement(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
-            } else if (field.name == "normal_y") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.normals_[i](1) = UnpackBinaryPCDElement(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
-            } else if (field.name == "normal_z") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.normals_[i](2) = UnpackBinaryPCDElement(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
-            } else if (field.name == "rgb" || field.name == "rgba") {
+            const int stride = field.size * field.count;
+            if (field.name == "rgb" || field.name == "rgba") {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
                 for (int i = 0; i < header.points; i++) {
                     pointcloud.colors_[i] = UnpackBinaryPCDColor(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
+                            base_ptr + i * stride, field.type, field.size);
                 }
+                continue;
+            }
+            std::vector<Eigen::Vector3d> *values = nullptr;
+            int component = 0;
+            if (field.name == "x" || field.name == "y" || field.name == "z") {
+                values = &pointcloud.points_;
+                component = field.name[0] - 'x';
+            } else if (field.name == "normal_x" || field.name == "normal_y" ||
+                       field.name == "normal_z") {
+                values = &pointcloud.normals_;
+                component = field.name[7] - 'x';
+            } else {
+                continue;
+            }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+            for (int i = 0; i < header.points; i++) {
+                (*values)[i](component) = UnpackBinaryPCDElement(
+                        base_ptr + i * stride, field.type, field.size);
             }
         }
     }
@@ -626,6 +735,124 @@ float ConvertRGBToFloat(const Eigen::Vector3d &color) {
     return value;
 }
 
+/// Fills \p block with the floats [begin, end) of the structure-of-arrays
+/// layout used by binary_compressed data.
+void FillPCDCompressedBlock(const PCDHeader &header,
+                            const geometry::PointCloud &pointcloud,
+                            std::uint32_t begin,
+                            std::uint32_t end,
+                            float *block) {
+    const std::uint32_t num_points = (std::uint32_t)header.points;
+    const bool has_normal = pointcloud.HasNormals();
+    std::uint32_t column = begin / num_points;
+    std::uint32_t i = begin % num_points;
+    for (std::uint32_t k = begin; k < end; k++) {
+        if (column < 3) {
+            block[k - begin] = (float)pointcloud.points_[i](column);
+        } else if (has_normal && column < 6) {
+            block[k - begin] = (float)pointcloud.normals_[i](column - 3);
+        } else {
+            block[k - begin] = ConvertRGBToFloat(pointcloud.colors_[i]);
+        }
+        if (++i == num_points) {
+            i = 0;
+            column++;
+        }
+    }
+}
+
+/// Compresses \p size bytes into \p compressed_data, which must hold at least
+/// size + size / 32 + 1 bytes. Data that LZF cannot shrink is stored as
+/// literal runs.
+std::uint32_t CompressPCDBlock(const char *data,
+                               std::uint32_t size,
+                               char *compressed_data,
+                               std::uint32_t compressed_capacity) {
+    std::uint32_t compressed_size =
+            lzf_compress(data, size, compressed_data, compressed_capacity);
+    if (compressed_size == 0) {
+        for (std::uint32_t pos = 0; pos < size; pos += 32) {
+            const std::uint32_t length = std::min(size - pos, 32u);
+            compressed_data[compressed_size++] = (char)(length - 1);
+            memcpy(compressed_data + compressed_size, data + pos, length);
+            compressed_size += length;
+        }
+    }
+    return compressed_size;
+}
+
+bool WritePCDCompressedData(FILE *file,
+                            const PCDHeader &header,
+                            const geometry::PointCloud &pointcloud) {
+    const std::uint64_t num_floats =
+            (std::uint64_t)header.elementnum * header.points;
+    if (num_floats * sizeof(float) > UINT32_MAX) {
+        utility::LogWarning(
+                "[WritePCDData] Point cloud is too large for binary_compressed "
+                "data.");
+        return false;
+    }
+    const std::uint32_t size_in_bytes =
+            (std::uint32_t)(num_floats * sizeof(float));
+    const std::uint32_t floats_per_block =
+            kPCDCompressionBlockSize / sizeof(float);
+    const int num_blocks =
+            (int)((num_floats + floats_per_block - 1) / floats_per_block);
+    const std::uint32_t compressed_capacity =
+            kPCDCompressionBlockSize + kPCDCompressionBlockSize / 32 + 1;
+
+    // The compressed size is only known at the end and patched afterwards.
+    const long size_position = ftell(file);
+    std::uint32_t size_compressed = 0;
+    if (size_position < 0 ||
+        fwrite(&size_compressed, sizeof(size_compressed), 1, file) != 1 ||
+        fwrite(&size_in_bytes, sizeof(size_in_bytes), 1, file) != 1) {
+        return false;
+    }
+
+    const int batch_size = std::min(num_blocks, kPCDCompressionBlocksPerBatch);
+    std::vector<std::vector<float>> blocks(batch_size);
+    std::vector<std::vector<char>> compressed_blocks(batch_size);
+    std::vector<std::uint32_t> compressed_sizes(batch_size);
+    for (int batch = 0; batch < num_blocks; batch += batch_size) {
+        const int num_batch_blocks = std::min(batch_size, num_blocks - batch);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+        for (int b = 0; b < num_batch_blocks; b++) {
+            const std::uint32_t begin = (batch + b) * floats_per_block;
+            const std::uint32_t end = (std::uint32_t)std::min<std::uint64_t>(
+                    num_floats, (std::uint64_t)begin + floats_per_block);
+            blocks[b].resize(floats_per_block);
+            compressed_blocks[b].resize(compressed_capacity);
+            FillPCDCompressedBlock(header, pointcloud, begin, end,
+                                   blocks[b].data());
+            compressed_sizes[b] = CompressPCDBlock(
+                    reinterpret_cast<const char *>(blocks[b].data()),
+                    (end - begin) * sizeof(float),
+                    compressed_blocks[b].data(), compressed_capacity);
+        }
+        for (int b = 0; b < num_batch_blocks; b++) {
+            if (fwrite(compressed_blocks[b].data(), 1, compressed_sizes[b],
+                       file) != compressed_sizes[b]) {
+                return false;
+            }
+            size_compressed += compressed_sizes[b];
+        }
+    }
+    utility::LogDebug(
+            "[WritePCDData] {:d} bytes data compressed into {:d} bytes.",
+            size_in_bytes, size_compressed);
+
+    const long end_position = ftell(file);
+    if (fseek(file, size_position, SEEK_SET) != 0 ||
+        fwrite(&size_compressed, sizeof(size_compressed), 1, file) != 1 ||
+        fseek(file, end_position, SEEK_SET) != 0) {
+        return false;
+    }
+    return true;
+}
+
 bool WritePCDData(FILE *file,
                   const PCDHeader &header,
                   const geometry::PointCloud &pointcloud) {
@@ -668,43 +895,7 @@ bool WritePCDData(FILE *file,
             fwrite(data.get(), sizeof(float), header.elementnum, file);
         }
     } else if (header.datatype == PCD_DATA_BINARY_COMPRESSED) {
-        int strip_size = header.points;
-        std::uint32_t buffer_size =
-                (std::uint32_t)(header.elementnum * header.points);
-        std::unique_ptr<float[]> buffer(new float[buffer_size]);
-        std::unique_ptr<float[]> buffer_compressed(new float[buffer_size * 2]);
-        for (size_t i = 0; i < pointcloud.points_.size(); i++) {
-            const auto &point = pointcloud.points_[i];
-            buffer[0 * strip_size + i] = (float)point(0);
-            buffer[1 * strip_size + i] = (float)point(1);
-            buffer[2 * strip_size + i] = (float)point(2);
-            int idx = 3;
-            if (has_normal) {
-                const auto &normal = pointcloud.normals_[i];
-                buffer[(idx + 0) * strip_size + i] = (float)normal(0);
-                buffer[(idx + 1) * strip_size + i] = (float)normal(1);
-                buffer[(idx + 2) * strip_size + i] = (float)normal(2);
-                idx += 3;
-            }
-            if (has_color) {
-                const auto &color = pointcloud.colors_[i];
-                buffer[idx * strip_size + i] = ConvertRGBToFloat(color);
-            }
-        }
-        std::uint32_t buffer_size_in_bytes = buffer_size * sizeof(float);
-        std::uint32_t size_compressed =
-                lzf_compress(buffer.get(), buffer_size_in_bytes,
-                             buffer_compressed.get(), buffer_size_in_bytes * 2);
-        if (size_compressed == 0) {
-            utility::LogWarning("[WritePCDData] Failed to compress data.");
-            return false;
-        }
-        utility::LogDebug(
-                "[WritePCDData] {:d} bytes data compressed into {:d} bytes.",
-                buffer_size_in_bytes, size_compressed);
-        fwrite(&size_compressed, sizeof(size_compressed), 1, file);
-        fwrite(&buffer_size_in_bytes, sizeof(buffer_size_in_bytes), 1, file);
-        fwrite(buffer_compressed.get(), 1, size_compressed, file);
+        return WritePCDCompressedData(file, header, pointcloud);
     }
     return true;
 }
@@ -25,6 +25,10 @@
 // ----------------------------------------------------------------------------
 
 #include <rply/rply.h>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <sstream>
 
 #include "Open3D/IO/ClassIO/FileFormatIO.h"
 #include "Open3D/IO/ClassIO/LineSetIO.h"
@@ -32,6 +36,7 @@
 #include "Open3D/IO/ClassIO/TriangleMeshIO.h"
 #include "Open3D/IO/ClassIO/VoxelGridIO.h"
 #include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/MappedFile.h"
 
 namespace open3d {
 
@@ -352,6 +357,468 @@ int ReadColorCallback(p_ply_argument argument) {
 
 }  // namespace ply_voxelgrid_reader
 
+namespace ply_binary_reader {
+
+// Fast path for binary_little_endian files whose vertex records have a fixed
+// size and whose faces are all triangles. The data block is memory-mapped and
+// the records are converted in parallel instead of going through one rply
+// callback per value. Anything else is left to the rply readers above.
+
+enum class PLYScalarType {
+    Invalid,
+    Int8,
+    UInt8,
+    Int16,
+    UInt16,
+    Int32,
+    UInt32,
+    Float32,
+    Float64
+};
+
+PLYScalarType GetPLYScalarType(const std::string &name) {
+    if (name == "int8" || name == "char") return PLYScalarType::Int8;
+    if (name == "uint8" || name == "uchar") return PLYScalarType::UInt8;
+    if (name == "int16" || name == "short") return PLYScalarType::Int16;
+    if (name == "uint16" || name == "ushort") return PLYScalarType::UInt16;
+    if (name == "int32" || name == "int") return PLYScalarType::Int32;
+    if (name == "uint32" || name == "uint") return PLYScalarType::UInt32;
+    if (name == "float32" || name == "float") return PLYScalarType::Float32;
+    if (name == "float64" || name == "double") return PLYScalarType::Float64;
+    return PLYScalarType::Invalid;
+}
+
+size_t GetPLYScalarSize(PLYScalarType type) {
+    switch (type) {
+        case PLYScalarType::Int8:
+        case PLYScalarType::UInt8:
+            return 1;
+        case PLYScalarType::Int16:
+        case PLYScalarType::UInt16:
+            return 2;
+        case PLYScalarType::Int32:
+        case PLYScalarType::UInt32:
+        case PLYScalarType::Float32:
+            return 4;
+        case PLYScalarType::Float64:
+            return 8;
+        default:
+            return 0;
+    }
+}
+
+template <typename T>
+inline double LoadPLYScalar(const char *ptr) {
+    T value;
+    std::memcpy(&value, ptr, sizeof(T));
+    return static_cast<double>(value);
+}
+
+inline double ReadPLYScalar(const char *ptr, PLYScalarType type) {
+    switch (type) {
+        case PLYScalarType::Int8:
+            return LoadPLYScalar<int8_t>(ptr);
+        case PLYScalarType::UInt8:
+            return LoadPLYScalar<uint8_t>(ptr);
+        case PLYScalarType::Int16:
+            return LoadPLYScalar<int16_t>(ptr);
+        case PLYScalarType::UInt16:
+            return LoadPLYScalar<uint16_t>(ptr);
+        case PLYScalarType::Int32:
+            return LoadPLYScalar<int32_t>(ptr);
+        case PLYScalarType::UInt32:
+            return LoadPLYScalar<uint32_t>(ptr);
+        case PLYScalarType::Float32:
+            return LoadPLYScalar<float>(ptr);
+        case PLYScalarType::Float64:
+            return LoadPLYScalar<double>(ptr);
+        default:
+            return 0.0;
+    }
+}
+
+struct PLYProperty {
+    std::string name_;
+    PLYScalarType type_ = PLYScalarType::Invalid;
+    bool is_list_ = false;
+    PLYScalarType length_type_ = PLYScalarType::Invalid;
+    /// Byte offset of the property inside a fixed-size record.
+    size_t offset_ = 0;
+};
+
+struct PLYElement {
+    std::string name_;
+    size_t count_ = 0;
+    std::vector<PLYProperty> properties_;
+    /// Record size in bytes, 0 if the element contains list properties.
+    size_t stride_ = 0;
+    /// Byte offset of the first record in the file, valid if located_.
+    size_t offset_ = 0;
+    bool located_ = false;
+
+    const PLYProperty *FindProperty(const std::string &name) const {
+        for (const auto &property : properties_) {
+            if (property.name_ == name) {
+                return &property;
+            }
+        }
+        return nullptr;
+    }
+};
+
+bool IsLittleEndianHost() {
+    const uint16_t one = 1;
+    uint8_t first_byte;
+    std::memcpy(&first_byte, &one, 1);
+    return first_byte == 1;
+}
+
+/// Returns the face element if it only holds a vertex index list, nullptr
+/// otherwise.
+const PLYProperty *GetFaceIndexProperty(const PLYElement &element) {
+    if (element.name_ != "face" || element.properties_.size() != 1) {
+        return nullptr;
+    }
+    const PLYProperty &property = element.properties_[0];
+    if (!property.is_list_ || (property.name_ != "vertex_indices" &&
+                               property.name_ != "vertex_index")) {
+        return nullptr;
+    }
+    return &property;
+}
+
+/// Checks that all faces of \p element starting at \p offset are triangles,
+/// i.e. that the face records have a fixed size.
+bool IsTriangleFaceBlock(const char *data,
+                         size_t size,
+                         size_t offset,
+                         const PLYElement &element) {
+    const PLYProperty &property = element.properties_[0];
+    const size_t stride = GetPLYScalarSize(property.length_type_) +
+                          3 * GetPLYScalarSize(property.type_);
+    if (element.count_ > (size - offset) / stride) {
+        return false;
+    }
+    const char *begin = data + offset;
+    const int64_t count = static_cast<int64_t>(element.count_);
+    int num_invalid = 0;
+#ifdef _OPENMP
+#pragma omp parallel for reduction(+ : num_invalid)
+#endif
+    for (int64_t i = 0; i < count; i++) {
+        if (ReadPLYScalar(begin + i * stride, property.length_type_) != 3.0) {
+            num_invalid++;
+        }
+    }
+    return num_invalid == 0;
+}
+
+/// Parses the header of a binary_little_endian PLY file and locates the
+/// elements whose position in the data block is known. Returns false if the
+/// file is not handled by the fast path.
+bool ParsePLYBinaryLayout(const char *data,
+                          size_t size,
+                          std::vector<PLYElement> &elements) {
+    if (data == nullptr || !IsLittleEndianHost()) {
+        return false;
+    }
+    elements.clear();
+    size_t pos = 0;
+    size_t line_num = 0;
+    bool is_binary_little_endian = false;
+    bool end_header = false;
+    while (pos < size && !end_header) {
+        const char *line_begin = data + pos;
+        const char *line_end = static_cast<const char *>(
+                std::memchr(line_begin, '\n', size - pos));
+        if (line_end == nullptr) {
+            return false;
+        }
+        pos = line_end - data + 1;
+        std::istringstream line(std::string(line_begin, line_end));
+        std::string keyword;
+        line >> keyword;
+        if (line_num++ == 0) {
+            if (keyword != "ply") {
+                return false;
+            }
+        } else if (keyword == "format") {
+            std::string format;
+            line >> format;
+            is_binary_little_endian = (format == "binary_little_endian");
+        } else if (keyword == "element") {
+            PLYElement element;
+            line >> element.name_ >> element.count_;
+            if (line.fail()) {
+                return false;
+            }
+            elements.push_back(element);
+        } else if (keyword == "property") {
+            if (elements.empty()) {
+                return false;
+            }
+            PLYProperty property;
+            std::string type;
+            line >> type;
+            if (type == "list") {
+                std::string length_type, value_type;
+                line >> length_type >> value_type;
+                property.is_list_ = true;
+                property.length_type_ = GetPLYScalarType(length_type);
+                property.type_ = GetPLYScalarType(value_type);
+                if (property.length_type_ == PLYScalarType::Invalid) {
+                    return false;
+                }
+            } else {
+                property.type_ = GetPLYScalarType(type);
+            }
+            line >> property.name_;
+            if (line.fail() || property.type_ == PLYScalarType::Invalid) {
+                return false;
+            }
+            elements.back().properties_.push_back(property);
+        } else if (keyword == "end_header") {
+            end_header = true;
+        } else if (keyword != "comment" && keyword != "obj_info") {
+            return false;
+        }
+    }
+    if (!end_header || !is_binary_little_endian) {
+        return false;
+    }
+
+    size_t offset = pos;
+    for (auto &element : elements) {
+        size_t stride = 0;
+        for (auto &property : element.properties_) {
+            if (property.is_list_) {
+                stride = 0;
+                break;
+            }
+            property.offset_ = stride;
+            stride += GetPLYScalarSize(property.type_);
+        }
+        element.stride_ = stride;
+        if (stride == 0) {
+            if (GetFaceIndexProperty(element) == nullptr ||
+                !IsTriangleFaceBlock(data, size, offset, element)) {
+                // Records of list elements have a variable size, the elements
+                // behind this one cannot be located.
+                break;
+            }
+            const PLYProperty &property = element.properties_[0];
+            stride = GetPLYScalarSize(property.length_type_) +
+                     3 * GetPLYScalarSize(property.type_);
+        } else if (element.count_ > (size - offset) / stride) {
+            break;
+        }
+        element.offset_ = offset;
+        element.located_ = true;
+        offset += element.count_ * stride;
+    }
+    return true;
+}
+
+const PLYElement *FindElement(const std::vector<PLYElement> &elements,
+                              const std::string &name) {
+    for (const auto &element : elements) {
+        if (element.name_ == name) {
+            return &element;
+        }
+    }
+    return nullptr;
+}
+
+/// Looks up the three scalar properties \p names of \p element. Returns false
+/// if only some of them exist, in which case the file is left to rply.
+bool FindVectorProperties(const PLYElement &element,
+                          const std::array<std::string, 3> &names,
+                          std::array<const PLYProperty *, 3> &properties) {
+    int num_found = 0;
+    for (int i = 0; i < 3; i++) {
+        properties[i] = element.FindProperty(names[i]);
+        num_found += properties[i] != nullptr ? 1 : 0;
+    }
+    return num_found == 0 || num_found == 3;
+}
+
+const int64_t kNumRecordsPerBlock = 1 << 16;
+
+int64_t GetNumRecordBlocks(size_t count) {
+    return (static_cast<int64_t>(count) + kNumRecordsPerBlock - 1) /
+           kNumRecordsPerBlock;
+}
+
+/// Calls read_record(record_ptr, index) for every record of \p element,
+/// blocks of records are processed in parallel.
+template <typename ReadRecord>
+void ReadPLYRecords(const char *data,
+                    const PLYElement &element,
+                    size_t stride,
+                    ReadRecord read_record,
+                    utility::ConsoleProgressBar &progress_bar) {
+    const char *begin = data + element.offset_;
+    const int64_t count = static_cast<int64_t>(element.count_);
+    const int64_t num_blocks = GetNumRecordBlocks(element.count_);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int64_t b = 0; b < num_blocks; b++) {
+        const int64_t end = std::min(count, (b + 1) * kNumRecordsPerBlock);
+        for (int64_t i = b * kNumRecordsPerBlock; i < end; i++) {
+            read_record(begin + i * stride, i);
+        }
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+        ++progress_bar;
+    }
+}
+
+void ReadPLYVectors(const char *data,
+                    const PLYElement &element,
+                    const std::array<const PLYProperty *, 3> &properties,
+                    double scale,
+                    std::vector<Eigen::Vector3d> &values,
+                    utility::ConsoleProgressBar &progress_bar) {
+    values.resize(element.count_);
+    const PLYProperty &p0 = *properties[0];
+    const PLYProperty &p1 = *properties[1];
+    const PLYProperty &p2 = *properties[2];
+    ReadPLYRecords(
+            data, element, element.stride_,
+            [&](const char *record, int64_t i) {
+                values[i](0) = ReadPLYScalar(record + p0.offset_, p0.type_) *
+                               scale;
+                values[i](1) = ReadPLYScalar(record + p1.offset_, p1.type_) *
+                               scale;
+                values[i](2) = ReadPLYScalar(record + p2.offset_, p2.type_) *
+                               scale;
+            },
+            progress_bar);
+}
+
+/// Vertex attributes shared by the point cloud and triangle mesh readers.
+struct PLYVertexLayout {
+    const PLYElement *vertex_ = nullptr;
+    std::array<const PLYProperty *, 3> points_;
+    std::array<const PLYProperty *, 3> normals_;
+    std::array<const PLYProperty *, 3> colors_;
+};
+
+bool GetPLYVertexLayout(const std::vector<PLYElement> &elements,
+                        PLYVertexLayout &layout) {
+    layout.vertex_ = FindElement(elements, "vertex");
+    if (layout.vertex_ == nullptr || !layout.vertex_->located_ ||
+        layout.vertex_->count_ == 0) {
+        return false;
+    }
+    return FindVectorProperties(*layout.vertex_, {"x", "y", "z"},
+                                layout.points_) &&
+           layout.points_[0] != nullptr &&
+           FindVectorProperties(*layout.vertex_, {"nx", "ny", "nz"},
+                                layout.normals_) &&
+           FindVectorProperties(*layout.vertex_, {"red", "green", "blue"},
+                                layout.colors_);
+}
+
+void ReadPLYVertices(const char *data,
+                     const PLYVertexLayout &layout,
+                     std::vector<Eigen::Vector3d> &points,
+                     std::vector<Eigen::Vector3d> &normals,
+                     std::vector<Eigen::Vector3d> &colors,
+                     utility::ConsoleProgressBar &progress_bar) {
+    ReadPLYVectors(data, *layout.vertex_, layout.points_, 1.0, points,
+                   progress_bar);
+    if (layout.normals_[0] != nullptr) {
+        ReadPLYVectors(data, *layout.vertex_, layout.normals_, 1.0, normals,
+                       progress_bar);
+    }
+    if (layout.colors_[0] != nullptr) {
+        ReadPLYVectors(data, *layout.vertex_, layout.colors_, 1.0 / 255.0,
+                       colors, progress_bar);
+    }
+}
+
+int64_t GetNumVertexBlocks(const PLYVertexLayout &layout) {
+    const int64_t num_attributes = 1 +
+                                   (layout.normals_[0] != nullptr ? 1 : 0) +
+                                   (layout.colors_[0] != nullptr ? 1 : 0);
+    return num_attributes * GetNumRecordBlocks(layout.vertex_->count_);
+}
+
+/// Returns false if the file has to be read by rply.
+bool ReadPointCloud(const std::string &filename,
+                    geometry::PointCloud &pointcloud,
+                    bool print_progress) {
+    utility::filesystem::MappedFile file;
+    std::vector<PLYElement> elements;
+    PLYVertexLayout layout;
+    if (!file.Open(filename) ||
+        !ParsePLYBinaryLayout(file.Data(), file.Size(), elements) ||
+        !GetPLYVertexLayout(elements, layout)) {
+        return false;
+    }
+
+    pointcloud.Clear();
+    utility::ConsoleProgressBar progress_bar(
+            static_cast<size_t>(GetNumVertexBlocks(layout)), "Reading PLY: ",
+            print_progress);
+    ReadPLYVertices(file.Data(), layout, pointcloud.points_,
+                    pointcloud.normals_, pointcloud.colors_, progress_bar);
+    return true;
+}
+
+/// Returns false if the file has to be read by rply.
+bool ReadTriangleMesh(const std::string &filename,
+                      geometry::TriangleMesh &mesh,
+                      bool print_progress) {
+    utility::filesystem::MappedFile file;
+    std::vector<PLYElement> elements;
+    PLYVertexLayout layout;
+    if (!file.Open(filename) ||
+        !ParsePLYBinaryLayout(file.Data(), file.Size(), elements) ||
+        !GetPLYVertexLayout(elements, layout)) {
+        return false;
+    }
+    const PLYElement *face = FindElement(elements, "face");
+    const PLYProperty *indices = nullptr;
+    if (face != nullptr) {
+        indices = GetFaceIndexProperty(*face);
+        if (indices == nullptr || !face->located_) {
+            return false;
+        }
+    }
+
+    mesh.Clear();
+    const int64_t num_face_blocks =
+            face != nullptr ? GetNumRecordBlocks(face->count_) : 0;
+    utility::ConsoleProgressBar progress_bar(
+            static_cast<size_t>(GetNumVertexBlocks(layout) + num_face_blocks),
+            "Reading PLY: ", print_progress);
+    ReadPLYVertices(file.Data(), layout, mesh.vertices_, mesh.vertex_normals_,
+                    mesh.vertex_colors_, progress_bar);
+    if (face != nullptr) {
+        const size_t length_size = GetPLYScalarSize(indices->length_type_);
+        const size_t index_size = GetPLYScalarSize(indices->type_);
+        const PLYScalarType index_type = indices->type_;
+        mesh.triangles_.resize(face->count_);
+        ReadPLYRecords(
+                file.Data(), *face, length_size + 3 * index_size,
+                [&](const char *record, int64_t i) {
+                    const char *ptr = record + length_size;
+                    for (int k = 0; k < 3; k++, ptr += index_size) {
+                        mesh.triangles_[i](k) =
+                                int(ReadPLYScalar(ptr, index_type));
+                    }
+                },
+                progress_bar);
+    }
+    return true;
+}
+
+}  // namespace ply_binary_reader
+
 }  // unnamed namespace
 
 namespace io {
@@ -394,6 +861,11 @@ bool ReadPointCloudFromPLY(const std::string &filename,
                            bool print_progress) {
     using namespace ply_pointcloud_reader;
 
+    if (ply_binary_reader::ReadPointCloud(filename, pointcloud,
+                                          print_progress)) {
+        return true;
+    }
+
     p_ply ply_file = ply_open(filename.c_str(), NULL, 0, NULL);
     if (!ply_file) {
         utility::LogWarning("Read PLY failed: unable to open file: {}",
@@ -538,6 +1010,10 @@ bool ReadTriangleMeshFromPLY(const std::string &filename,
                              bool print_progress) {
     using namespace ply_trianglemesh_reader;
 
+    if (ply_binary_reader::ReadTriangleMesh(filename, mesh, print_progress)) {
+        return true;
+    }
+
     p_ply ply_file = ply_open(filename.c_str(), NULL, 0, NULL);
     if (!ply_file) {
         utility::LogWarning("Read PLY failed: unable to open file: {}",
@@ -25,11 +25,14 @@
 // ----------------------------------------------------------------------------
 
 #include <cstdio>
+#include <cstring>
+#include <iterator>
 #include "Open3D/IO/ClassIO/FileFormatIO.h"
 #include "Open3D/IO/ClassIO/PointCloudIO.h"
+#include "Open3D/IO/FileFormat/ASCIIHelper.h"
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/FileSystem.h"
-#include "Open3D/Utility/Helper.h"
+#include "Open3D/Utility/MappedFile.h"
 
 namespace open3d {
 namespace io {
@@ -41,60 +44,100 @@ FileGeometry ReadFileGeometryTypePTS(const std::string &path) {
 bool ReadPointCloudFromPTS(const std::string &filename,
                            geometry::PointCloud &pointcloud,
                            bool print_progress) {
-    FILE *file = utility::filesystem::FOpen(filename, "r");
-    if (file == NULL) {
+    utility::filesystem::MappedFile file;
+    if (!file.Open(filename)) {
         utility::LogWarning("Read PTS failed: unable to open file.");
         return false;
     }
-    char line_buffer[DEFAULT_IO_BUFFER_SIZE];
+    const char *data = file.Data();
+    const char *data_end = data + file.Size();
+
+    // The header is the number of points.
+    const char *header_end = data;
+    if (data < data_end) {
+        header_end = static_cast<const char *>(
+                std::memchr(data, '\n', file.Size()));
+        header_end = (header_end == nullptr) ? data_end : header_end + 1;
+    }
+    double num_of_pts_value = 0.0;
     size_t num_of_pts = 0;
-    int num_of_fields = 0;
-    if (fgets(line_buffer, DEFAULT_IO_BUFFER_SIZE, file)) {
-        sscanf(line_buffer, "%zu", &num_of_pts);
+    if (ParseASCIIDouble(data, header_end, num_of_pts_value) != nullptr &&
+        num_of_pts_value > 0.0) {
+        num_of_pts = (size_t)num_of_pts_value;
     }
     if (num_of_pts <= 0) {
         utility::LogWarning("Read PTS failed: unable to read header.");
-        fclose(file);
         return false;
     }
-    utility::ConsoleProgressBar progress_bar(num_of_pts,
-                                             "Reading PTS: ", print_progress);
-    size_t idx = 0;
-    while (idx < num_of_pts &&
-           fgets(line_buffer, DEFAULT_IO_BUFFER_SIZE, file)) {
-        if (num_of_fields == 0) {
-            std::vector<std::string> st;
-            utility::SplitString(st, line_buffer, " ");
-            num_of_fields = (int)st.size();
-            if (num_of_fields < 3) {
-                utility::LogWarning(
-                        "Read PTS failed: insufficient data fields.");
-                fclose(file);
-                return false;
-            }
-            pointcloud.points_.resize(num_of_pts);
-            if (num_of_fields >= 7) {
-                // X Y Z I R G B
-                pointcloud.colors_.resize(num_of_pts);
-            }
+
+    // The fields of the first line decide between X Y Z [...] and
+    // X Y Z I R G B.
+    const char *first_line_end = header_end;
+    if (header_end < data_end) {
+        first_line_end = static_cast<const char *>(
+                std::memchr(header_end, '\n', data_end - header_end));
+        if (first_line_end == nullptr) {
+            first_line_end = data_end;
         }
-        double x, y, z;
-        int i, r, g, b;
-        if (num_of_fields < 7) {
-            if (sscanf(line_buffer, "%lf %lf %lf", &x, &y, &z) == 3) {
-                pointcloud.points_[idx] = Eigen::Vector3d(x, y, z);
-            }
-        } else {
-            if (sscanf(line_buffer, "%lf %lf %lf %d %d %d %d", &x, &y, &z, &i,
-                       &r, &g, &b) == 7) {
-                pointcloud.points_[idx] = Eigen::Vector3d(x, y, z);
-                pointcloud.colors_[idx] = Eigen::Vector3d(r, g, b) / 255.0;
-            }
+    }
+    int num_of_fields = 0;
+    double value;
+    for (const char *p = header_end;
+         (p = ParseASCIIDouble(p, first_line_end, value)) != nullptr;) {
+        num_of_fields++;
+    }
+    if (num_of_fields < 3) {
+        utility::LogWarning("Read PTS failed: insufficient data fields.");
+        return false;
+    }
+    const bool has_colors = (num_of_fields >= 7);
+
+    // Only the number of points given in the header is read.
+    std::vector<ASCIIChunk> chunks =
+            SplitASCIIChunks(header_end, data_end - header_end);
+    while (!chunks.empty() && chunks.back().line_offset_ >= num_of_pts) {
+        chunks.pop_back();
+    }
+    if (CountASCIILines(chunks) > num_of_pts) {
+        ASCIIChunk &chunk = chunks.back();
+        chunk.num_lines_ = num_of_pts - chunk.line_offset_;
+        const char *line = chunk.begin_;
+        for (size_t i = 0; i < chunk.num_lines_; i++) {
+            line = static_cast<const char *>(
+                           std::memchr(line, '\n', chunk.end_ - line)) +
+                   1;
         }
-        idx++;
-        ++progress_bar;
+        chunk.end_ = line;
     }
-    fclose(file);
+
+    // Lines that fail to parse are kept as points at the origin (without
+    // color), so that point indices match the line numbers of the file.
+    size_t num_lines = CountASCIILines(chunks);
+    pointcloud.points_.resize(num_lines);
+    if (has_colors) {
+        pointcloud.colors_.resize(num_lines);
+    }
+    utility::ConsoleProgressBar progress_bar(chunks.size(), "Reading PTS: ",
+                                             print_progress);
+    ParseASCIILines(
+            chunks,
+            [&](const char *begin, const char *end, size_t i) {
+                double v[7];
+                if (!ParseASCIIDoubles(begin, end, v, has_colors ? 7 : 3)) {
+                    pointcloud.points_[i].setZero();
+                    if (has_colors) {
+                        pointcloud.colors_[i].setZero();
+                    }
+                    return true;
+                }
+                pointcloud.points_[i] = Eigen::Vector3d(v[0], v[1], v[2]);
+                if (has_colors) {
+                    pointcloud.colors_[i] =
+                            Eigen::Vector3d(v[4], v[5], v[6]) / 255.0;
+                }
+                return true;
+            },
+            [](size_t from, size_t to) {}, &progress_bar);
     return true;
 }
 
@@ -109,23 +152,36 @@ bool WritePointCloudToPTS(const std::string &filename,
         return false;
     }
     fprintf(file, "%zu\r\n", (size_t)pointcloud.points_.size());
-    utility::ConsoleProgressBar progress_bar(
-            static_cast<size_t>(pointcloud.points_.size()),
-            "Writing PTS: ", print_progress);
-    for (size_t i = 0; i < pointcloud.points_.size(); i++) {
-        const auto &point = pointcloud.points_[i];
-        if (pointcloud.HasColors() == false) {
-            fprintf(file, "%.10f %.10f %.10f\r\n", point(0), point(1),
-                    point(2));
-        } else {
-            const auto &color = pointcloud.colors_[i] * 255.0;
-            fprintf(file, "%.10f %.10f %.10f %d %d %d %d\r\n", point(0),
-                    point(1), point(2), 0, (int)color(0), (int)color(1),
-                    (int)(color(2)));
-        }
-        ++progress_bar;
-    }
+    const size_t num_blocks =
+            (pointcloud.points_.size() + GetNumASCIILinesPerBlock() - 1) /
+            GetNumASCIILinesPerBlock();
+    utility::ConsoleProgressBar progress_bar(num_blocks, "Writing PTS: ",
+                                             print_progress);
+    const bool has_colors = pointcloud.HasColors();
+    bool is_success = WriteASCIILines(
+            file, pointcloud.points_.size(),
+            [&](size_t i, std::string &buffer) {
+                const auto &point = pointcloud.points_[i];
+                if (!has_colors) {
+                    fmt::format_to(std::back_inserter(buffer),
+                                   "{:.10f} {:.10f} {:.10f}\r\n", point(0),
+                                   point(1), point(2));
+                } else {
+                    const auto &color = pointcloud.colors_[i] * 255.0;
+                    fmt::format_to(std::back_inserter(buffer),
+                                   "{:.10f} {:.10f} {:.10f} {:d} {:d} {:d} "
+                                   "{:d}\r\n",
+                                   point(0), point(1), point(2), 0,
+                                   (int)color(0), (int)color(1),
+                                   (int)(color(2)));
+                }
+            },
+            &progress_bar);
     fclose(file);
+    if (!is_success) {
+        utility::LogWarning("Write PTS failed: unable to write file.");
+        return false;
+    }
     return true;
 }
 
@@ -24,6 +24,9 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <vector>
 
@@ -31,8 +34,70 @@
 #include "Open3D/IO/ClassIO/TriangleMeshIO.h"
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/FileSystem.h"
+#include "Open3D/Utility/Helper.h"
+#include "Open3D/Utility/MappedFile.h"
 
 namespace open3d {
+
+namespace {
+
+// Binary STL: an 80 byte header, the uint32 number of triangles, and one
+// 50 byte record per triangle with the float32 normal, the three float32
+// corners and a uint16 attribute.
+const size_t kSTLHeaderSize = 84;
+const size_t kSTLRecordSize = 50;
+
+typedef Eigen::Matrix<std::uint32_t, 3, 1> STLVertexKey;
+
+/// Bit pattern of a corner position, with -0 and 0 merged.
+STLVertexKey GetSTLVertexKey(const Eigen::Vector3f &position) {
+    STLVertexKey key;
+    for (int k = 0; k < 3; k++) {
+        const float value = position(k) == 0.0f ? 0.0f : position(k);
+        memcpy(&key(k), &value, sizeof(float));
+    }
+    return key;
+}
+
+/// \brief Welds the corners of STL triangles with equal positions.
+///
+/// The first corner of each position is found in parallel by
+/// utility::FindFirstOccurrences. Vertices are numbered in the order of their
+/// first corner, so the result does not depend on the number of threads.
+void WeldSTLVertices(const std::vector<Eigen::Vector3f> &corners,
+                     geometry::TriangleMesh &mesh) {
+    const int num_corners = (int)corners.size();
+    std::vector<STLVertexKey> keys(num_corners);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int c = 0; c < num_corners; c++) {
+        keys[c] = GetSTLVertexKey(corners[c]);
+    }
+    const std::vector<int> first_corners = utility::FindFirstOccurrences(
+            keys, std::vector<std::uint8_t>(num_corners, 1));
+
+    std::vector<int> vertex_indices(num_corners);
+    int num_vertices = 0;
+    for (int c = 0; c < num_corners; c++) {
+        vertex_indices[c] = first_corners[c] == c
+                                    ? num_vertices++
+                                    : vertex_indices[first_corners[c]];
+    }
+    mesh.vertices_.resize(num_vertices);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int c = 0; c < num_corners; c++) {
+        if (first_corners[c] == c) {
+            mesh.vertices_[vertex_indices[c]] = corners[c].cast<double>();
+        }
+        mesh.triangles_[c / 3](c % 3) = vertex_indices[c];
+    }
+}
+
+}  // unnamed namespace
+
 namespace io {
 
 FileGeometry ReadFileGeometryTypeSTL(const std::string &path) {
@@ -42,67 +107,59 @@ FileGeometry ReadFileGeometryTypeSTL(const std::string &path) {
 bool ReadTriangleMeshFromSTL(const std::string &filename,
                              geometry::TriangleMesh &mesh,
                              bool print_progress) {
-    FILE *myFile = utility::filesystem::FOpen(filename.c_str(), "rb");
-
-    if (!myFile) {
+    utility::filesystem::MappedFile file;
+    if (!file.Open(filename)) {
         utility::LogWarning("Read STL failed: unable to open file.");
-        fclose(myFile);
         return false;
     }
-
-    int num_of_triangles;
-    if (myFile) {
-        char header[80] = "";
-        fread(header, sizeof(char), 80, myFile);
-        fread(&num_of_triangles, sizeof(unsigned int), 1, myFile);
-    } else {
+    if (file.Size() < kSTLHeaderSize) {
         utility::LogWarning("Read STL failed: unable to read header.");
-        fclose(myFile);
         return false;
     }
 
+    std::uint32_t num_of_triangles;
+    memcpy(&num_of_triangles, file.Data() + 80, sizeof(num_of_triangles));
     if (num_of_triangles == 0) {
         utility::LogWarning("Read STL failed: empty file.");
-        fclose(myFile);
+        return false;
+    }
+    if ((file.Size() - kSTLHeaderSize) / kSTLRecordSize < num_of_triangles ||
+        num_of_triangles > (std::uint32_t)(INT32_MAX / 3)) {
+        utility::LogWarning("Read STL failed: not enough triangles.");
         return false;
     }
 
-    mesh.vertices_.clear();
-    mesh.triangles_.clear();
-    mesh.triangle_normals_.clear();
-    mesh.vertices_.resize(num_of_triangles * 3);
+    mesh.Clear();
     mesh.triangles_.resize(num_of_triangles);
     mesh.triangle_normals_.resize(num_of_triangles);
-
-    utility::ConsoleProgressBar progress_bar(num_of_triangles,
-                                             "Reading STL: ", print_progress);
-    for (int i = 0; i < num_of_triangles; i++) {
-        char buffer[50];
-        float *float_buffer;
-        if (myFile) {
-            fread(buffer, sizeof(char), 50, myFile);
-            float_buffer = reinterpret_cast<float *>(buffer);
-            mesh.triangle_normals_[i] =
-                    Eigen::Map<Eigen::Vector3f>(float_buffer).cast<double>();
+    std::vector<Eigen::Vector3f> corners(num_of_triangles * 3);
+
+    const int block_size = 1 << 16;
+    utility::ConsoleProgressBar progress_bar(
+            (num_of_triangles + block_size - 1) / block_size, "Reading STL: ",
+            print_progress);
+    for (int begin = 0; begin < (int)num_of_triangles; begin += block_size) {
+        const int end = std::min(begin + block_size, (int)num_of_triangles);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int i = begin; i < end; i++) {
+            const char *record =
+                    file.Data() + kSTLHeaderSize + i * kSTLRecordSize;
+            Eigen::Vector3f normal;
+            memcpy(normal.data(), record, 12);
+            mesh.triangle_normals_[i] = normal.cast<double>();
+            // The records are not aligned, the floats are copied out.
             for (int j = 0; j < 3; j++) {
-                float_buffer = reinterpret_cast<float *>(buffer + 12 * (j + 1));
-                mesh.vertices_[i * 3 + j] =
-                        Eigen::Map<Eigen::Vector3f>(float_buffer)
-                                .cast<double>();
+                memcpy(corners[i * 3 + j].data(), record + 12 * (j + 1), 12);
             }
-            mesh.triangles_[i] =
-                    Eigen::Vector3i(i * 3 + 0, i * 3 + 1, i * 3 + 2);
-            // ignore buffer[48] and buffer [49] because it is rarely used.
-
-        } else {
-            utility::LogWarning("Read STL failed: not enough triangles.");
-            fclose(myFile);
-            return false;
+            // Ignore the attribute at record[48] and record[49] because it
+            // is rarely used.
         }
         ++progress_bar;
     }
 
-    fclose(myFile);
+    WeldSTLVertices(corners, mesh);
     return true;
 }
 
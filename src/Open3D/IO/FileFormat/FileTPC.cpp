@@ -0,0 +1,724 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <liblzf/lzf.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include "Open3D/IO/ClassIO/FileFormatIO.h"
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
+#include "Open3D/IO/FileFormat/MortonCode.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/FileSystem.h"
+#include "Open3D/Utility/MappedFile.h"
+
+// Tiled point cloud (.tpc) file layout, all values little-endian:
+//
+//   char[8]    magic "O3DTPC1"
+//   chunks     one independently LZF-compressed chunk per tile and level
+//   index      uint32 flags, uint32 num_levels, double quantization_step,
+//              uint64 num_tiles, then for every tile
+//                  double origin[3], double min_bound[3], double max_bound[3],
+//                  num_levels x {uint64 offset, uint32 compressed_size,
+//                                uint32 num_points}
+//   uint64     offset of the index
+//   char[8]    magic "O3DTPC1"
+//
+// The tiles are the leaves of an octree over the bounding cube of the cloud.
+// A chunk stores the attributes as columns: positions relative to the tile
+// origin (float32 or quantized int32 x 3), normals (float32 x 3) and colors
+// (uint8 x 3). Within a tile the points are ordered along the bit-reversed
+// Morton code, which spreads every prefix evenly over the tile; the levels of
+// detail are prefixes of that order. A chunk is stored raw if compression
+// does not shrink it.
+
+namespace open3d {
+
+namespace {
+using namespace io;
+
+const char kTPCMagic[8] = "O3DTPC1";
+const std::uint32_t kTPCHasNormals = 1 << 0;
+const std::uint32_t kTPCHasColors = 1 << 1;
+const std::uint32_t kTPCQuantized = 1 << 2;
+// Depth of the octree nodes by which the Morton codes are bucketed before
+// sorting.
+const int kTPCBucketDepth = 3;
+// Number of tiles encoded in parallel before they are written.
+const int kTPCTilesPerBatch = 64;
+// Level l holds 1 / 4^(num_levels - 1 - l) of the points of a tile, further
+// levels would be empty.
+const int kTPCMaxLevels = 32;
+
+struct TPCChunk {
+    std::uint64_t offset;
+    std::uint32_t compressed_size;
+    std::uint32_t num_points;
+};
+
+struct TPCTile {
+    Eigen::Vector3d origin = Eigen::Vector3d::Zero();
+    Eigen::Vector3d min_bound = Eigen::Vector3d::Zero();
+    Eigen::Vector3d max_bound = Eigen::Vector3d::Zero();
+    std::vector<TPCChunk> chunks;
+};
+
+struct TPCLayout {
+    std::uint32_t flags = 0;
+    double quantization_step = 0.0;
+
+    size_t GetPointSize() const {
+        return 12 + ((flags & kTPCHasNormals) != 0 ? 12 : 0) +
+               ((flags & kTPCHasColors) != 0 ? 3 : 0);
+    }
+};
+
+/// Splits the Morton-sorted range [begin, end) of \p codes into octree leaves
+/// of at most \p max_points points.
+void SplitTPCTiles(const std::vector<std::pair<std::uint64_t, size_t>> &codes,
+                   size_t begin,
+                   size_t end,
+                   int depth,
+                   size_t max_points,
+                   std::vector<std::pair<size_t, size_t>> &tiles) {
+    if (end - begin <= max_points || depth == kMortonBitsPerAxis) {
+        tiles.push_back(std::make_pair(begin, end));
+        return;
+    }
+    const int shift = 3 * (kMortonBitsPerAxis - depth - 1);
+    const std::uint64_t prefix = codes[begin].first >> (shift + 3);
+    size_t child_begin = begin;
+    for (std::uint64_t child = 0; child < 8 && child_begin < end; child++) {
+        const std::uint64_t child_end_code = ((prefix << 3) + child + 1)
+                                             << shift;
+        const auto child_end_itr = std::lower_bound(
+                codes.begin() + child_begin, codes.begin() + end,
+                std::make_pair(child_end_code, size_t(0)));
+        const size_t child_end = child_end_itr - codes.begin();
+        if (child_end > child_begin) {
+            SplitTPCTiles(codes, child_begin, child_end, depth + 1,
+                          max_points, tiles);
+        }
+        child_begin = child_end;
+    }
+}
+
+template <typename T>
+void AppendTPCValue(std::vector<char> &buffer, size_t &pos, T value) {
+    memcpy(buffer.data() + pos, &value, sizeof(T));
+    pos += sizeof(T);
+}
+
+template <typename T>
+T LoadTPCValue(const char *&ptr) {
+    T value;
+    memcpy(&value, ptr, sizeof(T));
+    ptr += sizeof(T);
+    return value;
+}
+
+struct TPCEncodedTile {
+    TPCTile tile;
+    std::vector<std::vector<char>> chunk_data;
+    bool success = true;
+};
+
+/// Orders the points of a tile for the levels of detail, encodes the chunks
+/// and compresses them.
+void EncodeTPCTile(const geometry::PointCloud &pointcloud,
+                   const TPCLayout &layout,
+                   int num_levels,
+                   std::vector<std::pair<std::uint64_t, size_t>> points,
+                   TPCEncodedTile &encoded) {
+    for (auto &point : points) {
+        point.first = ReverseBits(point.first);
+    }
+    std::sort(points.begin(), points.end());
+
+    Eigen::Vector3d origin = pointcloud.points_[points[0].second];
+    for (const auto &point : points) {
+        origin = origin.cwiseMin(pointcloud.points_[point.second]);
+    }
+    encoded.tile.origin = origin;
+    const bool quantized = (layout.flags & kTPCQuantized) != 0;
+    const double step = layout.quantization_step;
+    std::vector<Eigen::Vector3f> offsets(points.size());
+    std::vector<Eigen::Vector3i> quantized_offsets(points.size());
+    // The tile bounds are taken over the decoded positions, so that region
+    // reads can accept whole tiles without testing their points.
+    encoded.tile.min_bound = Eigen::Vector3d::Constant(
+            std::numeric_limits<double>::infinity());
+    encoded.tile.max_bound = -encoded.tile.min_bound;
+    for (size_t i = 0; i < points.size(); i++) {
+        const Eigen::Vector3d offset =
+                pointcloud.points_[points[i].second] - origin;
+        Eigen::Vector3d decoded;
+        if (quantized) {
+            const Eigen::Vector3d q = (offset / step).array().round();
+            if (q.maxCoeff() > std::numeric_limits<std::int32_t>::max()) {
+                encoded.success = false;
+                return;
+            }
+            quantized_offsets[i] = q.cast<int>();
+            decoded = origin + quantized_offsets[i].cast<double>() * step;
+        } else {
+            offsets[i] = offset.cast<float>();
+            decoded = origin + offsets[i].cast<double>();
+        }
+        encoded.tile.min_bound = encoded.tile.min_bound.cwiseMin(decoded);
+        encoded.tile.max_bound = encoded.tile.max_bound.cwiseMax(decoded);
+    }
+
+    const size_t point_size = layout.GetPointSize();
+    encoded.tile.chunks.resize(num_levels);
+    encoded.chunk_data.resize(num_levels);
+    size_t level_begin = 0;
+    for (int level = 0; level < num_levels; level++) {
+        const size_t level_end =
+                level + 1 == num_levels
+                        ? points.size()
+                        : (size_t)std::ceil(
+                                  points.size() /
+                                  std::pow(4.0, num_levels - 1 - level));
+        const size_t num_points = std::max(level_end, level_begin) -
+                                  level_begin;
+        std::vector<char> buffer(num_points * point_size);
+        size_t pos = 0;
+        for (size_t i = level_begin; i < level_begin + num_points; i++) {
+            for (int k = 0; k < 3; k++) {
+                if (quantized) {
+                    AppendTPCValue<std::int32_t>(buffer, pos,
+                                                 quantized_offsets[i](k));
+                } else {
+                    AppendTPCValue<float>(buffer, pos, offsets[i](k));
+                }
+            }
+        }
+        if ((layout.flags & kTPCHasNormals) != 0) {
+            for (size_t i = level_begin; i < level_begin + num_points; i++) {
+                const auto &normal = pointcloud.normals_[points[i].second];
+                for (int k = 0; k < 3; k++) {
+                    AppendTPCValue<float>(buffer, pos, (float)normal(k));
+                }
+            }
+        }
+        if ((layout.flags & kTPCHasColors) != 0) {
+            for (size_t i = level_begin; i < level_begin + num_points; i++) {
+                const auto &color = pointcloud.colors_[points[i].second];
+                for (int k = 0; k < 3; k++) {
+                    AppendTPCValue<std::uint8_t>(
+                            buffer, pos,
+                            (std::uint8_t)std::max(
+                                    std::min((int)(color(k) * 255.0), 255),
+                                    0));
+                }
+            }
+        }
+
+        std::vector<char> &compressed = encoded.chunk_data[level];
+        compressed.resize(buffer.size());
+        unsigned int compressed_size =
+                buffer.empty() ? 0
+                               : lzf_compress(buffer.data(),
+                                              (unsigned int)buffer.size(),
+                                              compressed.data(),
+                                              (unsigned int)buffer.size() - 1);
+        if (compressed_size == 0) {
+            compressed.swap(buffer);
+        } else {
+            compressed.resize(compressed_size);
+        }
+        encoded.tile.chunks[level].compressed_size =
+                (std::uint32_t)compressed.size();
+        encoded.tile.chunks[level].num_points = (std::uint32_t)num_points;
+        level_begin += num_points;
+    }
+}
+
+/// Decodes a chunk into \p pointcloud starting at \p index and keeps the
+/// points inside \p bbox, or all points if \p bbox is nullptr. Returns the
+/// number of points kept, or -1 if the chunk is corrupt.
+int64_t DecodeTPCChunk(const char *data,
+                       const TPCLayout &layout,
+                       const TPCTile &tile,
+                       const TPCChunk &chunk,
+                       const geometry::AxisAlignedBoundingBox *bbox,
+                       size_t index,
+                       geometry::PointCloud &pointcloud) {
+    const size_t size = chunk.num_points * layout.GetPointSize();
+    std::vector<char> buffer;
+    const char *ptr = data + chunk.offset;
+    if (chunk.compressed_size != size) {
+        buffer.resize(size);
+        if (lzf_decompress(ptr, chunk.compressed_size, buffer.data(),
+                           (unsigned int)size) != size) {
+            return -1;
+        }
+        ptr = buffer.data();
+    }
+
+    const bool quantized = (layout.flags & kTPCQuantized) != 0;
+    for (size_t i = 0; i < chunk.num_points; i++) {
+        Eigen::Vector3d &point = pointcloud.points_[index + i];
+        for (int k = 0; k < 3; k++) {
+            point(k) = tile.origin(k);
+            point(k) += quantized ? LoadTPCValue<std::int32_t>(ptr) *
+                                            layout.quantization_step
+                                  : LoadTPCValue<float>(ptr);
+        }
+    }
+    if ((layout.flags & kTPCHasNormals) != 0) {
+        for (size_t i = 0; i < chunk.num_points; i++) {
+            for (int k = 0; k < 3; k++) {
+                pointcloud.normals_[index + i](k) = LoadTPCValue<float>(ptr);
+            }
+        }
+    }
+    if ((layout.flags & kTPCHasColors) != 0) {
+        for (size_t i = 0; i < chunk.num_points; i++) {
+            for (int k = 0; k < 3; k++) {
+                pointcloud.colors_[index + i](k) =
+                        LoadTPCValue<std::uint8_t>(ptr) / 255.0;
+            }
+        }
+    }
+
+    if (bbox == nullptr) {
+        return chunk.num_points;
+    }
+    size_t num_kept = 0;
+    for (size_t i = 0; i < chunk.num_points; i++) {
+        const Eigen::Vector3d &point = pointcloud.points_[index + i];
+        if ((point.array() >= bbox->min_bound_.array()).all() &&
+            (point.array() <= bbox->max_bound_.array()).all()) {
+            if (num_kept != i) {
+                pointcloud.points_[index + num_kept] = point;
+                if (pointcloud.HasNormals()) {
+                    pointcloud.normals_[index + num_kept] =
+                            pointcloud.normals_[index + i];
+                }
+                if (pointcloud.HasColors()) {
+                    pointcloud.colors_[index + num_kept] =
+                            pointcloud.colors_[index + i];
+                }
+            }
+            num_kept++;
+        }
+    }
+    return num_kept;
+}
+
+bool ReadTPCIndex(const char *data,
+                  size_t size,
+                  TPCLayout &layout,
+                  std::vector<TPCTile> &tiles) {
+    const size_t footer_size = sizeof(std::uint64_t) + sizeof(kTPCMagic);
+    const size_t index_header_size = 2 * sizeof(std::uint32_t) +
+                                     sizeof(double) + sizeof(std::uint64_t);
+    if (data == nullptr ||
+        size < sizeof(kTPCMagic) + index_header_size + footer_size ||
+        memcmp(data, kTPCMagic, sizeof(kTPCMagic)) != 0 ||
+        memcmp(data + size - sizeof(kTPCMagic), kTPCMagic,
+               sizeof(kTPCMagic)) != 0) {
+        return false;
+    }
+    const char *ptr = data + size - footer_size;
+    const std::uint64_t index_offset = LoadTPCValue<std::uint64_t>(ptr);
+    // The bounds are checked by subtraction, a corrupt offset can make the
+    // sums wrap around.
+    if (index_offset < sizeof(kTPCMagic) ||
+        index_offset > size - footer_size - index_header_size) {
+        return false;
+    }
+    ptr = data + index_offset;
+    layout.flags = LoadTPCValue<std::uint32_t>(ptr);
+    const std::uint32_t num_levels = LoadTPCValue<std::uint32_t>(ptr);
+    layout.quantization_step = LoadTPCValue<double>(ptr);
+    const std::uint64_t num_tiles = LoadTPCValue<std::uint64_t>(ptr);
+    if (num_levels == 0 || num_levels > (std::uint32_t)kTPCMaxLevels) {
+        return false;
+    }
+    const size_t tile_size = 9 * sizeof(double) + size_t(num_levels) * 16;
+    if (num_tiles > (size - footer_size - index_offset - index_header_size) /
+                            tile_size) {
+        return false;
+    }
+    tiles.resize(num_tiles);
+    const size_t point_size = layout.GetPointSize();
+    for (auto &tile : tiles) {
+        for (int k = 0; k < 3; k++) {
+            tile.origin(k) = LoadTPCValue<double>(ptr);
+        }
+        for (int k = 0; k < 3; k++) {
+            tile.min_bound(k) = LoadTPCValue<double>(ptr);
+        }
+        for (int k = 0; k < 3; k++) {
+            tile.max_bound(k) = LoadTPCValue<double>(ptr);
+        }
+        tile.chunks.resize(num_levels);
+        for (auto &chunk : tile.chunks) {
+            chunk.offset = LoadTPCValue<std::uint64_t>(ptr);
+            chunk.compressed_size = LoadTPCValue<std::uint32_t>(ptr);
+            chunk.num_points = LoadTPCValue<std::uint32_t>(ptr);
+            if (chunk.offset < sizeof(kTPCMagic) ||
+                chunk.offset > index_offset ||
+                chunk.compressed_size > index_offset - chunk.offset ||
+                chunk.compressed_size > chunk.num_points * point_size) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool ReadTPC(const std::string &filename,
+             geometry::PointCloud &pointcloud,
+             const geometry::AxisAlignedBoundingBox *bbox,
+             int level,
+             bool print_progress) {
+    utility::filesystem::MappedFile file;
+    if (!file.Open(filename)) {
+        utility::LogWarning("Read TPC failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    TPCLayout layout;
+    std::vector<TPCTile> tiles;
+    if (!ReadTPCIndex(file.Data(), file.Size(), layout, tiles)) {
+        utility::LogWarning("Read TPC failed: unable to parse index.");
+        return false;
+    }
+
+    // Select the chunks of the tiles intersecting bbox and lay them out in
+    // the output.
+    struct ChunkTask {
+        size_t tile;
+        size_t chunk;
+        size_t index;
+        bool test_points;
+    };
+    std::vector<ChunkTask> tasks;
+    size_t num_points = 0;
+    for (size_t t = 0; t < tiles.size(); t++) {
+        const TPCTile &tile = tiles[t];
+        bool test_points = false;
+        if (bbox != nullptr) {
+            if ((tile.max_bound.array() < bbox->min_bound_.array()).any() ||
+                (tile.min_bound.array() > bbox->max_bound_.array()).any()) {
+                continue;
+            }
+            test_points =
+                    (tile.min_bound.array() < bbox->min_bound_.array()).any() ||
+                    (tile.max_bound.array() > bbox->max_bound_.array()).any();
+        }
+        const size_t num_chunks =
+                level < 0 ? tile.chunks.size()
+                          : std::min(tile.chunks.size(), (size_t)level + 1);
+        for (size_t c = 0; c < num_chunks; c++) {
+            tasks.push_back(ChunkTask{t, c, num_points, test_points});
+            num_points += tile.chunks[c].num_points;
+        }
+    }
+
+    pointcloud.Clear();
+    pointcloud.points_.resize(num_points);
+    if ((layout.flags & kTPCHasNormals) != 0) {
+        pointcloud.normals_.resize(num_points);
+    }
+    if ((layout.flags & kTPCHasColors) != 0) {
+        pointcloud.colors_.resize(num_points);
+    }
+    utility::ConsoleProgressBar progress_bar(tasks.size(), "Reading TPC: ",
+                                             print_progress);
+    std::vector<int64_t> num_kept(tasks.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int i = 0; i < (int)tasks.size(); i++) {
+        const ChunkTask &task = tasks[i];
+        const TPCTile &tile = tiles[task.tile];
+        num_kept[i] = DecodeTPCChunk(file.Data(), layout, tile,
+                                     tile.chunks[task.chunk],
+                                     task.test_points ? bbox : nullptr,
+                                     task.index, pointcloud);
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+        ++progress_bar;
+    }
+
+    size_t num_read = 0;
+    for (size_t i = 0; i < tasks.size(); i++) {
+        if (num_kept[i] < 0) {
+            utility::LogWarning("Read TPC failed: corrupt chunk in file: {}",
+                                filename);
+            pointcloud.Clear();
+            return false;
+        }
+        if (num_read != tasks[i].index) {
+            for (int64_t j = 0; j < num_kept[i]; j++) {
+                pointcloud.points_[num_read + j] =
+                        pointcloud.points_[tasks[i].index + j];
+                if (pointcloud.HasNormals()) {
+                    pointcloud.normals_[num_read + j] =
+                            pointcloud.normals_[tasks[i].index + j];
+                }
+                if (pointcloud.HasColors()) {
+                    pointcloud.colors_[num_read + j] =
+                            pointcloud.colors_[tasks[i].index + j];
+                }
+            }
+        }
+        num_read += num_kept[i];
+    }
+    const bool has_normals = pointcloud.HasNormals();
+    const bool has_colors = pointcloud.HasColors();
+    pointcloud.points_.resize(num_read);
+    if (has_normals) {
+        pointcloud.normals_.resize(num_read);
+    }
+    if (has_colors) {
+        pointcloud.colors_.resize(num_read);
+    }
+    return true;
+}
+
+}  // unnamed namespace
+
+namespace io {
+
+FileGeometry ReadFileGeometryTypeTPC(const std::string &path) {
+    return CONTAINS_POINTS;
+}
+
+bool ReadPointCloudFromTPC(const std::string &filename,
+                           geometry::PointCloud &pointcloud,
+                           bool print_progress) {
+    return ReadTPC(filename, pointcloud, nullptr, -1, print_progress);
+}
+
+bool ReadPointCloudRegionFromTPC(const std::string &filename,
+                                 geometry::PointCloud &pointcloud,
+                                 const geometry::AxisAlignedBoundingBox &bbox,
+                                 int level,
+                                 bool print_progress) {
+    return ReadTPC(filename, pointcloud, &bbox, level, print_progress);
+}
+
+bool WritePointCloudToTPC(const std::string &filename,
+                          const geometry::PointCloud &pointcloud,
+                          bool write_ascii /* = false*/,
+                          bool compressed /* = false*/,
+                          bool print_progress) {
+    return WritePointCloudToTPCWithOption(filename, pointcloud,
+                                          TiledPointCloudOption(),
+                                          print_progress);
+}
+
+bool WritePointCloudToTPCWithOption(const std::string &filename,
+                                    const geometry::PointCloud &pointcloud,
+                                    const TiledPointCloudOption &option,
+                                    bool print_progress) {
+    if (pointcloud.IsEmpty()) {
+        utility::LogWarning("Write TPC failed: point cloud has 0 points.");
+        return false;
+    }
+    if (option.max_points_per_tile_ <= 0 || option.num_levels_ <= 0 ||
+        option.num_levels_ > kTPCMaxLevels) {
+        utility::LogWarning("Write TPC failed: invalid tiling parameters.");
+        return false;
+    }
+    TPCLayout layout;
+    layout.flags = (pointcloud.HasNormals() ? kTPCHasNormals : 0) |
+                   (pointcloud.HasColors() ? kTPCHasColors : 0) |
+                   (option.quantization_step_ > 0.0 ? kTPCQuantized : 0);
+    layout.quantization_step = std::max(option.quantization_step_, 0.0);
+    if ((size_t)option.max_points_per_tile_ * layout.GetPointSize() >
+        std::numeric_limits<std::uint32_t>::max()) {
+        utility::LogWarning("Write TPC failed: tiles are too large.");
+        return false;
+    }
+
+    // Sort the points along the Morton curve of the bounding cube, so that
+    // every octree node is a contiguous range.
+    const Eigen::Vector3d min_bound = pointcloud.GetMinBound();
+    const double cube_size =
+            std::max((pointcloud.GetMaxBound() - min_bound).maxCoeff(), 1e-12);
+    const double scale = (double)(1 << kMortonBitsPerAxis) / cube_size;
+    const int64_t num_points = (int64_t)pointcloud.points_.size();
+    std::vector<std::uint64_t> point_codes(num_points);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int64_t i = 0; i < num_points; i++) {
+        std::uint64_t code = 0;
+        for (int k = 0; k < 3; k++) {
+            const double cell =
+                    (pointcloud.points_[i](k) - min_bound(k)) * scale;
+            const std::uint64_t q = (std::uint64_t)std::min(
+                    std::max(cell, 0.0),
+                    (double)((1 << kMortonBitsPerAxis) - 1));
+            code |= SpreadMortonBits(q) << (2 - k);
+        }
+        point_codes[i] = code;
+    }
+    // Bucket the codes by their octree node at depth kTPCBucketDepth and sort
+    // the buckets in parallel.
+    const int bucket_shift = 3 * (kMortonBitsPerAxis - kTPCBucketDepth);
+    std::vector<size_t> bucket_offsets((1 << (3 * kTPCBucketDepth)) + 1, 0);
+    for (const auto code : point_codes) {
+        bucket_offsets[(code >> bucket_shift) + 1]++;
+    }
+    for (size_t b = 1; b < bucket_offsets.size(); b++) {
+        bucket_offsets[b] += bucket_offsets[b - 1];
+    }
+    std::vector<std::pair<std::uint64_t, size_t>> codes(num_points);
+    std::vector<size_t> bucket_positions(bucket_offsets.begin(),
+                                         bucket_offsets.end() - 1);
+    for (int64_t i = 0; i < num_points; i++) {
+        const std::uint64_t code = point_codes[i];
+        codes[bucket_positions[code >> bucket_shift]++] =
+                std::make_pair(code, (size_t)i);
+    }
+    point_codes.clear();
+    point_codes.shrink_to_fit();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int b = 0; b < (int)bucket_offsets.size() - 1; b++) {
+        std::sort(codes.begin() + bucket_offsets[b],
+                  codes.begin() + bucket_offsets[b + 1]);
+    }
+    std::vector<std::pair<size_t, size_t>> tile_ranges;
+    SplitTPCTiles(codes, 0, codes.size(), 0, option.max_points_per_tile_,
+                  tile_ranges);
+
+    FILE *file = utility::filesystem::FOpen(filename, "wb");
+    if (file == NULL) {
+        utility::LogWarning("Write TPC failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    if (fwrite(kTPCMagic, sizeof(kTPCMagic), 1, file) != 1) {
+        utility::LogWarning("Write TPC failed: unable to write file: {}",
+                            filename);
+        fclose(file);
+        return false;
+    }
+    utility::ConsoleProgressBar progress_bar(tile_ranges.size(),
+                                             "Writing TPC: ", print_progress);
+    std::vector<TPCTile> tiles;
+    std::uint64_t offset = sizeof(kTPCMagic);
+    std::vector<TPCEncodedTile> batch(kTPCTilesPerBatch);
+    for (size_t batch_begin = 0; batch_begin < tile_ranges.size();
+         batch_begin += kTPCTilesPerBatch) {
+        const int batch_size = (int)std::min(
+                (size_t)kTPCTilesPerBatch, tile_ranges.size() - batch_begin);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+        for (int b = 0; b < batch_size; b++) {
+            const auto &range = tile_ranges[batch_begin + b];
+            batch[b] = TPCEncodedTile();
+            EncodeTPCTile(pointcloud, layout, option.num_levels_,
+                          std::vector<std::pair<std::uint64_t, size_t>>(
+                                  codes.begin() + range.first,
+                                  codes.begin() + range.second),
+                          batch[b]);
+        }
+        for (int b = 0; b < batch_size; b++) {
+            if (!batch[b].success) {
+                utility::LogWarning(
+                        "Write TPC failed: quantization step is too small for "
+                        "the extent of a tile.");
+                fclose(file);
+                return false;
+            }
+            for (int level = 0; level < option.num_levels_; level++) {
+                const std::vector<char> &data = batch[b].chunk_data[level];
+                if (!data.empty() &&
+                    fwrite(data.data(), 1, data.size(), file) != data.size()) {
+                    utility::LogWarning(
+                            "Write TPC failed: unable to write file: {}",
+                            filename);
+                    fclose(file);
+                    return false;
+                }
+                batch[b].tile.chunks[level].offset = offset;
+                offset += data.size();
+            }
+            tiles.push_back(std::move(batch[b].tile));
+            ++progress_bar;
+        }
+    }
+
+    std::vector<char> index(2 * sizeof(std::uint32_t) + sizeof(double) +
+                            sizeof(std::uint64_t) +
+                            tiles.size() * (9 * sizeof(double) +
+                                            option.num_levels_ * 16) +
+                            sizeof(std::uint64_t) + sizeof(kTPCMagic));
+    size_t pos = 0;
+    AppendTPCValue<std::uint32_t>(index, pos, layout.flags);
+    AppendTPCValue<std::uint32_t>(index, pos, option.num_levels_);
+    AppendTPCValue<double>(index, pos, layout.quantization_step);
+    AppendTPCValue<std::uint64_t>(index, pos, tiles.size());
+    for (const auto &tile : tiles) {
+        for (int k = 0; k < 3; k++) {
+            AppendTPCValue<double>(index, pos, tile.origin(k));
+        }
+        for (int k = 0; k < 3; k++) {
+            AppendTPCValue<double>(index, pos, tile.min_bound(k));
+        }
+        for (int k = 0; k < 3; k++) {
+            AppendTPCValue<double>(index, pos, tile.max_bound(k));
+        }
+        for (const auto &chunk : tile.chunks) {
+            AppendTPCValue<std::uint64_t>(index, pos, chunk.offset);
+            AppendTPCValue<std::uint32_t>(index, pos, chunk.compressed_size);
+            AppendTPCValue<std::uint32_t>(index, pos, chunk.num_points);
+        }
+    }
+    AppendTPCValue<std::uint64_t>(index, pos, offset);
+    memcpy(index.data() + pos, kTPCMagic, sizeof(kTPCMagic));
+    if (fwrite(index.data(), 1, index.size(), file) != index.size()) {
+        utility::LogWarning("Write TPC failed: unable to write file: {}",
+                            filename);
+        fclose(file);
+        return false;
+    }
+    fclose(file);
+    utility::LogDebug("Write TPC: {:d} points in {:d} tiles.", num_points,
+                      tiles.size());
+    return true;
+}
+
+}  // namespace io
+}  // namespace open3d
@@ -25,11 +25,14 @@
 // ----------------------------------------------------------------------------
 
 #include <cstdio>
+#include <iterator>
 
 #include "Open3D/IO/ClassIO/FileFormatIO.h"
 #include "Open3D/IO/ClassIO/PointCloudIO.h"
+#include "Open3D/IO/FileFormat/ASCIIHelper.h"
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/FileSystem.h"
+#include "Open3D/Utility/MappedFile.h"
 
 namespace open3d {
 namespace io {
@@ -41,26 +44,35 @@ FileGeometry ReadFileGeometryTypeXYZN(const std::string &path) {
 bool ReadPointCloudFromXYZN(const std::string &filename,
                             geometry::PointCloud &pointcloud,
                             bool print_progress) {
-    FILE *file = utility::filesystem::FOpen(filename, "r");
-    if (file == NULL) {
+    utility::filesystem::MappedFile file;
+    if (!file.Open(filename)) {
         utility::LogWarning("Read XYZN failed: unable to open file: {}",
                             filename);
         return false;
     }
 
-    char line_buffer[DEFAULT_IO_BUFFER_SIZE];
-    double x, y, z, nx, ny, nz;
     pointcloud.Clear();
-
-    while (fgets(line_buffer, DEFAULT_IO_BUFFER_SIZE, file)) {
-        if (sscanf(line_buffer, "%lf %lf %lf %lf %lf %lf", &x, &y, &z, &nx, &ny,
-                   &nz) == 6) {
-            pointcloud.points_.push_back(Eigen::Vector3d(x, y, z));
-            pointcloud.normals_.push_back(Eigen::Vector3d(nx, ny, nz));
-        }
-    }
-
-    fclose(file);
+    std::vector<ASCIIChunk> chunks = SplitASCIIChunks(file.Data(), file.Size());
+    size_t num_lines = CountASCIILines(chunks);
+    pointcloud.points_.resize(num_lines);
+    pointcloud.normals_.resize(num_lines);
+    size_t num_points = ParseASCIILines(
+            chunks,
+            [&](const char *begin, const char *end, size_t i) {
+                double v[6];
+                if (!ParseASCIIDoubles(begin, end, v, 6)) {
+                    return false;
+                }
+                pointcloud.points_[i] = Eigen::Vector3d(v[0], v[1], v[2]);
+                pointcloud.normals_[i] = Eigen::Vector3d(v[3], v[4], v[5]);
+                return true;
+            },
+            [&](size_t from, size_t to) {
+                pointcloud.points_[to] = pointcloud.points_[from];
+                pointcloud.normals_[to] = pointcloud.normals_[from];
+            });
+    pointcloud.points_.resize(num_points);
+    pointcloud.normals_.resize(num_points);
     return true;
 }
 
@@ -80,16 +92,22 @@ bool WritePointCloudToXYZN(const std::string &filename,
         return false;
     }
 
-    for (size_t i = 0; i < pointcloud.points_.size(); i++) {
-        const Eigen::Vector3d &point = pointcloud.points_[i];
-        const Eigen::Vector3d &normal = pointcloud.normals_[i];
-        if (fprintf(file, "%.10f %.10f %.10f %.10f %.10f %.10f\n", point(0),
-                    point(1), point(2), normal(0), normal(1), normal(2)) < 0) {
-            utility::LogWarning("Write XYZN failed: unable to write file: {}",
-                                filename);
-            fclose(file);
-            return false;  // error happens during writing.
-        }
+    bool is_success = WriteASCIILines(
+            file, pointcloud.points_.size(),
+            [&](size_t i, std::string &buffer) {
+                const Eigen::Vector3d &point = pointcloud.points_[i];
+                const Eigen::Vector3d &normal = pointcloud.normals_[i];
+                fmt::format_to(
+                        std::back_inserter(buffer),
+                        "{:.10f} {:.10f} {:.10f} {:.10f} {:.10f} {:.10f}\n",
+                        point(0), point(1), point(2), normal(0), normal(1),
+                        normal(2));
+            });
+    if (!is_success) {
+        utility::LogWarning("Write XYZN failed: unable to write file: {}",
+                            filename);
+        fclose(file);
+        return false;  // error happens during writing.
     }
 
     fclose(file);
@@ -26,6 +26,7 @@
 
 #include "Open3D/Integration/ScalableTSDFVolume.h"
 
+#include <limits>
 #include <unordered_set>
 
 #include "Open3D/Geometry/PointCloud.h"
@@ -40,11 +41,14 @@ ScalableTSDFVolume::ScalableTSDFVolume(double voxel_length,
                                        double sdf_trunc,
                                        TSDFVolumeColorType color_type,
                                        int volume_unit_resolution /* = 16*/,
-                                       int depth_sampling_stride /* = 4*/)
+                                       int depth_sampling_stride /* = 4*/,
+                                       TSDFVoxelStorageType storage_type
+                                       /* = TSDFVoxelStorageType::Voxel*/)
     : TSDFVolume(voxel_length, sdf_trunc, color_type),
       volume_unit_resolution_(volume_unit_resolution),
       volume_unit_length_(voxel_length * volume_unit_resolution),
-      depth_sampling_stride_(depth_sampling_stride) {}
+      depth_sampling_stride_(depth_sampling_stride),
+      storage_type_(storage_type) {}
 
 ScalableTSDFVolume::~ScalableTSDFVolume() {}
 
@@ -73,35 +77,83 @@ void ScalableTSDFVolume::Integrate(
         utility::LogError(
                 "[ScalableTSDFVolume::Integrate] Unsupported image format.");
     }
-    auto depth2cameradistance =
-            geometry::Image::CreateDepthToCameraDistanceMultiplierFloatImage(
-                    intrinsic);
+    const geometry::Image &depth2cameradistance =
+            GetDepthToCameraDistanceMultiplier(intrinsic);
     auto pointcloud = geometry::PointCloud::CreateFromDepthImage(
             image.depth_, intrinsic, extrinsic, 1000.0, 1000.0,
             depth_sampling_stride_);
+
+    // Step 1: collect the volume units touched by the depth points. Every
+    // thread gathers the units of its own share of points, the partial sets
+    // are merged afterwards.
     std::unordered_set<Eigen::Vector3i,
                        utility::hash_eigen::hash<Eigen::Vector3i>>
-            touched_volume_units_;
-    for (const auto &point : pointcloud->points_) {
-        auto min_bound = LocateVolumeUnit(
-                point - Eigen::Vector3d(sdf_trunc_, sdf_trunc_, sdf_trunc_));
-        auto max_bound = LocateVolumeUnit(
-                point + Eigen::Vector3d(sdf_trunc_, sdf_trunc_, sdf_trunc_));
-        for (auto x = min_bound(0); x <= max_bound(0); x++) {
-            for (auto y = min_bound(1); y <= max_bound(1); y++) {
-                for (auto z = min_bound(2); z <= max_bound(2); z++) {
-                    auto loc = Eigen::Vector3i(x, y, z);
-                    if (touched_volume_units_.find(loc) ==
-                        touched_volume_units_.end()) {
-                        touched_volume_units_.insert(loc);
-                        auto volume = OpenVolumeUnit(Eigen::Vector3i(x, y, z));
-                        volume->IntegrateWithDepthToCameraDistanceMultiplier(
-                                image, intrinsic, extrinsic,
-                                *depth2cameradistance);
+            touched_volume_units;
+#ifdef _OPENMP
+#pragma omp parallel
+    {
+#endif
+        std::unordered_set<Eigen::Vector3i,
+                           utility::hash_eigen::hash<Eigen::Vector3i>>
+                touched_volume_units_private;
+#ifdef _OPENMP
+#pragma omp for nowait
+#endif
+        for (int i = 0; i < (int)pointcloud->points_.size(); i++) {
+            const Eigen::Vector3d &point = pointcloud->points_[i];
+            auto min_bound = LocateVolumeUnit(
+                    point -
+                    Eigen::Vector3d(sdf_trunc_, sdf_trunc_, sdf_trunc_));
+            auto max_bound = LocateVolumeUnit(
+                    point +
+                    Eigen::Vector3d(sdf_trunc_, sdf_trunc_, sdf_trunc_));
+            for (auto x = min_bound(0); x <= max_bound(0); x++) {
+                for (auto y = min_bound(1); y <= max_bound(1); y++) {
+                    for (auto z = min_bound(2); z <= max_bound(2); z++) {
+                        touched_volume_units_private.insert(
+                                Eigen::Vector3i(x, y, z));
                     }
                 }
             }
         }
+#ifdef _OPENMP
+#pragma omp critical
+        {
+#endif
+            touched_volume_units.insert(touched_volume_units_private.begin(),
+                                        touched_volume_units_private.end());
+#ifdef _OPENMP
+        }  //    omp critical
+    }      //    omp parallel
+#endif
+
+    // Step 2: allocate the missing volume units in a batch. volume_units_ is
+    // not thread safe, so this is the only serial part of the integration.
+    std::vector<std::shared_ptr<UniformTSDFVolume>> touched_volumes;
+    touched_volumes.reserve(touched_volume_units.size());
+    for (const auto &index : touched_volume_units) {
+        touched_volumes.push_back(OpenVolumeUnit(index));
+    }
+    // The cubes of a unit read the voxels of the units at offsets {0, 1}^3,
+    // so changing a unit invalidates its own mesh fragment and the fragments
+    // of the 7 units before it.
+    for (const auto &index : touched_volume_units) {
+        for (int i = 0; i < 8; i++) {
+            auto unit_itr = volume_units_.find(index - shift[i]);
+            if (unit_itr != volume_units_.end()) {
+                unit_itr->second.mesh_fragment_.reset();
+            }
+        }
+    }
+
+    // Step 3: integrate the volume units concurrently. Each unit only writes
+    // to its own voxels.
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int i = 0; i < (int)touched_volumes.size(); i++) {
+        touched_volumes[i]->IntegrateWithDepthToCameraDistanceMultiplier(
+                image, intrinsic, extrinsic, depth2cameradistance);
     }
 }
 
@@ -109,7 +161,8 @@ std::shared_ptr<geometry::PointCloud> ScalableTSDFVolume::ExtractPointCloud() {
     auto pointcloud = std::make_shared<geometry::PointCloud>();
     double half_voxel_length = voxel_length_ * 0.5;
     float w0, w1, f0, f1;
-    Eigen::Vector3f c0, c1;
+    Eigen::Vector3f c0 = Eigen::Vector3f::Zero();
+    Eigen::Vector3f c1 = Eigen::Vector3f::Zero();
     for (const auto &unit : volume_units_) {
         if (unit.second.volume_) {
             const auto &volume0 = *unit.second.volume_;
@@ -118,11 +171,11 @@ std::shared_ptr<geometry::PointCloud> ScalableTSDFVolume::ExtractPointCloud() {
                 for (int y = 0; y < volume0.resolution_; y++) {
                     for (int z = 0; z < volume0.resolution_; z++) {
                         Eigen::Vector3i idx0(x, y, z);
-                        w0 = volume0.voxels_[volume0.IndexOf(idx0)].weight_;
-                        f0 = volume0.voxels_[volume0.IndexOf(idx0)].tsdf_;
+                        w0 = volume0.GetWeight(volume0.IndexOf(idx0));
+                        f0 = volume0.GetTSDF(volume0.IndexOf(idx0));
                         if (color_type_ != TSDFVolumeColorType::NoColor)
-                            c0 = volume0.voxels_[volume0.IndexOf(idx0)]
-                                         .color_.cast<float>();
+                            c0 = volume0.GetColor(volume0.IndexOf(idx0))
+                                         .cast<float>();
                         if (w0 != 0.0f && f0 < 0.98f && f0 >= -0.98f) {
                             Eigen::Vector3d p0 =
                                     Eigen::Vector3d(half_voxel_length +
@@ -139,15 +192,16 @@ std::shared_ptr<geometry::PointCloud> ScalableTSDFVolume::ExtractPointCloud() {
                                 p1(i) += voxel_length_;
                                 idx1(i) += 1;
                                 if (idx1(i) < volume0.resolution_) {
-                                    w1 = volume0.voxels_[volume0.IndexOf(idx1)]
-                                                 .weight_;
-                                    f1 = volume0.voxels_[volume0.IndexOf(idx1)]
-                                                 .tsdf_;
+                                    w1 = volume0.GetWeight(
+                                            volume0.IndexOf(idx1));
+                                    f1 = volume0.GetTSDF(
+                                            volume0.IndexOf(idx1));
                                     if (color_type_ !=
                                         TSDFVolumeColorType::NoColor)
-                                        c1 = volume0.voxels_[volume0.IndexOf(
-                                                                     idx1)]
-                                                     .color_.cast<float>();
+                                        c1 = volume0.GetColor(
+                                                            volume0.IndexOf(
+                                                                    idx1))
+                                                     .cast<float>();
                                 } else {
                                     idx1(i) -= volume0.resolution_;
                                     index1(i) += 1;
@@ -158,18 +212,16 @@ std::shared_ptr<geometry::PointCloud> ScalableTSDFVolume::ExtractPointCloud() {
                                     } else {
                                         const auto &volume1 =
                                                 *unit_itr->second.volume_;
-                                        w1 = volume1.voxels_[volume1.IndexOf(
-                                                                     idx1)]
-                                                     .weight_;
-                                        f1 = volume1.voxels_[volume1.IndexOf(
-                                                                     idx1)]
-                                                     .tsdf_;
+                                        w1 = volume1.GetWeight(
+                                                volume1.IndexOf(idx1));
+                                        f1 = volume1.GetTSDF(
+                                                volume1.IndexOf(idx1));
                                         if (color_type_ !=
                                             TSDFVolumeColorType::NoColor)
-                                            c1 = volume1.voxels_
-                                                         [volume1.IndexOf(idx1)]
-                                                                 .color_
-                                                                 .cast<float>();
+                                            c1 = volume1.GetColor(
+                                                                volume1.IndexOf(
+                                                                        idx1))
+                                                         .cast<float>();
                                     }
                                 }
                                 if (w1 != 0.0f && f1 < 0.98f && f1 >= -0.98f &&
@@ -209,150 +261,82 @@ std::shared_ptr<geometry::PointCloud> ScalableTSDFVolume::ExtractPointCloud() {
 
 std::shared_ptr<geometry::TriangleMesh>
 ScalableTSDFVolume::ExtractTriangleMesh() {
-    // implementation of marching cubes, based on
-    // http://paulbourke.net/geometry/polygonise/
+    // Marching cubes is only re-run on the volume units whose cached mesh
+    // fragment has been invalidated by Integrate(). The fragments are then
+    // stitched together, merging the vertices on the unit boundaries.
+    std::vector<VolumeUnit *> units;
+    std::vector<VolumeUnit *> dirty_units;
+    units.reserve(volume_units_.size());
+    for (auto &unit : volume_units_) {
+        if (unit.second.volume_) {
+            units.push_back(&unit.second);
+            if (!unit.second.mesh_fragment_) {
+                dirty_units.push_back(&unit.second);
+            }
+        }
+    }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int i = 0; i < (int)dirty_units.size(); i++) {
+        auto fragment = std::make_shared<MeshFragment>();
+        ExtractMeshFragment(*dirty_units[i], *fragment);
+        dirty_units[i]->mesh_fragment_ = fragment;
+    }
+
     auto mesh = std::make_shared<geometry::TriangleMesh>();
-    double half_voxel_length = voxel_length_ * 0.5;
+    size_t num_vertices = 0, num_triangles = 0;
+    for (const auto *unit : units) {
+        num_vertices += unit->mesh_fragment_->vertices_.size();
+        num_triangles += unit->mesh_fragment_->triangles_.size();
+    }
+    mesh->vertices_.reserve(num_vertices);
+    mesh->triangles_.reserve(num_triangles);
+    if (color_type_ != TSDFVolumeColorType::NoColor) {
+        mesh->vertex_colors_.reserve(num_vertices);
+    }
     std::unordered_map<
             Eigen::Vector4i, int, utility::hash_eigen::hash<Eigen::Vector4i>,
             std::equal_to<Eigen::Vector4i>,
             Eigen::aligned_allocator<std::pair<const Eigen::Vector4i, int>>>
             edgeindex_to_vertexindex;
-    int edge_to_index[12];
-    for (const auto &unit : volume_units_) {
-        if (unit.second.volume_) {
-            const auto &volume0 = *unit.second.volume_;
-            const auto &index0 = unit.second.index_;
-            for (int x = 0; x < volume0.resolution_; x++) {
-                for (int y = 0; y < volume0.resolution_; y++) {
-                    for (int z = 0; z < volume0.resolution_; z++) {
-                        Eigen::Vector3i idx0(x, y, z);
-                        int cube_index = 0;
-                        float w[8];
-                        float f[8];
-                        Eigen::Vector3d c[8];
-                        for (int i = 0; i < 8; i++) {
-                            Eigen::Vector3i index1 = index0;
-                            Eigen::Vector3i idx1 = idx0 + shift[i];
-                            if (idx1(0) < volume_unit_resolution_ &&
-                                idx1(1) < volume_unit_resolution_ &&
-                                idx1(2) < volume_unit_resolution_) {
-                                w[i] = volume0.voxels_[volume0.IndexOf(idx1)]
-                                               .weight_;
-                                f[i] = volume0.voxels_[volume0.IndexOf(idx1)]
-                                               .tsdf_;
-                                if (color_type_ == TSDFVolumeColorType::RGB8)
-                                    c[i] = volume0.voxels_[volume0.IndexOf(
-                                                                   idx1)]
-                                                   .color_.cast<double>() /
-                                           255.0;
-                                else if (color_type_ ==
-                                         TSDFVolumeColorType::Gray32)
-                                    c[i] = volume0.voxels_[volume0.IndexOf(
-                                                                   idx1)]
-                                                   .color_.cast<double>();
-                            } else {
-                                for (int j = 0; j < 3; j++) {
-                                    if (idx1(j) >= volume_unit_resolution_) {
-                                        idx1(j) -= volume_unit_resolution_;
-                                        index1(j) += 1;
-                                    }
-                                }
-                                auto unit_itr1 = volume_units_.find(index1);
-                                if (unit_itr1 == volume_units_.end()) {
-                                    w[i] = 0.0f;
-                                    f[i] = 0.0f;
-                                } else {
-                                    const auto &volume1 =
-                                            *unit_itr1->second.volume_;
-                                    w[i] = volume1.voxels_[volume1.IndexOf(
-                                                                   idx1)]
-                                                   .weight_;
-                                    f[i] = volume1.voxels_[volume1.IndexOf(
-                                                                   idx1)]
-                                                   .tsdf_;
-                                    if (color_type_ ==
-                                        TSDFVolumeColorType::RGB8)
-                                        c[i] = volume1.voxels_[volume1.IndexOf(
-                                                                       idx1)]
-                                                       .color_.cast<double>() /
-                                               255.0;
-                                    else if (color_type_ ==
-                                             TSDFVolumeColorType::Gray32)
-                                        c[i] = volume1.voxels_[volume1.IndexOf(
-                                                                       idx1)]
-                                                       .color_.cast<double>();
-                                }
-                            }
-                            if (w[i] == 0.0f) {
-                                cube_index = 0;
-                                break;
-                            } else {
-                                if (f[i] < 0.0f) {
-                                    cube_index |= (1 << i);
-                                }
-                            }
-                        }
-                        if (cube_index == 0 || cube_index == 255) {
-                            continue;
-                        }
-                        for (int i = 0; i < 12; i++) {
-                            if (edge_table[cube_index] & (1 << i)) {
-                                Eigen::Vector4i edge_index =
-                                        Eigen::Vector4i(index0(0), index0(1),
-                                                        index0(2), 0) *
-                                                volume_unit_resolution_ +
-                                        Eigen::Vector4i(x, y, z, 0) +
-                                        edge_shift[i];
-                                if (edgeindex_to_vertexindex.find(edge_index) ==
-                                    edgeindex_to_vertexindex.end()) {
-                                    edge_to_index[i] =
-                                            (int)mesh->vertices_.size();
-                                    edgeindex_to_vertexindex[edge_index] =
-                                            (int)mesh->vertices_.size();
-                                    Eigen::Vector3d pt(
-                                            half_voxel_length +
-                                                    voxel_length_ *
-                                                            edge_index(0),
-                                            half_voxel_length +
-                                                    voxel_length_ *
-                                                            edge_index(1),
-                                            half_voxel_length +
-                                                    voxel_length_ *
-                                                            edge_index(2));
-                                    double f0 = std::abs(
-                                            (double)f[edge_to_vert[i][0]]);
-                                    double f1 = std::abs(
-                                            (double)f[edge_to_vert[i][1]]);
-                                    pt(edge_index(3)) +=
-                                            f0 * voxel_length_ / (f0 + f1);
-                                    mesh->vertices_.push_back(pt);
-                                    if (color_type_ !=
-                                        TSDFVolumeColorType::NoColor) {
-                                        const auto &c0 = c[edge_to_vert[i][0]];
-                                        const auto &c1 = c[edge_to_vert[i][1]];
-                                        mesh->vertex_colors_.push_back(
-                                                (f1 * c0 + f0 * c1) /
-                                                (f0 + f1));
-                                    }
-                                } else {
-                                    edge_to_index[i] = edgeindex_to_vertexindex
-                                            [edge_index];
-                                }
-                            }
-                        }
-                        for (int i = 0; tri_table[cube_index][i] != -1;
-                             i += 3) {
-                            mesh->triangles_.push_back(Eigen::Vector3i(
-                                    edge_to_index[tri_table[cube_index][i]],
-                                    edge_to_index[tri_table[cube_index][i + 2]],
-                                    edge_to_index[tri_table[cube_index]
-                                                           [i + 1]]));
-                        }
-                    }
+    std::vector<int> vertex_map;
+    for (const auto *unit : units) {
+        const MeshFragment &fragment = *unit->mesh_fragment_;
+        // Interior vertices are appended, boundary vertices are merged with
+        // the ones already added by the neighboring fragments.
+        vertex_map.assign(fragment.vertices_.size(), -1);
+        for (size_t i = 0; i < fragment.boundary_vertex_indices_.size();
+             i++) {
+            int local_index = fragment.boundary_vertex_indices_[i];
+            auto result = edgeindex_to_vertexindex.insert(
+                    std::make_pair(fragment.boundary_edge_indices_[i],
+                                   (int)mesh->vertices_.size()));
+            vertex_map[local_index] = result.first->second;
+            if (result.second) {
+                mesh->vertices_.push_back(fragment.vertices_[local_index]);
+                if (color_type_ != TSDFVolumeColorType::NoColor) {
+                    mesh->vertex_colors_.push_back(
+                            fragment.vertex_colors_[local_index]);
                 }
             }
         }
+        for (size_t i = 0; i < fragment.vertices_.size(); i++) {
+            if (vertex_map[i] >= 0) {
+                continue;
+            }
+            vertex_map[i] = (int)mesh->vertices_.size();
+            mesh->vertices_.push_back(fragment.vertices_[i]);
+            if (color_type_ != TSDFVolumeColorType::NoColor) {
+                mesh->vertex_colors_.push_back(fragment.vertex_colors_[i]);
+            }
+        }
+        for (const auto &triangle : fragment.triangles_) {
+            mesh->triangles_.push_back(
+                    Eigen::Vector3i(vertex_map[triangle(0)],
+                                    vertex_map[triangle(1)],
+                                    vertex_map[triangle(2)]));
+        }
     }
     return mesh;
 }
@@ -375,12 +359,263 @@ std::shared_ptr<UniformTSDFVolume> ScalableTSDFVolume::OpenVolumeUnit(
     if (!unit.volume_) {
         unit.volume_.reset(new UniformTSDFVolume(
                 volume_unit_length_, volume_unit_resolution_, sdf_trunc_,
-                color_type_, index.cast<double>() * volume_unit_length_));
+                color_type_, index.cast<double>() * volume_unit_length_,
+                storage_type_));
         unit.index_ = index;
     }
     return unit.volume_;
 }
 
+void ScalableTSDFVolume::ExtractMeshFragment(const VolumeUnit &unit,
+                                             MeshFragment &fragment) const {
+    // implementation of marching cubes, based on
+    // http://paulbourke.net/geometry/polygonise/
+    double half_voxel_length = voxel_length_ * 0.5;
+    std::unordered_map<
+            Eigen::Vector4i, int, utility::hash_eigen::hash<Eigen::Vector4i>,
+            std::equal_to<Eigen::Vector4i>,
+            Eigen::aligned_allocator<std::pair<const Eigen::Vector4i, int>>>
+            edgeindex_to_vertexindex;
+    int edge_to_index[12];
+    const auto &volume0 = *unit.volume_;
+    const auto &index0 = unit.index_;
+    for (int x = 0; x < volume0.resolution_; x++) {
+        for (int y = 0; y < volume0.resolution_; y++) {
+            for (int z = 0; z < volume0.resolution_; z++) {
+                Eigen::Vector3i idx0(x, y, z);
+                int cube_index = 0;
+                float w[8];
+                float f[8];
+                Eigen::Vector3d c[8];
+                for (int i = 0; i < 8; i++) {
+                    Eigen::Vector3i index1 = index0;
+                    Eigen::Vector3i idx1 = idx0 + shift[i];
+                    const UniformTSDFVolume *volume1 = &volume0;
+                    if (idx1(0) >= volume_unit_resolution_ ||
+                        idx1(1) >= volume_unit_resolution_ ||
+                        idx1(2) >= volume_unit_resolution_) {
+                        for (int j = 0; j < 3; j++) {
+                            if (idx1(j) >= volume_unit_resolution_) {
+                                idx1(j) -= volume_unit_resolution_;
+                                index1(j) += 1;
+                            }
+                        }
+                        auto unit_itr1 = volume_units_.find(index1);
+                        volume1 = unit_itr1 == volume_units_.end()
+                                          ? nullptr
+                                          : unit_itr1->second.volume_.get();
+                    }
+                    if (volume1 == nullptr) {
+                        w[i] = 0.0f;
+                        f[i] = 0.0f;
+                    } else {
+                        int ind1 = volume1->IndexOf(idx1);
+                        w[i] = volume1->GetWeight(ind1);
+                        f[i] = volume1->GetTSDF(ind1);
+                        if (color_type_ == TSDFVolumeColorType::RGB8) {
+                            c[i] = volume1->GetColor(ind1) / 255.0;
+                        } else if (color_type_ ==
+                                   TSDFVolumeColorType::Gray32) {
+                            c[i] = volume1->GetColor(ind1);
+                        }
+                    }
+                    if (w[i] == 0.0f) {
+                        cube_index = 0;
+                        break;
+                    } else {
+                        if (f[i] < 0.0f) {
+                            cube_index |= (1 << i);
+                        }
+                    }
+                }
+                if (cube_index == 0 || cube_index == 255) {
+                    continue;
+                }
+                for (int i = 0; i < 12; i++) {
+                    if (edge_table[cube_index] & (1 << i)) {
+                        Eigen::Vector4i local_edge_index =
+                                Eigen::Vector4i(x, y, z, 0) + edge_shift[i];
+                        Eigen::Vector4i edge_index =
+                                Eigen::Vector4i(index0(0), index0(1),
+                                                index0(2), 0) *
+                                        volume_unit_resolution_ +
+                                local_edge_index;
+                        auto itr = edgeindex_to_vertexindex.find(edge_index);
+                        if (itr != edgeindex_to_vertexindex.end()) {
+                            edge_to_index[i] = itr->second;
+                            continue;
+                        }
+                        edge_to_index[i] = (int)fragment.vertices_.size();
+                        edgeindex_to_vertexindex[edge_index] = edge_to_index[i];
+                        if (IsBoundaryEdge(local_edge_index)) {
+                            fragment.boundary_vertex_indices_.push_back(
+                                    edge_to_index[i]);
+                            fragment.boundary_edge_indices_.push_back(
+                                    edge_index);
+                        }
+                        Eigen::Vector3d pt(
+                                half_voxel_length +
+                                        voxel_length_ * edge_index(0),
+                                half_voxel_length +
+                                        voxel_length_ * edge_index(1),
+                                half_voxel_length +
+                                        voxel_length_ * edge_index(2));
+                        double f0 = std::abs((double)f[edge_to_vert[i][0]]);
+                        double f1 = std::abs((double)f[edge_to_vert[i][1]]);
+                        pt(edge_index(3)) += f0 * voxel_length_ / (f0 + f1);
+                        fragment.vertices_.push_back(pt);
+                        if (color_type_ != TSDFVolumeColorType::NoColor) {
+                            const auto &c0 = c[edge_to_vert[i][0]];
+                            const auto &c1 = c[edge_to_vert[i][1]];
+                            fragment.vertex_colors_.push_back(
+                                    (f1 * c0 + f0 * c1) / (f0 + f1));
+                        }
+                    }
+                }
+                for (int i = 0; tri_table[cube_index][i] != -1; i += 3) {
+                    fragment.triangles_.push_back(Eigen::Vector3i(
+                            edge_to_index[tri_table[cube_index][i]],
+                            edge_to_index[tri_table[cube_index][i + 2]],
+                            edge_to_index[tri_table[cube_index][i + 1]]));
+                }
+            }
+        }
+    }
+}
+
+bool ScalableTSDFVolume::IsBoundaryEdge(const Eigen::Vector4i &edge) const {
+    // An edge starting at local coordinate p along axis a is shared by the
+    // cubes p - d, d in {0, 1} along the two other axes. The edge is interior
+    // if all of these cubes belong to the same volume unit.
+    for (int i = 0; i < 3; i++) {
+        if (i == edge(3)) {
+            if (edge(i) >= volume_unit_resolution_) return true;
+        } else {
+            if (edge(i) < 1 || edge(i) >= volume_unit_resolution_) return true;
+        }
+    }
+    return false;
+}
+
+const geometry::Image &ScalableTSDFVolume::GetDepthToCameraDistanceMultiplier(
+        const camera::PinholeCameraIntrinsic &intrinsic) {
+    if (!depth_to_camera_distance_multiplier_ ||
+        depth_to_camera_distance_intrinsic_.width_ != intrinsic.width_ ||
+        depth_to_camera_distance_intrinsic_.height_ != intrinsic.height_ ||
+        depth_to_camera_distance_intrinsic_.intrinsic_matrix_ !=
+                intrinsic.intrinsic_matrix_) {
+        depth_to_camera_distance_multiplier_ = geometry::Image::
+                CreateDepthToCameraDistanceMultiplierFloatImage(intrinsic);
+        depth_to_camera_distance_intrinsic_ = intrinsic;
+    }
+    return *depth_to_camera_distance_multiplier_;
+}
+
+bool ScalableTSDFVolume::GetRayCastBound(Eigen::Vector3d &min_bound,
+                                         Eigen::Vector3d &max_bound) const {
+    if (volume_units_.empty()) {
+        return false;
+    }
+    Eigen::Vector3i min_index = volume_units_.begin()->first;
+    Eigen::Vector3i max_index = min_index;
+    for (const auto &unit : volume_units_) {
+        min_index = min_index.cwiseMin(unit.first);
+        max_index = max_index.cwiseMax(unit.first);
+    }
+    const double half_voxel_length = voxel_length_ * 0.5;
+    min_bound = min_index.cast<double>() * volume_unit_length_ +
+                Eigen::Vector3d::Constant(half_voxel_length);
+    max_bound = (max_index + Eigen::Vector3i::Ones()).cast<double>() *
+                        volume_unit_length_ -
+                Eigen::Vector3d::Constant(half_voxel_length);
+    return true;
+}
+
+double ScalableTSDFVolume::GetEmptySpaceLength(
+        const Eigen::Vector3d &p, const Eigen::Vector3d &direction) const {
+    // Same shift as in SampleTSDFAt: a sample is interpolated from the unit
+    // containing p_locate, which is empty if that unit is not allocated.
+    Eigen::Vector3d p_locate =
+            p - Eigen::Vector3d(0.5, 0.5, 0.5) * voxel_length_;
+    Eigen::Vector3i index = LocateVolumeUnit(p_locate);
+    if (volume_units_.find(index) != volume_units_.end()) {
+        return 0.0;
+    }
+    // Skip to the exit of the unallocated unit.
+    double t_exit = std::numeric_limits<double>::max();
+    for (int i = 0; i < 3; i++) {
+        if (direction(i) > 0.0) {
+            t_exit = std::min(t_exit, ((index(i) + 1) * volume_unit_length_ -
+                                       p_locate(i)) /
+                                              direction(i));
+        } else if (direction(i) < 0.0) {
+            t_exit = std::min(
+                    t_exit,
+                    (index(i) * volume_unit_length_ - p_locate(i)) /
+                            direction(i));
+        }
+    }
+    return std::max(t_exit, 0.0) + 1e-3 * voxel_length_ / direction.norm();
+}
+
+bool ScalableTSDFVolume::SampleTSDFAt(const Eigen::Vector3d &p,
+                                      float &tsdf,
+                                      Eigen::Vector3d *color) const {
+    Eigen::Vector3d p_locate =
+            p - Eigen::Vector3d(0.5, 0.5, 0.5) * voxel_length_;
+    Eigen::Vector3i index0 = LocateVolumeUnit(p_locate);
+    auto unit_itr = volume_units_.find(index0);
+    if (unit_itr == volume_units_.end() || !unit_itr->second.volume_) {
+        return false;
+    }
+    const auto &volume0 = *unit_itr->second.volume_;
+    Eigen::Vector3i idx0;
+    Eigen::Vector3d p_grid =
+            (p_locate - index0.cast<double>() * volume_unit_length_) /
+            voxel_length_;
+    for (int i = 0; i < 3; i++) {
+        idx0(i) = (int)std::floor(p_grid(i));
+        if (idx0(i) < 0) idx0(i) = 0;
+        if (idx0(i) >= volume_unit_resolution_)
+            idx0(i) = volume_unit_resolution_ - 1;
+    }
+    return InterpolateTrilinear(
+            p_grid - idx0.cast<double>(),
+            [this, &index0, &idx0, &volume0](const Eigen::Vector3i &offset,
+                                             float &voxel_tsdf,
+                                             Eigen::Vector3d *voxel_color) {
+                Eigen::Vector3i index1 = index0;
+                Eigen::Vector3i idx1 = idx0 + offset;
+                const UniformTSDFVolume *volume1 = &volume0;
+                if (idx1(0) >= volume_unit_resolution_ ||
+                    idx1(1) >= volume_unit_resolution_ ||
+                    idx1(2) >= volume_unit_resolution_) {
+                    for (int j = 0; j < 3; j++) {
+                        if (idx1(j) >= volume_unit_resolution_) {
+                            idx1(j) -= volume_unit_resolution_;
+                            index1(j) += 1;
+                        }
+                    }
+                    auto unit_itr1 = volume_units_.find(index1);
+                    if (unit_itr1 == volume_units_.end() ||
+                        !unit_itr1->second.volume_) {
+                        return false;
+                    }
+                    volume1 = unit_itr1->second.volume_.get();
+                }
+                int ind1 = volume1->IndexOf(idx1);
+                if (volume1->GetWeight(ind1) == 0.0f) {
+                    return false;
+                }
+                voxel_tsdf = volume1->GetTSDF(ind1);
+                if (voxel_color != nullptr) {
+                    *voxel_color = volume1->GetColor(ind1);
+                }
+                return true;
+            },
+            tsdf, color);
+}
+
 Eigen::Vector3d ScalableTSDFVolume::GetNormalAt(const Eigen::Vector3d &p) {
     Eigen::Vector3d n;
     const double half_gap = 0.99 * voxel_length_;
@@ -421,7 +656,7 @@ double ScalableTSDFVolume::GetTSDFAt(const Eigen::Vector3d &p) {
         if (idx1(0) < volume_unit_resolution_ &&
             idx1(1) < volume_unit_resolution_ &&
             idx1(2) < volume_unit_resolution_) {
-            f[i] = volume0.voxels_[volume0.IndexOf(idx1)].tsdf_;
+            f[i] = volume0.GetTSDF(volume0.IndexOf(idx1));
         } else {
             for (int j = 0; j < 3; j++) {
                 if (idx1(j) >= volume_unit_resolution_) {
@@ -434,7 +669,7 @@ double ScalableTSDFVolume::GetTSDFAt(const Eigen::Vector3d &p) {
                 f[i] = 0.0f;
             } else {
                 const auto &volume1 = *unit_itr1->second.volume_;
-                f[i] = volume1.voxels_[volume1.IndexOf(idx1)].tsdf_;
+                f[i] = volume1.GetTSDF(volume1.IndexOf(idx1));
             }
         }
     }
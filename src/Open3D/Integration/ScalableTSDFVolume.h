@@ -57,6 +57,20 @@ class UniformTSDFVolume;
 /// structure edges.
 class ScalableTSDFVolume : public TSDFVolume {
 public:
+    /// Marching cubes output of the cubes of a volume unit. Vertices are
+    /// indexed locally. The vertices on the boundary of the unit also keep
+    /// their global edge index so that they can be merged with the vertices
+    /// of the neighboring fragments.
+    struct MeshFragment {
+    public:
+        std::vector<Eigen::Vector3d> vertices_;
+        std::vector<Eigen::Vector3d> vertex_colors_;
+        std::vector<Eigen::Vector3i> triangles_;
+        std::vector<int> boundary_vertex_indices_;
+        std::vector<Eigen::Vector4i, Eigen::aligned_allocator<Eigen::Vector4i>>
+                boundary_edge_indices_;
+    };
+
     struct VolumeUnit {
     public:
         VolumeUnit() : volume_(NULL) {}
@@ -64,6 +78,9 @@ public:
     public:
         std::shared_ptr<UniformTSDFVolume> volume_;
         Eigen::Vector3i index_;
+        /// Cached mesh fragment of the unit, reset when the unit or one of its
+        /// neighbors is integrated.
+        std::shared_ptr<MeshFragment> mesh_fragment_;
     };
 
 public:
@@ -71,7 +88,9 @@ public:
                        double sdf_trunc,
                        TSDFVolumeColorType color_type,
                        int volume_unit_resolution = 16,
-                       int depth_sampling_stride = 4);
+                       int depth_sampling_stride = 4,
+                       TSDFVoxelStorageType storage_type =
+                               TSDFVoxelStorageType::Voxel);
     ~ScalableTSDFVolume() override;
 
 public:
@@ -80,6 +99,9 @@ public:
                    const camera::PinholeCameraIntrinsic &intrinsic,
                    const Eigen::Matrix4d &extrinsic) override;
     std::shared_ptr<geometry::PointCloud> ExtractPointCloud() override;
+    /// Function to extract a triangle mesh. Only the volume units that changed
+    /// since the previous call are re-meshed, the others reuse their cached
+    /// mesh fragments.
     std::shared_ptr<geometry::TriangleMesh> ExtractTriangleMesh() override;
     /// Debug function to extract the voxel data into a point cloud.
     std::shared_ptr<geometry::PointCloud> ExtractVoxelPointCloud();
@@ -88,6 +110,8 @@ public:
     int volume_unit_resolution_;
     double volume_unit_length_;
     int depth_sampling_stride_;
+    /// Memory layout of the voxels of the volume units.
+    TSDFVoxelStorageType storage_type_;
 
     /// Assume the index of the volume unit is (x, y, z), then the unit spans
     /// from (x, y, z) * volume_unit_length_
@@ -97,8 +121,17 @@ public:
                        utility::hash_eigen::hash<Eigen::Vector3i>>
             volume_units_;
 
+protected:
+    bool GetRayCastBound(Eigen::Vector3d &min_bound,
+                         Eigen::Vector3d &max_bound) const override;
+    double GetEmptySpaceLength(const Eigen::Vector3d &p,
+                               const Eigen::Vector3d &direction) const override;
+    bool SampleTSDFAt(const Eigen::Vector3d &p,
+                      float &tsdf,
+                      Eigen::Vector3d *color) const override;
+
 private:
-    Eigen::Vector3i LocateVolumeUnit(const Eigen::Vector3d &point) {
+    Eigen::Vector3i LocateVolumeUnit(const Eigen::Vector3d &point) const {
         return Eigen::Vector3i((int)std::floor(point(0) / volume_unit_length_),
                                (int)std::floor(point(1) / volume_unit_length_),
                                (int)std::floor(point(2) / volume_unit_length_));
@@ -107,9 +140,27 @@ private:
     std::shared_ptr<UniformTSDFVolume> OpenVolumeUnit(
             const Eigen::Vector3i &index);
 
+    /// Returns the depth to camera distance multiplier image of the given
+    /// intrinsic. The image is cached and only recomputed when the intrinsic
+    /// changes between two calls.
+    const geometry::Image &GetDepthToCameraDistanceMultiplier(
+            const camera::PinholeCameraIntrinsic &intrinsic);
+
+    /// Runs marching cubes over the cubes whose origin lies in \p unit.
+    void ExtractMeshFragment(const VolumeUnit &unit,
+                             MeshFragment &fragment) const;
+
+    /// Returns true if the edge (local start coordinate, axis) is shared with
+    /// cubes of a neighboring volume unit.
+    bool IsBoundaryEdge(const Eigen::Vector4i &edge) const;
+
     Eigen::Vector3d GetNormalAt(const Eigen::Vector3d &p);
 
     double GetTSDFAt(const Eigen::Vector3d &p);
+
+private:
+    std::shared_ptr<geometry::Image> depth_to_camera_distance_multiplier_;
+    camera::PinholeCameraIntrinsic depth_to_camera_distance_intrinsic_;
 };
 
 }  // namespace integration
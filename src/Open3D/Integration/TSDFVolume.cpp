@@ -0,0 +1,221 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Integration/TSDFVolume.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace integration {
+
+bool TSDFVolume::GetRayCastBound(Eigen::Vector3d &min_bound,
+                                 Eigen::Vector3d &max_bound) const {
+    utility::LogError("RayCast is not supported by this volume");
+    return false;
+}
+
+bool TSDFVolume::SampleTSDFAt(const Eigen::Vector3d &p,
+                              float &tsdf,
+                              Eigen::Vector3d *color) const {
+    utility::LogError("RayCast is not supported by this volume");
+    return false;
+}
+
+std::tuple<std::shared_ptr<geometry::Image>,
+           std::shared_ptr<geometry::Image>,
+           std::shared_ptr<geometry::Image>,
+           std::shared_ptr<geometry::Image>>
+TSDFVolume::RayCast(const camera::PinholeCameraIntrinsic &intrinsic,
+                    const Eigen::Matrix4d &extrinsic) const {
+    const int width = intrinsic.width_;
+    const int height = intrinsic.height_;
+    auto depth = std::make_shared<geometry::Image>();
+    auto vertex = std::make_shared<geometry::Image>();
+    auto normal = std::make_shared<geometry::Image>();
+    auto color = std::make_shared<geometry::Image>();
+    depth->Prepare(width, height, 1, 4);
+    vertex->Prepare(width, height, 3, 4);
+    normal->Prepare(width, height, 3, 4);
+    if (color_type_ == TSDFVolumeColorType::RGB8) {
+        color->Prepare(width, height, 3, 1);
+    } else if (color_type_ == TSDFVolumeColorType::Gray32) {
+        color->Prepare(width, height, 1, 4);
+    }
+
+    Eigen::Vector3d min_bound, max_bound;
+    if (!GetRayCastBound(min_bound, max_bound)) {
+        return std::make_tuple(depth, vertex, normal, color);
+    }
+    // Sample once outside of the parallel loop, where an error of a volume
+    // that does not implement SampleTSDFAt() can be thrown to the caller.
+    float tsdf_probe;
+    SampleTSDFAt(min_bound, tsdf_probe, nullptr);
+
+    const Eigen::Matrix4d pose = extrinsic.inverse();
+    const Eigen::Matrix3d rotation = pose.block<3, 3>(0, 0);
+    const Eigen::Vector3d origin = pose.block<3, 1>(0, 3);
+    const double fx = intrinsic.GetFocalLength().first;
+    const double fy = intrinsic.GetFocalLength().second;
+    const double cx = intrinsic.GetPrincipalPoint().first;
+    const double cy = intrinsic.GetPrincipalPoint().second;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int v = 0; v < height; v++) {
+        for (int u = 0; u < width; u++) {
+            // The ray parameter t is the depth of the sample in the camera
+            // frame, since the camera space direction has unit z.
+            const Eigen::Vector3d direction =
+                    rotation * Eigen::Vector3d((u - cx) / fx, (v - cy) / fy, 1);
+            const double inv_direction_norm = 1.0 / direction.norm();
+
+            // Clip the ray to the bounding box (slab test).
+            double t_min = 0.0;
+            double t_max = std::numeric_limits<double>::max();
+            for (int i = 0; i < 3; i++) {
+                if (direction(i) == 0.0) {
+                    if (origin(i) < min_bound(i) || origin(i) > max_bound(i)) {
+                        t_max = -1.0;
+                    }
+                    continue;
+                }
+                double t0 = (min_bound(i) - origin(i)) / direction(i);
+                double t1 = (max_bound(i) - origin(i)) / direction(i);
+                t_min = std::max(t_min, std::min(t0, t1));
+                t_max = std::min(t_max, std::max(t0, t1));
+            }
+            if (t_min > t_max) {
+                continue;
+            }
+
+            // March along the ray until the TSDF changes sign.
+            double t = t_min;
+            double t_prev = t_min;
+            float tsdf = 0.0f;
+            float tsdf_prev = 0.0f;
+            bool is_prev_valid = false;
+            bool is_hit = false;
+            while (t <= t_max) {
+                const Eigen::Vector3d p = origin + t * direction;
+                double skip = GetEmptySpaceLength(p, direction);
+                if (skip > 0.0) {
+                    t += skip;
+                    is_prev_valid = false;
+                    continue;
+                }
+                if (!SampleTSDFAt(p, tsdf, nullptr)) {
+                    t += voxel_length_ * inv_direction_norm;
+                    is_prev_valid = false;
+                    continue;
+                }
+                if (is_prev_valid && tsdf_prev > 0.0f && tsdf <= 0.0f) {
+                    is_hit = true;
+                    break;
+                }
+                if (is_prev_valid && tsdf_prev < 0.0f && tsdf > 0.0f) {
+                    // Leaving a surface from behind.
+                    break;
+                }
+                t_prev = t;
+                tsdf_prev = tsdf;
+                is_prev_valid = true;
+                // The TSDF is a lower bound of the distance to the surface in
+                // the truncation band, which allows larger steps away from it.
+                t += std::max(voxel_length_, tsdf * sdf_trunc_) *
+                     inv_direction_norm;
+            }
+            if (!is_hit) {
+                continue;
+            }
+
+            // Refine the zero crossing by linear interpolation, followed by
+            // one secant step on the bracketing sub-interval.
+            double t_hit =
+                    t_prev + (t - t_prev) * tsdf_prev / (tsdf_prev - tsdf);
+            float tsdf_hit;
+            if (SampleTSDFAt(origin + t_hit * direction, tsdf_hit, nullptr)) {
+                if (tsdf_hit > 0.0f) {
+                    t_hit += (t - t_hit) * tsdf_hit / (tsdf_hit - tsdf);
+                } else if (tsdf_hit < 0.0f) {
+                    t_hit = t_prev + (t_hit - t_prev) * tsdf_prev /
+                                             (tsdf_prev - tsdf_hit);
+                }
+            }
+            const Eigen::Vector3d p = origin + t_hit * direction;
+            Eigen::Vector3d c(0, 0, 0);
+            if (!SampleTSDFAt(p, tsdf_hit, &c)) {
+                continue;
+            }
+
+            // The normal is the normalized gradient of the TSDF, using
+            // one-sided differences next to unobserved voxels.
+            Eigen::Vector3d n(0, 0, 0);
+            for (int i = 0; i < 3; i++) {
+                Eigen::Vector3d p0 = p;
+                Eigen::Vector3d p1 = p;
+                p0(i) -= voxel_length_;
+                p1(i) += voxel_length_;
+                float tsdf0, tsdf1;
+                bool is_valid0 = SampleTSDFAt(p0, tsdf0, nullptr);
+                bool is_valid1 = SampleTSDFAt(p1, tsdf1, nullptr);
+                if (is_valid0 && is_valid1) {
+                    n(i) = (tsdf1 - tsdf0) * 0.5;
+                } else if (is_valid0) {
+                    n(i) = tsdf_hit - tsdf0;
+                } else if (is_valid1) {
+                    n(i) = tsdf1 - tsdf_hit;
+                }
+            }
+            if (n.squaredNorm() == 0.0) {
+                continue;
+            }
+            n.normalize();
+
+            *depth->PointerAt<float>(u, v) = (float)t_hit;
+            for (int i = 0; i < 3; i++) {
+                *vertex->PointerAt<float>(u, v, i) = (float)p(i);
+                *normal->PointerAt<float>(u, v, i) = (float)n(i);
+            }
+            if (color_type_ == TSDFVolumeColorType::RGB8) {
+                for (int i = 0; i < 3; i++) {
+                    *color->PointerAt<uint8_t>(u, v, i) = (uint8_t)std::lround(
+                            std::min(std::max(c(i), 0.0), 255.0));
+                }
+            } else if (color_type_ == TSDFVolumeColorType::Gray32) {
+                *color->PointerAt<float>(u, v) = (float)c(0);
+            }
+        }
+    }
+    return std::make_tuple(depth, vertex, normal, color);
+}
+
+}  // namespace integration
+}  // namespace open3d
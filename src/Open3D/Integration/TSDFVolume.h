@@ -26,6 +26,8 @@
 
 #pragma once
 
+#include <tuple>
+
 #include "Open3D/Camera/PinholeCameraIntrinsic.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Geometry/RGBDImage.h"
@@ -46,6 +48,20 @@ enum class TSDFVolumeColorType {
     Gray32 = 2,
 };
 
+/// \enum TSDFVoxelStorageType
+///
+/// Enum class for the memory layout of the voxels of a TSDF volume.
+enum class TSDFVoxelStorageType {
+    /// Array of geometry::TSDFVoxel, about 48 bytes per voxel.
+    Voxel = 0,
+    /// Planar arrays of float16 TSDF, uint16 weight and uint8 color, 4 to 7
+    /// bytes per voxel.
+    Float16 = 1,
+    /// Planar arrays of int16 TSDF, uint16 weight and uint8 color, 4 to 7
+    /// bytes per voxel.
+    Int16 = 2,
+};
+
 /// \class TSDFVolume
 ///
 /// \brief Base class of the Truncated Signed Distance Function (TSDF) volume.
@@ -88,6 +104,89 @@ public:
     /// algorithm. (https://en.wikipedia.org/wiki/Marching_cubes)
     virtual std::shared_ptr<geometry::TriangleMesh> ExtractTriangleMesh() = 0;
 
+    /// \brief Function to render the volume from a camera pose by ray casting
+    /// the zero crossing of the TSDF.
+    ///
+    /// Rays march through the volume with trilinear interpolation of the TSDF,
+    /// skipping empty space, and the first zero crossing from positive to
+    /// negative TSDF is refined by linear interpolation. Pixels whose ray does
+    /// not hit the surface are 0 in all images.
+    ///
+    /// \param intrinsic Pinhole camera intrinsic parameters.
+    /// \param extrinsic Extrinsic parameters (world to camera).
+    /// \return Tuple of depth (1 channel float, in meters), vertex (3 channel
+    /// float, world coordinates), normal (3 channel float) and color images.
+    /// The color image has the format of the integrated color images: 3
+    /// channel uint8 for RGB8, 1 channel float for Gray32 and empty for
+    /// NoColor.
+    std::tuple<std::shared_ptr<geometry::Image>,
+               std::shared_ptr<geometry::Image>,
+               std::shared_ptr<geometry::Image>,
+               std::shared_ptr<geometry::Image>>
+    RayCast(const camera::PinholeCameraIntrinsic &intrinsic,
+            const Eigen::Matrix4d &extrinsic) const;
+
+protected:
+    // The functions below implement RayCast(). Volumes that do not override
+    // GetRayCastBound() and SampleTSDFAt() raise an error when RayCast() is
+    // called.
+
+    /// Returns the bounding box outside of which rays never hit, or false if
+    /// the volume is empty. Samples interpolate the 8 surrounding voxel
+    /// centers, so the box lies half a voxel inside the allocated space.
+    virtual bool GetRayCastBound(Eigen::Vector3d &min_bound,
+                                 Eigen::Vector3d &max_bound) const;
+
+    /// Returns the length that the ray starting at \p p with direction \p
+    /// direction can skip because it runs through unallocated space, in
+    /// multiples of \p direction. By default no space is skipped.
+    virtual double GetEmptySpaceLength(const Eigen::Vector3d &p,
+                                       const Eigen::Vector3d &direction) const {
+        return 0.0;
+    }
+
+    /// Trilinear interpolation of the TSDF (and the color if \p color is not
+    /// nullptr) at \p p in world coordinates. Returns false if one of the
+    /// interpolated voxels has not been observed.
+    virtual bool SampleTSDFAt(const Eigen::Vector3d &p,
+                              float &tsdf,
+                              Eigen::Vector3d *color) const;
+
+    /// Trilinear interpolation shared by the SampleTSDFAt() implementations.
+    /// \p r is the position of the sample relative to the first of the 8
+    /// surrounding voxels, in voxels. \p get_voxel(offset, tsdf, color) reads
+    /// the voxel at \p offset from the first one and returns false if it has
+    /// not been observed; \p color is nullptr if the color is not needed.
+    template <typename GetVoxel>
+    static bool InterpolateTrilinear(const Eigen::Vector3d &r,
+                                     const GetVoxel &get_voxel,
+                                     float &tsdf,
+                                     Eigen::Vector3d *color) {
+        double tsdf_sum = 0.0;
+        Eigen::Vector3d color_sum(0, 0, 0);
+        for (int i = 0; i < 8; i++) {
+            const Eigen::Vector3i offset(i & 1, (i >> 1) & 1, (i >> 2) & 1);
+            float voxel_tsdf;
+            Eigen::Vector3d voxel_color;
+            if (!get_voxel(offset, voxel_tsdf,
+                           color != nullptr ? &voxel_color : nullptr)) {
+                return false;
+            }
+            const double w = (offset(0) ? r(0) : 1 - r(0)) *
+                             (offset(1) ? r(1) : 1 - r(1)) *
+                             (offset(2) ? r(2) : 1 - r(2));
+            tsdf_sum += w * voxel_tsdf;
+            if (color != nullptr) {
+                color_sum += w * voxel_color;
+            }
+        }
+        tsdf = (float)tsdf_sum;
+        if (color != nullptr) {
+            *color = color_sum;
+        }
+        return true;
+    }
+
 public:
     /// Length of the voxel in meters.
     double voxel_length_;
@@ -37,23 +37,75 @@
 namespace open3d {
 namespace integration {
 
+namespace {
+
+/// Weight, in frames, above which the uint8 colors of the compact storage
+/// types become an exponential moving average.
+constexpr float kMaxColorWeight = 255.0f;
+
+/// Updates the uint8 running average \p color with the observation \p
+/// observed, both in [0, 255]. Rounding to the nearest level would discard
+/// every observation that differs by less than (weight + 1) / 2 levels and
+/// freeze the color, so the rounding is dithered with a hash of the voxel
+/// index \p key and its \p weight, which rounds correctly on average.
+inline uint8_t UpdateColorUInt8(uint8_t color,
+                                float observed,
+                                float weight,
+                                uint32_t key) {
+    const float color_weight = std::min(weight, kMaxColorWeight);
+    const float average =
+            (color * color_weight + observed) / (color_weight + 1.0f);
+    uint32_t hash = (key * 2654435761u) ^ (uint32_t(weight) * 2246822519u);
+    hash ^= hash >> 15;
+    hash *= 2246822519u;
+    hash ^= hash >> 13;
+    const float dither = (hash >> 8) * (1.0f / 16777216.0f);
+    return (uint8_t)std::min(std::floor(average + dither), 255.0f);
+}
+
+}  // unnamed namespace
+
 UniformTSDFVolume::UniformTSDFVolume(
         double length,
         int resolution,
         double sdf_trunc,
         TSDFVolumeColorType color_type,
-        const Eigen::Vector3d &origin /* = Eigen::Vector3d::Zero()*/)
+        const Eigen::Vector3d &origin /* = Eigen::Vector3d::Zero()*/,
+        TSDFVoxelStorageType storage_type /* = TSDFVoxelStorageType::Voxel*/)
     : TSDFVolume(length / (double)resolution, sdf_trunc, color_type),
+      storage_type_(storage_type),
       origin_(origin),
       length_(length),
       resolution_(resolution),
       voxel_num_(resolution * resolution * resolution) {
-    voxels_.resize(voxel_num_);
+    switch (storage_type_) {
+        case TSDFVoxelStorageType::Voxel:
+            voxels_.resize(voxel_num_);
+            return;
+        case TSDFVoxelStorageType::Float16:
+            tsdf_float16_.resize(voxel_num_, Eigen::half(0.0f));
+            break;
+        case TSDFVoxelStorageType::Int16:
+            tsdf_int16_.resize(voxel_num_, 0);
+            break;
+    }
+    weight_uint16_.resize(voxel_num_, 0);
+    if (color_type_ == TSDFVolumeColorType::RGB8) {
+        color_uint8_.resize(voxel_num_ * 3, 0);
+    } else if (color_type_ == TSDFVolumeColorType::Gray32) {
+        color_uint8_.resize(voxel_num_, 0);
+    }
 }
 
 UniformTSDFVolume::~UniformTSDFVolume() {}
 
-void UniformTSDFVolume::Reset() { voxels_.clear(); }
+void UniformTSDFVolume::Reset() {
+    voxels_.clear();
+    tsdf_float16_.clear();
+    tsdf_int16_.clear();
+    weight_uint16_.clear();
+    color_uint8_.clear();
+}
 
 void UniformTSDFVolume::Integrate(
         const geometry::RGBDImage &image,
@@ -95,9 +147,9 @@ std::shared_ptr<geometry::PointCloud> UniformTSDFVolume::ExtractPointCloud() {
         for (int y = 1; y < resolution_ - 1; y++) {
             for (int z = 1; z < resolution_ - 1; z++) {
                 Eigen::Vector3i idx0(x, y, z);
-                float w0 = voxels_[IndexOf(idx0)].weight_;
-                float f0 = voxels_[IndexOf(idx0)].tsdf_;
-                const Eigen::Vector3d &c0 = voxels_[IndexOf(idx0)].color_;
+                float w0 = GetWeight(IndexOf(idx0));
+                float f0 = GetTSDF(IndexOf(idx0));
+                const Eigen::Vector3d c0 = GetColor(IndexOf(idx0));
 
                 if (!(w0 != 0.0f && f0 < 0.98f && f0 >= -0.98f)) {
                     continue;
@@ -111,10 +163,9 @@ std::shared_ptr<geometry::PointCloud> UniformTSDFVolume::ExtractPointCloud() {
                     Eigen::Vector3i idx1 = idx0;
                     idx1(i) += 1;
                     if (idx1(i) < resolution_ - 1) {
-                        float w1 = voxels_[IndexOf(idx1)].weight_;
-                        float f1 = voxels_[IndexOf(idx1)].tsdf_;
-                        const Eigen::Vector3d &c1 =
-                                voxels_[IndexOf(idx1)].color_;
+                        float w1 = GetWeight(IndexOf(idx1));
+                        float f1 = GetTSDF(IndexOf(idx1));
+                        const Eigen::Vector3d c1 = GetColor(IndexOf(idx1));
                         if (w1 != 0.0f && f1 < 0.98f && f1 >= -0.98f &&
                             f0 * f1 < 0) {
                             float r0 = std::fabs(f0);
@@ -166,19 +217,18 @@ UniformTSDFVolume::ExtractTriangleMesh() {
                 for (int i = 0; i < 8; i++) {
                     Eigen::Vector3i idx = Eigen::Vector3i(x, y, z) + shift[i];
 
-                    if (voxels_[IndexOf(idx)].weight_ == 0.0f) {
+                    if (GetWeight(IndexOf(idx)) == 0.0f) {
                         cube_index = 0;
                         break;
                     } else {
-                        f[i] = voxels_[IndexOf(idx)].tsdf_;
+                        f[i] = GetTSDF(IndexOf(idx));
                         if (f[i] < 0.0f) {
                             cube_index |= (1 << i);
                         }
                         if (color_type_ == TSDFVolumeColorType::RGB8) {
-                            c[i] = voxels_[IndexOf(idx)].color_.cast<double>() /
-                                   255.0;
+                            c[i] = GetColor(IndexOf(idx)) / 255.0;
                         } else if (color_type_ == TSDFVolumeColorType::Gray32) {
-                            c[i] = voxels_[IndexOf(idx)].color_.cast<double>();
+                            c[i] = GetColor(IndexOf(idx));
                         }
                     }
                 }
@@ -244,11 +294,11 @@ UniformTSDFVolume::ExtractVoxelPointCloud() const {
                                    half_voxel_length + voxel_length_ * y,
                                    half_voxel_length + voxel_length_ * z);
                 int ind = IndexOf(x, y, z);
-                if (voxels_[ind].weight_ != 0.0f &&
-                    voxels_[ind].tsdf_ < 0.98f &&
-                    voxels_[ind].tsdf_ >= -0.98f) {
+                const float w = GetWeight(ind);
+                const float f = GetTSDF(ind);
+                if (w != 0.0f && f < 0.98f && f >= -0.98f) {
                     voxel->points_.push_back(pt + origin_);
-                    double c = (voxels_[ind].tsdf_ + 1.0) * 0.5;
+                    double c = (f + 1.0) * 0.5;
                     voxel->colors_.push_back(Eigen::Vector3d(c, c, c));
                 }
             }
@@ -267,8 +317,8 @@ std::shared_ptr<geometry::VoxelGrid> UniformTSDFVolume::ExtractVoxelGrid()
         for (int y = 0; y < resolution_; y++) {
             for (int z = 0; z < resolution_; z++) {
                 const int ind = IndexOf(x, y, z);
-                const float w = voxels_[ind].weight_;
-                const float f = voxels_[ind].tsdf_;
+                const float w = GetWeight(ind);
+                const float f = GetTSDF(ind);
                 if (w != 0.0f && f < 0.98f && f >= -0.98f) {
                     double c = (f + 1.0) * 0.5;
                     Eigen::Vector3d color = Eigen::Vector3d(c, c, c);
@@ -286,6 +336,34 @@ void UniformTSDFVolume::IntegrateWithDepthToCameraDistanceMultiplier(
         const camera::PinholeCameraIntrinsic &intrinsic,
         const Eigen::Matrix4d &extrinsic,
         const geometry::Image &depth_to_camera_distance_multiplier) {
+    switch (storage_type_) {
+        case TSDFVoxelStorageType::Voxel:
+            IntegrateWithDepthToCameraDistanceMultiplierImpl<
+                    TSDFVoxelStorageType::Voxel>(
+                    image, intrinsic, extrinsic,
+                    depth_to_camera_distance_multiplier);
+            break;
+        case TSDFVoxelStorageType::Float16:
+            IntegrateWithDepthToCameraDistanceMultiplierImpl<
+                    TSDFVoxelStorageType::Float16>(
+                    image, intrinsic, extrinsic,
+                    depth_to_camera_distance_multiplier);
+            break;
+        case TSDFVoxelStorageType::Int16:
+            IntegrateWithDepthToCameraDistanceMultiplierImpl<
+                    TSDFVoxelStorageType::Int16>(
+                    image, intrinsic, extrinsic,
+                    depth_to_camera_distance_multiplier);
+            break;
+    }
+}
+
+template <TSDFVoxelStorageType storage_type>
+void UniformTSDFVolume::IntegrateWithDepthToCameraDistanceMultiplierImpl(
+        const geometry::RGBDImage &image,
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        const Eigen::Matrix4d &extrinsic,
+        const geometry::Image &depth_to_camera_distance_multiplier) {
     const float fx = static_cast<float>(intrinsic.GetFocalLength().first);
     const float fy = static_cast<float>(intrinsic.GetFocalLength().second);
     const float cx = static_cast<float>(intrinsic.GetPrincipalPoint().first);
@@ -346,35 +424,108 @@ void UniformTSDFVolume::IntegrateWithDepthToCameraDistanceMultiplier(
                 if (sdf > -sdf_trunc_f) {
                     // integrate
                     float tsdf = std::min(1.0f, sdf * sdf_trunc_inv_f);
-                    voxels_[v_ind].tsdf_ =
-                            (voxels_[v_ind].tsdf_ * voxels_[v_ind].weight_ +
-                             tsdf) /
-                            (voxels_[v_ind].weight_ + 1.0f);
+                    if (storage_type == TSDFVoxelStorageType::Voxel) {
+                        auto &voxel = voxels_[v_ind];
+                        voxel.tsdf_ = (voxel.tsdf_ * voxel.weight_ + tsdf) /
+                                      (voxel.weight_ + 1.0f);
+                        if (color_type_ == TSDFVolumeColorType::RGB8) {
+                            const uint8_t *rgb =
+                                    image.color_.PointerAt<uint8_t>(u, v, 0);
+                            Eigen::Vector3d rgb_f(rgb[0], rgb[1], rgb[2]);
+                            voxel.color_ =
+                                    (voxel.color_ * voxel.weight_ + rgb_f) /
+                                    (voxel.weight_ + 1.0f);
+                        } else if (color_type_ ==
+                                   TSDFVolumeColorType::Gray32) {
+                            const float *intensity =
+                                    image.color_.PointerAt<float>(u, v, 0);
+                            voxel.color_ = (voxel.color_.array() *
+                                                    voxel.weight_ +
+                                            (*intensity)) /
+                                           (voxel.weight_ + 1.0f);
+                        }
+                        voxel.weight_ += 1.0f;
+                        continue;
+                    }
+                    // Compact storage: the running averages are computed in
+                    // float and quantized back into the planar arrays.
+                    const float weight = weight_uint16_[v_ind];
+                    const float weight_inv = 1.0f / (weight + 1.0f);
+                    const float tsdf_new =
+                            (GetTSDF(v_ind) * weight + tsdf) * weight_inv;
+                    if (storage_type == TSDFVoxelStorageType::Float16) {
+                        tsdf_float16_[v_ind] = Eigen::half(tsdf_new);
+                    } else {
+                        tsdf_int16_[v_ind] =
+                                (int16_t)std::lround(tsdf_new * 32767.0f);
+                    }
                     if (color_type_ == TSDFVolumeColorType::RGB8) {
                         const uint8_t *rgb =
                                 image.color_.PointerAt<uint8_t>(u, v, 0);
-                        Eigen::Vector3d rgb_f(rgb[0], rgb[1], rgb[2]);
-                        voxels_[v_ind].color_ =
-                                (voxels_[v_ind].color_ *
-                                         voxels_[v_ind].weight_ +
-                                 rgb_f) /
-                                (voxels_[v_ind].weight_ + 1.0f);
+                        uint8_t *color = &color_uint8_[v_ind * 3];
+                        for (int c = 0; c < 3; c++) {
+                            color[c] = UpdateColorUInt8(color[c], rgb[c],
+                                                        weight, v_ind * 3 + c);
+                        }
                     } else if (color_type_ == TSDFVolumeColorType::Gray32) {
-                        const float *intensity =
-                                image.color_.PointerAt<float>(u, v, 0);
-                        voxels_[v_ind].color_ =
-                                (voxels_[v_ind].color_.array() *
-                                         voxels_[v_ind].weight_ +
-                                 (*intensity)) /
-                                (voxels_[v_ind].weight_ + 1.0f);
+                        float intensity =
+                                *image.color_.PointerAt<float>(u, v, 0);
+                        intensity = std::min(std::max(intensity, 0.0f), 1.0f);
+                        color_uint8_[v_ind] =
+                                UpdateColorUInt8(color_uint8_[v_ind],
+                                                 intensity * 255.0f, weight,
+                                                 v_ind);
+                    }
+                    if (weight_uint16_[v_ind] < UINT16_MAX) {
+                        weight_uint16_[v_ind]++;
                     }
-                    voxels_[v_ind].weight_ += 1.0f;
                 }
             }
         }
     }
 }
 
+bool UniformTSDFVolume::GetRayCastBound(Eigen::Vector3d &min_bound,
+                                        Eigen::Vector3d &max_bound) const {
+    if (voxels_.empty() && weight_uint16_.empty()) {
+        return false;
+    }
+    const double half_voxel_length = voxel_length_ * 0.5;
+    min_bound = origin_ + Eigen::Vector3d::Constant(half_voxel_length);
+    max_bound =
+            origin_ + Eigen::Vector3d::Constant(length_ - half_voxel_length);
+    return true;
+}
+
+bool UniformTSDFVolume::SampleTSDFAt(const Eigen::Vector3d &p,
+                                     float &tsdf,
+                                     Eigen::Vector3d *color) const {
+    Eigen::Vector3d p_grid =
+            (p - origin_) / voxel_length_ - Eigen::Vector3d(0.5, 0.5, 0.5);
+    Eigen::Vector3i idx;
+    for (int i = 0; i < 3; i++) {
+        idx(i) = (int)std::floor(p_grid(i));
+        if (idx(i) < 0 || idx(i) >= resolution_ - 1) {
+            return false;
+        }
+    }
+    return InterpolateTrilinear(
+            p_grid - idx.cast<double>(),
+            [this, &idx](const Eigen::Vector3i &offset, float &voxel_tsdf,
+                         Eigen::Vector3d *voxel_color) {
+                int ind = IndexOf(idx + offset);
+                if (GetWeight(ind) == 0.0f) {
+                    return false;
+                }
+                voxel_tsdf = GetTSDF(ind);
+                if (voxel_color != nullptr) {
+                    *voxel_color = GetColor(ind);
+                }
+                return true;
+            },
+            tsdf, color);
+}
+
 Eigen::Vector3d UniformTSDFVolume::GetNormalAt(const Eigen::Vector3d &p) {
     Eigen::Vector3d n;
     const double half_gap = 0.99 * voxel_length_;
@@ -398,21 +549,21 @@ double UniformTSDFVolume::GetTSDFAt(const Eigen::Vector3d &p) {
 
     double tsdf = 0;
     tsdf += (1 - r(0)) * (1 - r(1)) * (1 - r(2)) *
-            voxels_[IndexOf(idx + Eigen::Vector3i(0, 0, 0))].tsdf_;
+            GetTSDF(IndexOf(idx + Eigen::Vector3i(0, 0, 0)));
     tsdf += (1 - r(0)) * (1 - r(1)) * r(2) *
-            voxels_[IndexOf(idx + Eigen::Vector3i(0, 0, 1))].tsdf_;
+            GetTSDF(IndexOf(idx + Eigen::Vector3i(0, 0, 1)));
     tsdf += (1 - r(0)) * r(1) * (1 - r(2)) *
-            voxels_[IndexOf(idx + Eigen::Vector3i(0, 1, 0))].tsdf_;
+            GetTSDF(IndexOf(idx + Eigen::Vector3i(0, 1, 0)));
     tsdf += (1 - r(0)) * r(1) * r(2) *
-            voxels_[IndexOf(idx + Eigen::Vector3i(0, 1, 1))].tsdf_;
+            GetTSDF(IndexOf(idx + Eigen::Vector3i(0, 1, 1)));
     tsdf += r(0) * (1 - r(1)) * (1 - r(2)) *
-            voxels_[IndexOf(idx + Eigen::Vector3i(1, 0, 0))].tsdf_;
+            GetTSDF(IndexOf(idx + Eigen::Vector3i(1, 0, 0)));
     tsdf += r(0) * (1 - r(1)) * r(2) *
-            voxels_[IndexOf(idx + Eigen::Vector3i(1, 0, 1))].tsdf_;
+            GetTSDF(IndexOf(idx + Eigen::Vector3i(1, 0, 1)));
     tsdf += r(0) * r(1) * (1 - r(2)) *
-            voxels_[IndexOf(idx + Eigen::Vector3i(1, 1, 0))].tsdf_;
+            GetTSDF(IndexOf(idx + Eigen::Vector3i(1, 1, 0)));
     tsdf += r(0) * r(1) * r(2) *
-            voxels_[IndexOf(idx + Eigen::Vector3i(1, 1, 1))].tsdf_;
+            GetTSDF(IndexOf(idx + Eigen::Vector3i(1, 1, 1)));
     return tsdf;
 }
 
@@ -26,6 +26,8 @@
 
 #pragma once
 
+#include <cstdint>
+
 #include "Open3D/Geometry/VoxelGrid.h"
 #include "Open3D/Integration/TSDFVolume.h"
 
@@ -54,13 +56,21 @@ namespace integration {
 ///
 /// \brief UniformTSDFVolume implements the classic TSDF volume with uniform
 /// voxel grid (Curless and Levoy 1996).
+///
+/// With TSDFVoxelStorageType::Voxel the voxels are stored in voxels_. The
+/// compact storage types keep TSDF, weight and color in planar arrays instead
+/// and leave voxels_ empty; the voxel grid index is implicit in both cases.
+/// Use GetTSDF(), GetWeight() and GetColor() to read voxels independently of
+/// the storage type.
 class UniformTSDFVolume : public TSDFVolume {
 public:
     UniformTSDFVolume(double length,
                       int resolution,
                       double sdf_trunc,
                       TSDFVolumeColorType color_type,
-                      const Eigen::Vector3d &origin = Eigen::Vector3d::Zero());
+                      const Eigen::Vector3d &origin = Eigen::Vector3d::Zero(),
+                      TSDFVoxelStorageType storage_type =
+                              TSDFVoxelStorageType::Voxel);
     ~UniformTSDFVolume() override;
 
 public:
@@ -92,8 +102,57 @@ public:
         return IndexOf(xyz(0), xyz(1), xyz(2));
     }
 
+    /// Returns the TSDF value of the voxel with linear index \p i.
+    inline float GetTSDF(int i) const {
+        switch (storage_type_) {
+            case TSDFVoxelStorageType::Float16:
+                return static_cast<float>(tsdf_float16_[i]);
+            case TSDFVoxelStorageType::Int16:
+                return tsdf_int16_[i] * (1.0f / 32767.0f);
+            default:
+                return voxels_[i].tsdf_;
+        }
+    }
+
+    /// Returns the weight of the voxel with linear index \p i.
+    inline float GetWeight(int i) const {
+        if (storage_type_ == TSDFVoxelStorageType::Voxel) {
+            return voxels_[i].weight_;
+        }
+        return static_cast<float>(weight_uint16_[i]);
+    }
+
+    /// Returns the color of the voxel with linear index \p i, in the range of
+    /// geometry::TSDFVoxel::color_ ([0, 255] for RGB8, [0, 1] for Gray32).
+    inline Eigen::Vector3d GetColor(int i) const {
+        if (storage_type_ == TSDFVoxelStorageType::Voxel) {
+            return voxels_[i].color_;
+        }
+        if (color_type_ == TSDFVolumeColorType::RGB8) {
+            return Eigen::Vector3d(color_uint8_[i * 3], color_uint8_[i * 3 + 1],
+                                   color_uint8_[i * 3 + 2]);
+        } else if (color_type_ == TSDFVolumeColorType::Gray32) {
+            double intensity = color_uint8_[i] / 255.0;
+            return Eigen::Vector3d(intensity, intensity, intensity);
+        }
+        return Eigen::Vector3d::Zero();
+    }
+
 public:
+    /// Voxels of the volume, used by TSDFVoxelStorageType::Voxel only.
     std::vector<geometry::TSDFVoxel> voxels_;
+    /// Memory layout of the voxels.
+    TSDFVoxelStorageType storage_type_;
+    /// TSDF values, used by TSDFVoxelStorageType::Float16 only.
+    std::vector<Eigen::half> tsdf_float16_;
+    /// TSDF values scaled to [-32767, 32767], used by
+    /// TSDFVoxelStorageType::Int16 only.
+    std::vector<int16_t> tsdf_int16_;
+    /// Weights, saturated at 65535, used by the compact storage types.
+    std::vector<uint16_t> weight_uint16_;
+    /// Colors, used by the compact storage types. Three channels per voxel
+    /// for RGB8, one channel scaled to [0, 255] for Gray32.
+    std::vector<uint8_t> color_uint8_;
     Eigen::Vector3d origin_;
     /// Total length, where voxel_length = length / resolution.
     double length_;
@@ -103,7 +162,21 @@ public:
     /// Number of voxels present.
     int voxel_num_;
 
+protected:
+    bool GetRayCastBound(Eigen::Vector3d &min_bound,
+                         Eigen::Vector3d &max_bound) const override;
+    bool SampleTSDFAt(const Eigen::Vector3d &p,
+                      float &tsdf,
+                      Eigen::Vector3d *color) const override;
+
 private:
+    template <TSDFVoxelStorageType storage_type>
+    void IntegrateWithDepthToCameraDistanceMultiplierImpl(
+            const geometry::RGBDImage &image,
+            const camera::PinholeCameraIntrinsic &intrinsic,
+            const Eigen::Matrix4d &extrinsic,
+            const geometry::Image &depth_to_camera_distance_multiplier);
+
     Eigen::Vector3d GetNormalAt(const Eigen::Vector3d &p);
 
     double GetTSDFAt(const Eigen::Vector3d &p);
@@ -247,14 +247,12 @@ Eigen::Matrix6d CreateInformationMatrix(
         const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic,
         const geometry::Image &depth_s,
         const geometry::Image &depth_t,
+        const geometry::Image &xyz_t,
         const OdometryOption &option) {
     auto correspondence =
             ComputeCorrespondence(pinhole_camera_intrinsic.intrinsic_matrix_,
                                   extrinsic, depth_s, depth_t, option);
 
-    auto xyz_t = ConvertDepthImageToXYZImage(
-            depth_t, pinhole_camera_intrinsic.intrinsic_matrix_);
-
     // write q^*
     // see http://redwood-data.org/indoor/registration.html
     // note: I comes first and q_skew is scaled by factor 2.
@@ -271,9 +269,9 @@ Eigen::Matrix6d CreateInformationMatrix(
         for (int row = 0; row < int(correspondence->size()); row++) {
             int u_t = (*correspondence)[row](2);
             int v_t = (*correspondence)[row](3);
-            double x = *xyz_t->PointerAt<float>(u_t, v_t, 0);
-            double y = *xyz_t->PointerAt<float>(u_t, v_t, 1);
-            double z = *xyz_t->PointerAt<float>(u_t, v_t, 2);
+            double x = *xyz_t.PointerAt<float>(u_t, v_t, 0);
+            double y = *xyz_t.PointerAt<float>(u_t, v_t, 1);
+            double z = *xyz_t.PointerAt<float>(u_t, v_t, 2);
             G_r_private.setZero();
             G_r_private(1) = z;
             G_r_private(2) = -y;
@@ -300,9 +298,24 @@ Eigen::Matrix6d CreateInformationMatrix(
     return GTG;
 }
 
-void NormalizeIntensity(geometry::Image &image_s,
-                        geometry::Image &image_t,
-                        CorrespondenceSetPixelWise &correspondence) {
+Eigen::Matrix6d CreateInformationMatrix(
+        const Eigen::Matrix4d &extrinsic,
+        const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic,
+        const geometry::Image &depth_s,
+        const geometry::Image &depth_t,
+        const OdometryOption &option) {
+    auto xyz_t = ConvertDepthImageToXYZImage(
+            depth_t, pinhole_camera_intrinsic.intrinsic_matrix_);
+    return CreateInformationMatrix(extrinsic, pinhole_camera_intrinsic,
+                                   depth_s, depth_t, *xyz_t, option);
+}
+
+/// Returns the scale factors that bring the mean intensity of the
+/// corresponding pixels of both images to 0.5.
+std::tuple<double, double> ComputeIntensityNormalization(
+        const geometry::Image &image_s,
+        const geometry::Image &image_t,
+        const CorrespondenceSetPixelWise &correspondence) {
     if (image_s.width_ != image_t.width_ ||
         image_s.height_ != image_t.height_) {
         utility::LogError(
@@ -320,8 +333,17 @@ void NormalizeIntensity(geometry::Image &image_s,
     }
     mean_s /= (double)correspondence.size();
     mean_t /= (double)correspondence.size();
-    image_s.LinearTransform(0.5 / mean_s, 0.0);
-    image_t.LinearTransform(0.5 / mean_t, 0.0);
+    return std::make_tuple(0.5 / mean_s, 0.5 / mean_t);
+}
+
+void NormalizeIntensity(geometry::Image &image_s,
+                        geometry::Image &image_t,
+                        CorrespondenceSetPixelWise &correspondence) {
+    double scale_s, scale_t;
+    std::tie(scale_s, scale_t) =
+            ComputeIntensityNormalization(image_s, image_t, correspondence);
+    image_s.LinearTransform(scale_s, 0.0);
+    image_t.LinearTransform(scale_t, 0.0);
 }
 
 inline std::shared_ptr<geometry::RGBDImage> PackRGBDImage(
@@ -390,6 +412,21 @@ inline bool CheckRGBDImagePair(const geometry::RGBDImage &source,
     return false;
 }
 
+std::shared_ptr<geometry::RGBDImage> PreprocessRGBDImage(
+        const geometry::RGBDImage &image, const OdometryOption &option) {
+    std::shared_ptr<geometry::Image> color;
+    if (IsColorImageRGB(image.color_)) {
+        color = image.color_.CreateFloatImage();
+    } else {
+        color = std::make_shared<geometry::Image>(image.color_);
+    }
+    auto gray = color->Filter(geometry::Image::FilterType::Gaussian3);
+    auto depth_preprocessed = PreprocessDepth(image.depth_, option);
+    auto depth =
+            depth_preprocessed->Filter(geometry::Image::FilterType::Gaussian3);
+    return PackRGBDImage(*gray, *depth);
+}
+
 std::tuple<std::shared_ptr<geometry::RGBDImage>,
            std::shared_ptr<geometry::RGBDImage>>
 InitializeRGBDOdometry(
@@ -398,36 +435,23 @@ InitializeRGBDOdometry(
         const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic,
         const Eigen::Matrix4d &odo_init,
         const OdometryOption &option) {
-    std::shared_ptr<geometry::Image> source_color, target_color;
-    if (IsColorImageRGB(source.color_) && IsColorImageRGB(target.color_)) {
-        source_color = source.color_.CreateFloatImage();
-        target_color = target.color_.CreateFloatImage();
-    } else {
-        source_color = std::make_shared<geometry::Image>(source.color_);
-        target_color = std::make_shared<geometry::Image>(target.color_);
-    }
-
-    auto source_gray =
-            source_color->Filter(geometry::Image::FilterType::Gaussian3);
-    auto target_gray =
-            target_color->Filter(geometry::Image::FilterType::Gaussian3);
-    auto source_depth_preprocessed = PreprocessDepth(source.depth_, option);
-    auto target_depth_preprocessed = PreprocessDepth(target.depth_, option);
-    auto source_depth = source_depth_preprocessed->Filter(
-            geometry::Image::FilterType::Gaussian3);
-    auto target_depth = target_depth_preprocessed->Filter(
-            geometry::Image::FilterType::Gaussian3);
+    auto source_out = PreprocessRGBDImage(source, option);
+    auto target_out = PreprocessRGBDImage(target, option);
 
     auto correspondence = ComputeCorrespondence(
-            pinhole_camera_intrinsic.intrinsic_matrix_, odo_init, *source_depth,
-            *target_depth, option);
-    NormalizeIntensity(*source_gray, *target_gray, *correspondence);
-
-    auto source_out = PackRGBDImage(*source_gray, *source_depth);
-    auto target_out = PackRGBDImage(*target_gray, *target_depth);
+            pinhole_camera_intrinsic.intrinsic_matrix_, odo_init,
+            source_out->depth_, target_out->depth_, option);
+    NormalizeIntensity(source_out->color_, target_out->color_,
+                       *correspondence);
     return std::make_tuple(source_out, target_out);
 }
 
+void ScalePyramidIntensity(geometry::RGBDImagePyramid &pyramid, double scale) {
+    for (const auto &level : pyramid) {
+        level->color_.LinearTransform(scale, 0.0);
+    }
+}
+
 std::tuple<bool, Eigen::Matrix4d> DoSingleIteration(
         int iter,
         int level,
@@ -474,51 +498,34 @@ std::tuple<bool, Eigen::Matrix4d> DoSingleIteration(
 }
 
 std::tuple<bool, Eigen::Matrix4d> ComputeMultiscale(
-        const geometry::RGBDImage &source,
-        const geometry::RGBDImage &target,
-        const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic,
+        const geometry::RGBDImagePyramid &source_pyramid,
+        const std::vector<std::shared_ptr<geometry::Image>>
+                &source_pyramid_xyz,
+        const geometry::RGBDImagePyramid &target_pyramid,
+        const geometry::RGBDImagePyramid &target_pyramid_dx,
+        const geometry::RGBDImagePyramid &target_pyramid_dy,
+        const std::vector<Eigen::Matrix3d> &pyramid_camera_matrix,
         const Eigen::Matrix4d &extrinsic_initial,
         const RGBDOdometryJacobian &jacobian_method,
         const OdometryOption &option) {
     std::vector<int> iter_counts = option.iteration_number_per_pyramid_level_;
     int num_levels = (int)iter_counts.size();
 
-    auto source_pyramid = source.CreatePyramid(num_levels);
-    auto target_pyramid = target.CreatePyramid(num_levels);
-    auto target_pyramid_dx = geometry::RGBDImage::FilterPyramid(
-            target_pyramid, geometry::Image::FilterType::Sobel3Dx);
-    auto target_pyramid_dy = geometry::RGBDImage::FilterPyramid(
-            target_pyramid, geometry::Image::FilterType::Sobel3Dy);
-
     Eigen::Matrix4d result_odo = extrinsic_initial.isZero()
                                          ? Eigen::Matrix4d::Identity()
                                          : extrinsic_initial;
 
-    std::vector<Eigen::Matrix3d> pyramid_camera_matrix =
-            CreateCameraMatrixPyramid(pinhole_camera_intrinsic,
-                                      (int)iter_counts.size());
-
     for (int level = num_levels - 1; level >= 0; level--) {
         const Eigen::Matrix3d level_camera_matrix =
                 pyramid_camera_matrix[level];
 
-        auto source_xyz_level = ConvertDepthImageToXYZImage(
-                source_pyramid[level]->depth_, level_camera_matrix);
-        auto source_level = PackRGBDImage(source_pyramid[level]->color_,
-                                          source_pyramid[level]->depth_);
-        auto target_level = PackRGBDImage(target_pyramid[level]->color_,
-                                          target_pyramid[level]->depth_);
-        auto target_dx_level = PackRGBDImage(target_pyramid_dx[level]->color_,
-                                             target_pyramid_dx[level]->depth_);
-        auto target_dy_level = PackRGBDImage(target_pyramid_dy[level]->color_,
-                                             target_pyramid_dy[level]->depth_);
-
         for (int iter = 0; iter < iter_counts[num_levels - level - 1]; iter++) {
             Eigen::Matrix4d curr_odo;
             bool is_success;
             std::tie(is_success, curr_odo) = DoSingleIteration(
-                    iter, level, *source_level, *target_level,
-                    *source_xyz_level, *target_dx_level, *target_dy_level,
+                    iter, level, *source_pyramid[level],
+                    *target_pyramid[level], *source_pyramid_xyz[level],
+                    *target_pyramid_dx[level], *target_pyramid_dy[level],
                     level_camera_matrix, result_odo, jacobian_method, option);
             result_odo = curr_odo * result_odo;
 
@@ -531,6 +538,37 @@ std::tuple<bool, Eigen::Matrix4d> ComputeMultiscale(
     return std::make_tuple(true, result_odo);
 }
 
+std::tuple<bool, Eigen::Matrix4d> ComputeMultiscale(
+        const geometry::RGBDImage &source,
+        const geometry::RGBDImage &target,
+        const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic,
+        const Eigen::Matrix4d &extrinsic_initial,
+        const RGBDOdometryJacobian &jacobian_method,
+        const OdometryOption &option) {
+    int num_levels = (int)option.iteration_number_per_pyramid_level_.size();
+
+    auto source_pyramid = source.CreatePyramid(num_levels);
+    auto target_pyramid = target.CreatePyramid(num_levels);
+    auto target_pyramid_dx = geometry::RGBDImage::FilterPyramid(
+            target_pyramid, geometry::Image::FilterType::Sobel3Dx);
+    auto target_pyramid_dy = geometry::RGBDImage::FilterPyramid(
+            target_pyramid, geometry::Image::FilterType::Sobel3Dy);
+
+    std::vector<Eigen::Matrix3d> pyramid_camera_matrix =
+            CreateCameraMatrixPyramid(pinhole_camera_intrinsic, num_levels);
+
+    std::vector<std::shared_ptr<geometry::Image>> source_pyramid_xyz;
+    for (int level = 0; level < num_levels; level++) {
+        source_pyramid_xyz.push_back(ConvertDepthImageToXYZImage(
+                source_pyramid[level]->depth_, pyramid_camera_matrix[level]));
+    }
+
+    return ComputeMultiscale(source_pyramid, source_pyramid_xyz,
+                             target_pyramid, target_pyramid_dx,
+                             target_pyramid_dy, pyramid_camera_matrix,
+                             extrinsic_initial, jacobian_method, option);
+}
+
 }  // unnamed namespace
 
 namespace odometry {
@@ -573,5 +611,93 @@ std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> ComputeRGBDOdometry(
     }
 }
 
+RGBDOdometryTracker::RGBDOdometryTracker(
+        const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic
+        /*= camera::PinholeCameraIntrinsic()*/,
+        const OdometryOption &option /*= OdometryOption()*/)
+    : pinhole_camera_intrinsic_(pinhole_camera_intrinsic), option_(option) {
+    pyramid_camera_matrix_ = CreateCameraMatrixPyramid(
+            pinhole_camera_intrinsic_,
+            (int)option_.iteration_number_per_pyramid_level_.size());
+}
+
+std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> RGBDOdometryTracker::Track(
+        const geometry::RGBDImage &image,
+        const Eigen::Matrix4d &odo_init /*= Eigen::Matrix4d::Identity()*/,
+        const RGBDOdometryJacobian &jacobian_method
+        /*=RGBDOdometryJacobianFromHybridTerm*/) {
+    if (!CheckRGBDImagePair(image, image) ||
+        (previous_frame_ != nullptr &&
+         !CheckImagePair(image.depth_, previous_frame_->pyramid_[0]->depth_))) {
+        utility::LogWarning(
+                "[RGBDOdometryTracker] RGBD images should be same in size.");
+        return std::make_tuple(false, Eigen::Matrix4d::Identity(),
+                               Eigen::Matrix6d::Zero());
+    }
+
+    std::shared_ptr<Frame> source = previous_frame_;
+    std::shared_ptr<Frame> target = CreateFrame(image);
+    previous_frame_ = target;
+    if (source == nullptr) {
+        return std::make_tuple(false, Eigen::Matrix4d::Identity(),
+                               Eigen::Matrix6d::Zero());
+    }
+
+    // The intensity normalization depends on both frames. The pyramids and
+    // gradients are linear in the intensity, so the cached ones are scaled in
+    // place instead of being rebuilt from normalized images. The source was
+    // already scaled as the target of the previous call, which does not
+    // matter: the scales are computed from the cached intensities and map
+    // them to the normalized ones whatever their current scale is.
+    const geometry::RGBDImage &source_image = *source->pyramid_[0];
+    const geometry::RGBDImage &target_image = *target->pyramid_[0];
+    auto correspondence = ComputeCorrespondence(
+            pinhole_camera_intrinsic_.intrinsic_matrix_, odo_init,
+            source_image.depth_, target_image.depth_, option_);
+    double scale_s, scale_t;
+    std::tie(scale_s, scale_t) = ComputeIntensityNormalization(
+            source_image.color_, target_image.color_, *correspondence);
+    ScalePyramidIntensity(source->pyramid_, scale_s);
+    ScalePyramidIntensity(target->pyramid_, scale_t);
+    ScalePyramidIntensity(target->pyramid_dx_, scale_t);
+    ScalePyramidIntensity(target->pyramid_dy_, scale_t);
+
+    Eigen::Matrix4d extrinsic;
+    bool is_success;
+    std::tie(is_success, extrinsic) = ComputeMultiscale(
+            source->pyramid_, source->pyramid_xyz_, target->pyramid_,
+            target->pyramid_dx_, target->pyramid_dy_, pyramid_camera_matrix_,
+            odo_init, jacobian_method, option_);
+
+    if (is_success) {
+        Eigen::Matrix6d info_output = CreateInformationMatrix(
+                extrinsic, pinhole_camera_intrinsic_, source_image.depth_,
+                target_image.depth_, *target->pyramid_xyz_[0], option_);
+        return std::make_tuple(true, extrinsic, info_output);
+    } else {
+        return std::make_tuple(false, Eigen::Matrix4d::Identity(),
+                               Eigen::Matrix6d::Identity());
+    }
+}
+
+void RGBDOdometryTracker::Reset() { previous_frame_.reset(); }
+
+std::shared_ptr<RGBDOdometryTracker::Frame> RGBDOdometryTracker::CreateFrame(
+        const geometry::RGBDImage &image) const {
+    auto frame = std::make_shared<Frame>();
+    auto image_processed = PreprocessRGBDImage(image, option_);
+    frame->pyramid_ =
+            image_processed->CreatePyramid(pyramid_camera_matrix_.size());
+    frame->pyramid_dx_ = geometry::RGBDImage::FilterPyramid(
+            frame->pyramid_, geometry::Image::FilterType::Sobel3Dx);
+    frame->pyramid_dy_ = geometry::RGBDImage::FilterPyramid(
+            frame->pyramid_, geometry::Image::FilterType::Sobel3Dy);
+    for (size_t level = 0; level < pyramid_camera_matrix_.size(); level++) {
+        frame->pyramid_xyz_.push_back(ConvertDepthImageToXYZImage(
+                frame->pyramid_[level]->depth_, pyramid_camera_matrix_[level]));
+    }
+    return frame;
+}
+
 }  // namespace odometry
 }  // namespace open3d
@@ -28,6 +28,7 @@
 
 #include <Eigen/Core>
 #include <iostream>
+#include <memory>
 #include <tuple>
 #include <vector>
 
@@ -40,6 +41,7 @@
 namespace open3d {
 
 namespace geometry {
+class Image;
 class RGBDImage;
 }
 
@@ -64,5 +66,75 @@ std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> ComputeRGBDOdometry(
                 RGBDOdometryJacobianFromHybridTerm(),
         const OdometryOption &option = OdometryOption());
 
+/// \class RGBDOdometryTracker
+///
+/// \brief Frame-to-frame RGBD odometry for a stream of RGBD images.
+///
+/// ComputeRGBDOdometry() preprocesses both of its input images on every call,
+/// so each frame of a sequence is filtered and converted into image pyramids
+/// twice. The tracker preprocesses each frame once and keeps the pyramids,
+/// gradient and XYZ images of the previous frame for the next call.
+class RGBDOdometryTracker {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param pinhole_camera_intrinsic Camera intrinsic parameters, shared by
+    /// all frames.
+    /// \param option Odometry hyper parameteres.
+    RGBDOdometryTracker(
+            const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic =
+                    camera::PinholeCameraIntrinsic(),
+            const OdometryOption &option = OdometryOption());
+    ~RGBDOdometryTracker() {}
+
+public:
+    /// \brief Function to estimate the 6D rigid motion from the previous frame
+    /// to \p image, then make \p image the previous frame.
+    ///
+    /// The result is the same as ComputeRGBDOdometry(previous, image, ...).
+    /// The first frame after construction or Reset() only initializes the
+    /// tracker and returns false.
+    ///
+    /// \param image The new RGBD image.
+    /// \param odo_init Initial 4x4 motion matrix estimation.
+    /// \param jacobian_method The odometry Jacobian method to use.
+    /// \return is_success, 4x4 motion matrix, 6x6 information matrix.
+    std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> Track(
+            const geometry::RGBDImage &image,
+            const Eigen::Matrix4d &odo_init = Eigen::Matrix4d::Identity(),
+            const RGBDOdometryJacobian &jacobian_method =
+                    RGBDOdometryJacobianFromHybridTerm());
+    /// Discards the previous frame.
+    void Reset();
+    /// Returns true if a previous frame is available for tracking.
+    bool HasPreviousFrame() const { return previous_frame_ != nullptr; }
+    /// Returns the camera intrinsic parameters.
+    const camera::PinholeCameraIntrinsic &GetPinholeCameraIntrinsic() const {
+        return pinhole_camera_intrinsic_;
+    }
+    /// Returns the odometry hyper parameters.
+    const OdometryOption &GetOption() const { return option_; }
+
+private:
+    /// Preprocessed frame, in both the source and the target role.
+    struct Frame {
+        /// Filtered intensity and depth. The intensity pyramids carry the
+        /// normalization of the last pair the frame was tracked in.
+        std::vector<std::shared_ptr<geometry::RGBDImage>> pyramid_;
+        std::vector<std::shared_ptr<geometry::RGBDImage>> pyramid_dx_;
+        std::vector<std::shared_ptr<geometry::RGBDImage>> pyramid_dy_;
+        std::vector<std::shared_ptr<geometry::Image>> pyramid_xyz_;
+    };
+
+    /// Preprocesses \p image, which is checked by the caller.
+    std::shared_ptr<Frame> CreateFrame(const geometry::RGBDImage &image) const;
+
+private:
+    camera::PinholeCameraIntrinsic pinhole_camera_intrinsic_;
+    OdometryOption option_;
+    std::vector<Eigen::Matrix3d> pyramid_camera_matrix_;
+    std::shared_ptr<Frame> previous_frame_;
+};
+
 }  // namespace odometry
 }  // namespace open3d
@@ -26,13 +26,19 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <cstdlib>
 #include <functional>
 #include <string>
 #include <tuple>
 #include <vector>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 namespace open3d {
 namespace utility {
 
@@ -116,6 +122,107 @@ struct hash {
 
 }  // namespace hash_enum_class
 
+/// Returns for every element the index of the first element with the same key.
+/// The keys are distributed over the threads by their hash, so every thread
+/// owns a disjoint set of keys. The valid elements are scattered into their
+/// partitions once, in order, so that every thread visits only its own
+/// elements and looks them up in a linear probing table. Elements that are
+/// not valid map to themselves. Key is an Eigen matrix type, hashed with
+/// hash_eigen.
+template <typename Key>
+std::vector<int> FindFirstOccurrences(const std::vector<Key>& keys,
+                                      const std::vector<uint8_t>& valid) {
+    typedef hash_eigen::hash<Key> Hash;
+    int num_partitions = 1;
+#ifdef _OPENMP
+    num_partitions = omp_get_max_threads();
+#endif
+    const int num_keys = int(keys.size());
+    std::vector<int> first_occurrence(keys.size());
+    // Every thread hashes a contiguous range of the elements and counts the
+    // valid ones of each partition.
+    std::vector<uint64_t> hashes(keys.size());
+    auto GetPartition = [&hashes, num_partitions](int i) {
+        return int((hashes[i] >> 40) % uint64_t(num_partitions));
+    };
+    std::vector<std::vector<int>> counts(num_partitions,
+                                         std::vector<int>(num_partitions, 0));
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1)
+#endif
+    for (int t = 0; t < num_partitions; t++) {
+        int begin = int(int64_t(num_keys) * t / num_partitions);
+        int end = int(int64_t(num_keys) * (t + 1) / num_partitions);
+        for (int i = begin; i < end; i++) {
+            if (!valid[i]) {
+                first_occurrence[i] = i;
+                continue;
+            }
+            // Mix the hash, the low bits of the hash of float keys are often
+            // zero. The upper bits select the partition, the lower bits the
+            // slot of the table.
+            uint64_t h = uint64_t(Hash()(keys[i]));
+            h ^= h >> 33;
+            h *= 0xff51afd7ed558ccdull;
+            h ^= h >> 33;
+            h *= 0xc4ceb9fe1a85ec53ull;
+            h ^= h >> 33;
+            hashes[i] = h;
+            counts[t][GetPartition(i)]++;
+        }
+    }
+    // Offsets of the elements of every range in every partition, the
+    // partitions are stored one after the other.
+    std::vector<int> partition_offsets(num_partitions + 1, 0);
+    std::vector<std::vector<int>> offsets(num_partitions,
+                                          std::vector<int>(num_partitions));
+    int offset = 0;
+    for (int p = 0; p < num_partitions; p++) {
+        partition_offsets[p] = offset;
+        for (int t = 0; t < num_partitions; t++) {
+            offsets[t][p] = offset;
+            offset += counts[t][p];
+        }
+    }
+    partition_offsets[num_partitions] = offset;
+    std::vector<int> order(offset);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1)
+#endif
+    for (int t = 0; t < num_partitions; t++) {
+        int begin = int(int64_t(num_keys) * t / num_partitions);
+        int end = int(int64_t(num_keys) * (t + 1) / num_partitions);
+        for (int i = begin; i < end; i++) {
+            if (valid[i]) {
+                order[offsets[t][GetPartition(i)]++] = i;
+            }
+        }
+    }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1)
+#endif
+    for (int p = 0; p < num_partitions; p++) {
+        size_t table_size = 16;
+        while (table_size <
+               2 * size_t(partition_offsets[p + 1] - partition_offsets[p])) {
+            table_size *= 2;
+        }
+        std::vector<int> table(table_size, -1);
+        for (int j = partition_offsets[p]; j < partition_offsets[p + 1]; j++) {
+            int i = order[j];
+            size_t slot = hashes[i] & (table_size - 1);
+            while (table[slot] >= 0 && keys[table[slot]] != keys[i]) {
+                slot = (slot + 1) & (table_size - 1);
+            }
+            if (table[slot] < 0) {
+                table[slot] = i;
+            }
+            first_occurrence[i] = table[slot];
+        }
+    }
+    return first_occurrence;
+}
+
 /// Function to split a string, mimics boost::split
 /// http://stackoverflow.com/questions/236129/split-a-string-in-c
 void SplitString(std::vector<std::string>& tokens,
@@ -152,6 +259,44 @@ inline int DivUp(int x, int y) {
     return tmp.quot + (tmp.rem != 0 ? 1 : 0);
 }
 
+/// Sorts [first, last) like std::sort with all OpenMP threads: chunks are
+/// sorted in parallel and then merged pairwise. Like std::sort it does not
+/// keep the order of equal elements, use a strict total order to get the
+/// same result for any number of threads.
+template <typename RandomIt, typename Compare>
+void ParallelSort(RandomIt first, RandomIt last, Compare comp) {
+    const int64_t size = int64_t(last - first);
+    int num_chunks = 1;
+#ifdef _OPENMP
+    num_chunks = std::min(omp_get_max_threads(), int(size / 65536) + 1);
+#endif
+    if (num_chunks <= 1) {
+        std::sort(first, last, comp);
+        return;
+    }
+    std::vector<int64_t> bounds(num_chunks + 1);
+    for (int i = 0; i <= num_chunks; i++) {
+        bounds[i] = size * i / num_chunks;
+    }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1)
+#endif
+    for (int i = 0; i < num_chunks; i++) {
+        std::sort(first + bounds[i], first + bounds[i + 1], comp);
+    }
+    for (int width = 1; width < num_chunks; width *= 2) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1)
+#endif
+        for (int i = 0; i < num_chunks - width; i += 2 * width) {
+            std::inplace_merge(first + bounds[i], first + bounds[i + width],
+                               first + bounds[std::min(i + 2 * width,
+                                                       num_chunks)],
+                               comp);
+        }
+    }
+}
+
 /// Thread-safe function returning a pseudo-random integer.
 /// The integer is drawn from a uniform distribution bounded by min and max
 /// (inclusive)
@@ -25,6 +25,7 @@
 // ----------------------------------------------------------------------------
 
 #include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Geometry/AsRigidAsPossibleDeformer.h"
 #include "Open3D/Geometry/Image.h"
 #include "Open3D/Geometry/PointCloud.h"
 
@@ -92,6 +93,17 @@ void pybind_trianglemesh(py::module &m) {
                  "Function that removes duplicated triangles, i.e., removes "
                  "triangles that reference the same three vertices, "
                  "independent of their order.")
+            .def("remove_duplicated_vertices_and_trace",
+                 &geometry::TriangleMesh::RemoveDuplicatedVerticesAndTrace,
+                 "Function that removes duplicated vertices and returns for "
+                 "every old vertex the index of the vertex it has been merged "
+                 "into.",
+                 "tolerance"_a = 0.0)
+            .def("remove_duplicated_triangles_and_trace",
+                 &geometry::TriangleMesh::RemoveDuplicatedTrianglesAndTrace,
+                 "Function that removes duplicated triangles and returns for "
+                 "every old triangle the index of the kept triangle that is "
+                 "equal to it.")
             .def("remove_unreferenced_vertices",
                  &geometry::TriangleMesh::RemoveUnreferencedVertices,
                  "This function removes vertices from the triangle mesh that "
@@ -156,6 +168,16 @@ void pybind_trianglemesh(py::module &m) {
                  "shrinkage of the triangle mesh.",
                  "number_of_iterations"_a = 1, "lambda"_a = 0.5, "mu"_a = -0.53,
                  "filter_scope"_a = geometry::MeshBase::FilterScope::All)
+            .def("filter_smooth_implicit",
+                 &geometry::TriangleMesh::FilterSmoothImplicit,
+                 "Function to smooth triangle mesh with implicit (backward "
+                 "Euler) steps of the Laplacian flow, see Desbrun et al., "
+                 "\"Implicit Fairing of Irregular Meshes using Diffusion and "
+                 "Curvature Flow\", 1999. A single iteration with a large "
+                 "lambda smooths as strongly as many explicit iterations.",
+                 "number_of_iterations"_a = 1, "lambda"_a = 1.0,
+                 "use_cotangent_weights"_a = false,
+                 "filter_scope"_a = geometry::MeshBase::FilterScope::All)
             .def("has_vertices", &geometry::TriangleMesh::HasVertices,
                  "Returns ``True`` if the mesh contains vertices.")
             .def("has_triangles", &geometry::TriangleMesh::HasTriangles,
@@ -357,16 +379,38 @@ void pybind_trianglemesh(py::module &m) {
                     "radius over the point cloud, whenever the ball touches "
                     "three points a triangle is created.",
                     "pcd"_a, "radii"_a)
-            .def_static("create_from_point_cloud_poisson",
-                        &geometry::TriangleMesh::CreateFromPointCloudPoisson,
-                        "Function that computes a triangle mesh from a "
-                        "oriented PointCloud pcd. This implements the Screened "
-                        "Poisson Reconstruction proposed in Kazhdan and Hoppe, "
-                        "\"Screened Poisson Surface Reconstruction\", 2013. "
-                        "This function uses the original implementation by "
-                        "Kazhdan. See https://github.com/mkazhdan/PoissonRecon",
-                        "pcd"_a, "depth"_a = 8, "width"_a = 0, "scale"_a = 1.1,
-                        "linear_fit"_a = false)
+            .def_static(
+                    "create_from_point_cloud_poisson",
+                    [](const geometry::PointCloud &pcd, int depth,
+                       double width, double scale, bool linear_fit,
+                       int full_depth, int cg_depth, int iterations,
+                       double point_weight, int n_threads,
+                       bool compute_densities) {
+                        geometry::PoissonReconstructionOption option;
+                        option.depth_ = depth;
+                        option.width_ = width;
+                        option.scale_ = scale;
+                        option.linear_fit_ = linear_fit;
+                        option.full_depth_ = full_depth;
+                        option.cg_depth_ = cg_depth;
+                        option.iterations_ = iterations;
+                        option.point_weight_ = point_weight;
+                        option.n_threads_ = n_threads;
+                        option.compute_densities_ = compute_densities;
+                        return geometry::TriangleMesh::
+                                CreateFromPointCloudPoisson(pcd, option);
+                    },
+                    "Function that computes a triangle mesh from a "
+                    "oriented PointCloud pcd. This implements the Screened "
+                    "Poisson Reconstruction proposed in Kazhdan and Hoppe, "
+                    "\"Screened Poisson Surface Reconstruction\", 2013. "
+                    "This function uses the original implementation by "
+                    "Kazhdan. See https://github.com/mkazhdan/PoissonRecon",
+                    "pcd"_a, "depth"_a = 8, "width"_a = 0, "scale"_a = 1.1,
+                    "linear_fit"_a = false, "full_depth"_a = 5,
+                    "cg_depth"_a = 0, "iterations"_a = 8,
+                    "point_weight"_a = 2.0, "n_threads"_a = -1,
+                    "compute_densities"_a = true)
             .def_static("create_box", &geometry::TriangleMesh::CreateBox,
                         "Factory function to create a box. The left bottom "
                         "corner on the "
@@ -527,6 +571,14 @@ void pybind_trianglemesh(py::module &m) {
                                     "remove_duplicated_vertices");
     docstring::ClassMethodDocInject(m, "TriangleMesh",
                                     "remove_duplicated_triangles");
+    docstring::ClassMethodDocInject(
+            m, "TriangleMesh", "remove_duplicated_vertices_and_trace",
+            {{"tolerance",
+              "If positive, vertices falling into the same cell of a grid "
+              "with this cell size are welded into the first of them. If "
+              "zero, only vertices with identical coordinates are merged."}});
+    docstring::ClassMethodDocInject(m, "TriangleMesh",
+                                    "remove_duplicated_triangles_and_trace");
     docstring::ClassMethodDocInject(m, "TriangleMesh",
                                     "remove_unreferenced_vertices");
     docstring::ClassMethodDocInject(m, "TriangleMesh",
@@ -561,6 +613,15 @@ void pybind_trianglemesh(py::module &m) {
              {"lambda", "Filter parameter."},
              {"mu", "Filter parameter."},
              {"scope", "Mesh property that should be filtered."}});
+    docstring::ClassMethodDocInject(
+            m, "TriangleMesh", "filter_smooth_implicit",
+            {{"number_of_iterations",
+              " Number of repetitions of this operation"},
+             {"lambda", "Time step of the flow."},
+             {"use_cotangent_weights",
+              "Weight the neighbours with the cotangent weights of the input "
+              "mesh instead of uniformly."},
+             {"scope", "Mesh property that should be filtered."}});
     docstring::ClassMethodDocInject(
             m, "TriangleMesh", "select_by_index",
             {{"indices", "Indices of vertices to be selected."}});
@@ -698,7 +759,29 @@ void pybind_trianglemesh(py::module &m) {
               "reconstruction and the diameter of the samples' bounding cube."},
              {"linear_fit",
               "If true, the reconstructor use linear interpolation to estimate "
-              "the positions of iso-vertices."}});
+              "the positions of iso-vertices."},
+             {"full_depth",
+              "Depth up to which the octree is complete. Coarser levels are "
+              "adapted to the sampling density only below this depth."},
+             {"cg_depth",
+              "Depth up to which the system is solved with a "
+              "conjugate-gradient solver instead of the multigrid "
+              "relaxation."},
+             {"iterations",
+              "Number of Gauss-Seidel relaxations per level of the multigrid "
+              "solver."},
+             {"point_weight",
+              "Importance of point interpolation relative to the gradient "
+              "fit. A value of 0 gives the unscreened Poisson "
+              "reconstruction."},
+             {"n_threads",
+              "Number of threads used by the reconstruction. Values <= 0 use "
+              "the OpenMP thread limit. The thread pool persists between "
+              "calls. Concurrent reconstructions share it and run one at a "
+              "time."},
+             {"compute_densities",
+              "If false, the per vertex densities are neither computed nor "
+              "returned."}});
     docstring::ClassMethodDocInject(m, "TriangleMesh", "create_box",
                                     {{"width", "x-directional length."},
                                      {"height", "y-directional length."},
@@ -784,6 +867,50 @@ void pybind_trianglemesh(py::module &m) {
              {"flatness", "Controls the flatness/height of the Moebius strip."},
              {"width", "Width of the Moebius strip."},
              {"scale", "Scale the complete Moebius strip."}});
+
+    py::class_<geometry::AsRigidAsPossibleDeformer,
+               std::shared_ptr<geometry::AsRigidAsPossibleDeformer>>
+            deformer(m, "AsRigidAsPossibleDeformer",
+                     "Deforms a triangle mesh with the method by Sorkine and "
+                     "Alexa, 'As-Rigid-As-Possible Surface Modeling', 2007. "
+                     "The weights and the factorization of the system matrix "
+                     "are reused for every call to deform, and every call "
+                     "starts from the previous deformation.");
+    deformer.def(py::init<const geometry::TriangleMesh &,
+                          geometry::MeshBase::DeformAsRigidAsPossibleEnergy,
+                          double>(),
+                 "mesh"_a,
+                 "energy"_a = geometry::MeshBase::
+                         DeformAsRigidAsPossibleEnergy::Spokes,
+                 "smoothed_alpha"_a = 0.01)
+            .def("set_constraints",
+                 &geometry::AsRigidAsPossibleDeformer::SetConstraints,
+                 "Sets the constrained vertices and factorizes the system "
+                 "matrix.",
+                 "constraint_vertex_indices"_a)
+            .def("deform", &geometry::AsRigidAsPossibleDeformer::Deform,
+                 "Moves the constrained vertices and minimizes the energy, "
+                 "starting from the previous deformation.",
+                 "constraint_vertex_positions"_a, "max_iter"_a)
+            .def("reset", &geometry::AsRigidAsPossibleDeformer::Reset,
+                 "Starts the next deformation from the rest pose.")
+            .def("get_energy", &geometry::AsRigidAsPossibleDeformer::GetEnergy,
+                 "Returns the energy after the last iteration of deform.");
+    docstring::ClassMethodDocInject(
+            m, "AsRigidAsPossibleDeformer", "set_constraints",
+            {{"constraint_vertex_indices",
+              "Indices of the triangle vertices that are moved to the "
+              "positions passed to deform."}});
+    docstring::ClassMethodDocInject(
+            m, "AsRigidAsPossibleDeformer", "deform",
+            {{"constraint_vertex_positions",
+              "Position of every constrained vertex, in the order of the "
+              "indices passed to set_constraints."},
+             {"max_iter",
+              "Number of iterations to minimize energy functional."}});
+    docstring::ClassMethodDocInject(m, "AsRigidAsPossibleDeformer", "reset");
+    docstring::ClassMethodDocInject(m, "AsRigidAsPossibleDeformer",
+                                    "get_energy");
 }
 
 void pybind_trianglemesh_methods(py::module &m) {}
@@ -71,6 +71,20 @@ void pybind_integration_classes(py::module &m) {
             }),
             py::none(), py::none(), "");
 
+    // open3d.integration.TSDFVoxelStorageType
+    py::enum_<integration::TSDFVoxelStorageType> tsdf_voxel_storage_type(
+            m, "TSDFVoxelStorageType", py::arithmetic());
+    tsdf_voxel_storage_type
+            .value("Voxel", integration::TSDFVoxelStorageType::Voxel)
+            .value("Float16", integration::TSDFVoxelStorageType::Float16)
+            .value("Int16", integration::TSDFVoxelStorageType::Int16)
+            .export_values();
+    tsdf_voxel_storage_type.attr("__doc__") = docstring::static_property(
+            py::cpp_function([](py::handle arg) -> std::string {
+                return "Enum class for TSDFVoxelStorageType.";
+            }),
+            py::none(), py::none(), "");
+
     // open3d.integration.TSDFVolume
     py::class_<integration::TSDFVolume, PyTSDFVolume<integration::TSDFVolume>>
             tsdfvolume(m, "TSDFVolume", R"(Base class of the Truncated
@@ -95,6 +109,10 @@ In SIGGRAPH, 1996)");
             .def("extract_triangle_mesh",
                  &integration::TSDFVolume::ExtractTriangleMesh,
                  "Function to extract a triangle mesh")
+            .def("ray_cast", &integration::TSDFVolume::RayCast,
+                 "Function to render depth, vertex, normal and color images "
+                 "of the zero level set seen from a camera",
+                 "intrinsic"_a, "extrinsic"_a)
             .def_readwrite("voxel_length",
                            &integration::TSDFVolume::voxel_length_,
                            "float: Length of the voxel in meters.")
@@ -106,6 +124,10 @@ In SIGGRAPH, 1996)");
                            "TSDF volume.");
     docstring::ClassMethodDocInject(m, "TSDFVolume", "extract_point_cloud");
     docstring::ClassMethodDocInject(m, "TSDFVolume", "extract_triangle_mesh");
+    docstring::ClassMethodDocInject(
+            m, "TSDFVolume", "ray_cast",
+            {{"intrinsic", "Pinhole camera intrinsic parameters."},
+             {"extrinsic", "Extrinsic parameters."}});
     docstring::ClassMethodDocInject(
             m, "TSDFVolume", "integrate",
             {{"image", "RGBD image."},
@@ -125,11 +147,14 @@ In SIGGRAPH, 1996)");
             uniform_tsdfvolume);
     uniform_tsdfvolume
             .def(py::init([](double length, int resolution, double sdf_trunc,
-                             integration::TSDFVolumeColorType color_type) {
+                             integration::TSDFVolumeColorType color_type,
+                             integration::TSDFVoxelStorageType storage_type) {
                      return new integration::UniformTSDFVolume(
-                             length, resolution, sdf_trunc, color_type);
+                             length, resolution, sdf_trunc, color_type,
+                             Eigen::Vector3d::Zero(), storage_type);
                  }),
-                 "length"_a, "resolution"_a, "sdf_trunc"_a, "color_type"_a)
+                 "length"_a, "resolution"_a, "sdf_trunc"_a, "color_type"_a,
+                 "storage_type"_a = integration::TSDFVoxelStorageType::Voxel)
             .def("__repr__",
                  [](const integration::UniformTSDFVolume &vol) {
                      return std::string("integration::UniformTSDFVolume ") +
@@ -151,7 +176,11 @@ In SIGGRAPH, 1996)");
             .def_readwrite("resolution",
                            &integration::UniformTSDFVolume::resolution_,
                            "Resolution over the total length, where "
-                           "``voxel_length = length / resolution``");
+                           "``voxel_length = length / resolution``")
+            .def_readonly("storage_type",
+                          &integration::UniformTSDFVolume::storage_type_,
+                          "integration.TSDFVoxelStorageType: Memory layout of "
+                          "the voxels.");
     docstring::ClassMethodDocInject(m, "UniformTSDFVolume",
                                     "extract_voxel_point_cloud");
 
@@ -186,13 +215,16 @@ In SIGGRAPH, 2013)");
             .def(py::init([](double voxel_length, double sdf_trunc,
                              integration::TSDFVolumeColorType color_type,
                              int volume_unit_resolution,
-                             int depth_sampling_stride) {
+                             int depth_sampling_stride,
+                             integration::TSDFVoxelStorageType storage_type) {
                      return new integration::ScalableTSDFVolume(
                              voxel_length, sdf_trunc, color_type,
-                             volume_unit_resolution, depth_sampling_stride);
+                             volume_unit_resolution, depth_sampling_stride,
+                             storage_type);
                  }),
                  "voxel_length"_a, "sdf_trunc"_a, "color_type"_a,
-                 "volume_unit_resolution"_a = 16, "depth_sampling_stride"_a = 4)
+                 "volume_unit_resolution"_a = 16, "depth_sampling_stride"_a = 4,
+                 "storage_type"_a = integration::TSDFVoxelStorageType::Voxel)
             .def("__repr__",
                  [](const integration::ScalableTSDFVolume &vol) {
                      return std::string("integration::ScalableTSDFVolume ") +
@@ -36,6 +36,7 @@
 #include "Open3D/IO/ClassIO/PinholeCameraTrajectoryIO.h"
 #include "Open3D/IO/ClassIO/PointCloudIO.h"
 #include "Open3D/IO/ClassIO/PoseGraphIO.h"
+#include "Open3D/IO/ClassIO/RGBDSequenceReader.h"
 #include "Open3D/IO/ClassIO/TriangleMeshIO.h"
 #include "Open3D/IO/ClassIO/VoxelGridIO.h"
 
@@ -53,6 +54,13 @@ using namespace open3d;
 static const std::unordered_map<std::string, std::string>
         map_shared_argument_docstrings = {
                 {"filename", "Path to file."},
+                // Read options
+                {"bbox",
+                 "Only the points inside this ``AxisAlignedBoundingBox`` "
+                 "are read."},
+                {"level",
+                 "Level of detail of tiled point cloud (.tpc) files, 0 is the "
+                 "coarsest level and -1 reads all points."},
                 // Write options
                 {"compressed",
                  "Set to ``True`` to write in compressed format."},
@@ -156,6 +164,24 @@ void pybind_class_io(py::module &m_io) {
     docstring::FunctionDocInject(m_io, "read_point_cloud",
                                  map_shared_argument_docstrings);
 
+    m_io.def("read_point_cloud_region",
+             [](const std::string &filename,
+                const geometry::AxisAlignedBoundingBox &bbox, int level,
+                bool print_progress) {
+                 geometry::PointCloud pcd;
+                 io::ReadPointCloud(filename, pcd, bbox, level,
+                                    print_progress);
+                 return pcd;
+             },
+             "Function to read the part of a PointCloud inside a bounding "
+             "box from file. Tiled point cloud (.tpc) files only decode the "
+             "tiles intersecting the box, other formats are read completely "
+             "and cropped.",
+             "filename"_a, "bbox"_a, "level"_a = -1,
+             "print_progress"_a = false);
+    docstring::FunctionDocInject(m_io, "read_point_cloud_region",
+                                 map_shared_argument_docstrings);
+
     m_io.def("write_point_cloud",
              [](const std::string &filename,
                 const geometry::PointCloud &pointcloud, bool write_ascii,
@@ -327,6 +353,66 @@ void pybind_class_io(py::module &m_io) {
     docstring::FunctionDocInject(m_io, "write_pose_graph",
                                  map_shared_argument_docstrings);
 
+    // open3d::io::RGBDSequenceReader
+    py::class_<io::RGBDSequenceReader> rgbd_sequence_reader(
+            m_io, "RGBDSequenceReader",
+            "Reads a sequence of color and depth images on background "
+            "threads.");
+    rgbd_sequence_reader
+            .def(py::init<int, int>(), "num_threads"_a = 2,
+                 "max_buffered_frames"_a = 8)
+            .def("is_opened", &io::RGBDSequenceReader::IsOpened,
+                 "Check if a sequence is opened.")
+            .def("is_eof", &io::RGBDSequenceReader::IsEOF,
+                 "Check if all the frames of the sequence are read.")
+            .def("open",
+                 (bool (io::RGBDSequenceReader::*)(
+                         const std::vector<std::string> &,
+                         const std::vector<std::string> &)) &
+                         io::RGBDSequenceReader::Open,
+                 "color_filenames"_a, "depth_filenames"_a,
+                 "Open a sequence of color and depth image files.")
+            .def("open",
+                 (bool (io::RGBDSequenceReader::*)(
+                         const std::vector<std::string> &,
+                         const std::vector<std::string> &,
+                         const std::string &)) &
+                         io::RGBDSequenceReader::Open,
+                 "color_filenames"_a, "depth_filenames"_a,
+                 "trajectory_filename"_a,
+                 "Open a sequence of color and depth image files along with "
+                 "its camera trajectory.")
+            .def("open_association_file",
+                 &io::RGBDSequenceReader::OpenAssociationFile, "filename"_a,
+                 "Open a sequence from a file listing depth and color image "
+                 "pairs.")
+            .def("close", &io::RGBDSequenceReader::Close,
+                 "Stop decoding and close the sequence.")
+            .def("next_frame",
+                 [](io::RGBDSequenceReader &reader) -> py::object {
+                     geometry::Image color, depth;
+                     bool success = reader.NextFrame(color, depth);
+                     // The GIL is released while waiting for the decoding
+                     // threads, it must be held again to build the result.
+                     py::gil_scoped_acquire acquire;
+                     if (!success) {
+                         return py::none();
+                     }
+                     return py::make_tuple(color, depth);
+                 },
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Returns the next (color, depth) pair of the sequence, or "
+                 "None if it cannot be read.")
+            .def("get_num_frames", &io::RGBDSequenceReader::GetNumFrames,
+                 "Number of frames in the sequence.")
+            .def("get_frame_index", &io::RGBDSequenceReader::GetFrameIndex,
+                 "Index of the frame returned by the next call to "
+                 "next_frame.")
+            .def("has_trajectory", &io::RGBDSequenceReader::HasTrajectory,
+                 "Check if a camera trajectory is loaded with the sequence.")
+            .def("get_trajectory", &io::RGBDSequenceReader::GetTrajectory,
+                 "Camera trajectory of the sequence.");
+
 #ifdef BUILD_AZURE_KINECT
     m_io.def("read_azure_kinect_sensor_config",
              [](const std::string &filename) {
@@ -178,6 +178,30 @@ Anonymous submission.)");
             [](const odometry::RGBDOdometryJacobianFromHybridTerm &te) {
                 return std::string("RGBDOdometryJacobianFromHybridTerm");
             });
+
+    // open3d.odometry.RGBDOdometryTracker
+    py::class_<odometry::RGBDOdometryTracker> tracker(
+            m, "RGBDOdometryTracker",
+            "Frame-to-frame RGBD odometry that preprocesses each frame of a "
+            "stream once.");
+    tracker.def(py::init<const camera::PinholeCameraIntrinsic &,
+                         const odometry::OdometryOption &>(),
+                "pinhole_camera_intrinsic"_a = camera::PinholeCameraIntrinsic(),
+                "option"_a = odometry::OdometryOption())
+            .def("track", &odometry::RGBDOdometryTracker::Track,
+                 "Function to estimate 6D rigid motion from the previous frame "
+                 "to the new frame. Output: (is_success, 4x4 motion matrix, "
+                 "6x6 information matrix).",
+                 "rgbd_image"_a, "odo_init"_a = Eigen::Matrix4d::Identity(),
+                 "jacobian"_a = odometry::RGBDOdometryJacobianFromHybridTerm())
+            .def("reset", &odometry::RGBDOdometryTracker::Reset,
+                 "Function to discard the previous frame.")
+            .def("has_previous_frame",
+                 &odometry::RGBDOdometryTracker::HasPreviousFrame,
+                 "Returns ``True`` if a previous frame is available.")
+            .def("__repr__", [](const odometry::RGBDOdometryTracker &t) {
+                return std::string("RGBDOdometryTracker");
+            });
 }
 
 void pybind_odometry_methods(py::module &m) {
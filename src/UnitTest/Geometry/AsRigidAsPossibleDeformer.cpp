@@ -0,0 +1,187 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/AsRigidAsPossibleDeformer.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+using namespace unit_test;
+
+namespace {
+
+// Square grid in the xy plane with the left column of vertices fixed and the
+// right column lifted.
+void CreateBentGrid(int size,
+                    geometry::TriangleMesh &mesh,
+                    std::vector<int> &constraint_ids,
+                    std::vector<Eigen::Vector3d> &constraint_pos) {
+    for (int y = 0; y < size; ++y) {
+        for (int x = 0; x < size; ++x) {
+            mesh.vertices_.push_back(Eigen::Vector3d(x, y, 0));
+            if (x == 0 || x == size - 1) {
+                constraint_ids.push_back(y * size + x);
+                constraint_pos.push_back(
+                        Eigen::Vector3d(x, y, x == 0 ? 0 : size / 2));
+            }
+            if (x + 1 < size && y + 1 < size) {
+                int v = y * size + x;
+                mesh.triangles_.push_back(Eigen::Vector3i(v, v + 1, v + size));
+                mesh.triangles_.push_back(
+                        Eigen::Vector3i(v + 1, v + size + 1, v + size));
+            }
+        }
+    }
+}
+
+}  // unnamed namespace
+
+TEST(AsRigidAsPossibleDeformer, Deform) {
+    geometry::TriangleMesh mesh;
+    std::vector<int> constraint_ids;
+    std::vector<Eigen::Vector3d> constraint_pos;
+    CreateBentGrid(5, mesh, constraint_ids, constraint_pos);
+    // Twist the right column by a quarter turn around the x axis instead.
+    for (size_t idx = 0; idx < constraint_ids.size(); ++idx) {
+        if (constraint_pos[idx](0) == 4) {
+            double y = mesh.vertices_[constraint_ids[idx]](1);
+            constraint_pos[idx] = Eigen::Vector3d(4, 2, y - 2);
+        }
+    }
+
+    // Vertices after 10 iterations of the SparseLU solver that preceded the
+    // deformer.
+    const std::vector<Eigen::Vector3d> ref_spokes = {
+            {0.0000000000, 0.0000000000, 0.0000000000},
+            {1.0369436040, 0.2068709684, -0.6652130375},
+            {2.0391805334, 0.6188936317, -1.2707138949},
+            {3.0159217475, 1.2424849825, -1.7341197803},
+            {4.0000000000, 2.0000000000, -2.0000000000},
+            {0.0000000000, 1.0000000000, 0.0000000000},
+            {1.0067059785, 1.1029931348, -0.3315730711},
+            {2.0123219022, 1.3162581765, -0.6374315700},
+            {3.0110950590, 1.6323586644, -0.8712593664},
+            {4.0000000000, 2.0000000000, -1.0000000000},
+            {0.0000000000, 2.0000000000, 0.0000000000},
+            {0.9961107158, 2.0000000000, 0.0000000000},
+            {2.0021692711, 2.0000000000, 0.0000000000},
+            {3.0083844893, 2.0000000000, 0.0000000000},
+            {4.0000000000, 2.0000000000, 0.0000000000},
+            {0.0000000000, 3.0000000000, 0.0000000000},
+            {1.0067059785, 2.8970068652, 0.3315730711},
+            {2.0123219022, 2.6837418235, 0.6374315700},
+            {3.0110950590, 2.3676413356, 0.8712593664},
+            {4.0000000000, 2.0000000000, 1.0000000000},
+            {0.0000000000, 4.0000000000, 0.0000000000},
+            {1.0369436040, 3.7931290316, 0.6652130375},
+            {2.0391805334, 3.3811063683, 1.2707138949},
+            {3.0159217475, 2.7575150175, 1.7341197803},
+            {4.0000000000, 2.0000000000, 2.0000000000}};
+    const std::vector<Eigen::Vector3d> ref_smoothed = {
+            {0.0000000000, 0.0000000000, 0.0000000000},
+            {1.0590334139, 0.2128200873, -0.6246644745},
+            {2.0678693889, 0.6128345994, -1.2171711153},
+            {3.0327576538, 1.2322850603, -1.6984732824},
+            {4.0000000000, 2.0000000000, -2.0000000000},
+            {0.0000000000, 1.0000000000, 0.0000000000},
+            {1.0084464522, 1.1217051455, -0.3410504749},
+            {2.0130467339, 1.3472473633, -0.6455644776},
+            {3.0079640376, 1.6656616990, -0.8743477161},
+            {4.0000000000, 2.0000000000, -1.0000000000},
+            {0.0000000000, 2.0000000000, 0.0000000000},
+            {0.9961941193, 2.0216589378, -0.0386099950},
+            {2.0029465777, 2.0440151364, -0.0425939598},
+            {3.0097433445, 2.0459931116, -0.0243847056},
+            {4.0000000000, 2.0000000000, 0.0000000000},
+            {0.0000000000, 3.0000000000, 0.0000000000},
+            {1.0114865931, 2.9112039268, 0.2863682994},
+            {2.0185524528, 2.7165935576, 0.5869744410},
+            {3.0173978196, 2.4018752214, 0.8395247187},
+            {4.0000000000, 2.0000000000, 1.0000000000},
+            {0.0000000000, 4.0000000000, 0.0000000000},
+            {1.0324095719, 3.7880029812, 0.6462418631},
+            {2.0277331621, 3.3760874793, 1.2462759834},
+            {3.0047786558, 2.7539850241, 1.7114861376},
+            {4.0000000000, 2.0000000000, 2.0000000000}};
+
+    typedef geometry::MeshBase::DeformAsRigidAsPossibleEnergy Energy;
+    for (auto energy : {Energy::Spokes, Energy::Smoothed}) {
+        const auto &ref = energy == Energy::Spokes ? ref_spokes : ref_smoothed;
+        auto mesh_gt = mesh.DeformAsRigidAsPossible(constraint_ids,
+                                                    constraint_pos, 10, energy);
+        ExpectEQ(mesh_gt->vertices_, ref);
+
+        geometry::AsRigidAsPossibleDeformer deformer(mesh, energy);
+        deformer.SetConstraints(constraint_ids);
+        auto deformed = deformer.Deform(constraint_pos, 10);
+        ExpectEQ(deformed->vertices_, ref);
+        ExpectEQ(deformed->triangles_, mesh.triangles_);
+        for (size_t idx = 0; idx < constraint_ids.size(); ++idx) {
+            ExpectEQ(deformed->vertices_[constraint_ids[idx]],
+                     constraint_pos[idx]);
+        }
+
+        // The next call continues from the previous deformation.
+        deformer.Reset();
+        deformer.Deform(constraint_pos, 4);
+        double energy_4 = deformer.GetEnergy();
+        deformed = deformer.Deform(constraint_pos, 6);
+        ExpectEQ(deformed->vertices_, ref);
+        EXPECT_LE(deformer.GetEnergy(), energy_4);
+    }
+}
+
+TEST(AsRigidAsPossibleDeformer, MoveConstraints) {
+    geometry::TriangleMesh mesh;
+    std::vector<int> constraint_ids;
+    std::vector<Eigen::Vector3d> constraint_pos;
+    CreateBentGrid(8, mesh, constraint_ids, constraint_pos);
+
+    geometry::AsRigidAsPossibleDeformer deformer(mesh);
+    deformer.SetConstraints(constraint_ids);
+    std::vector<Eigen::Vector3d> frame_pos = constraint_pos;
+    for (int frame = 1; frame <= 10; ++frame) {
+        for (size_t idx = 0; idx < constraint_ids.size(); ++idx) {
+            const Eigen::Vector3d &rest = mesh.vertices_[constraint_ids[idx]];
+            frame_pos[idx] = rest + frame / 10. * (constraint_pos[idx] - rest);
+        }
+        deformer.Deform(frame_pos, 2);
+    }
+    // A few warm-started iterations per frame end close to the solution from
+    // the rest pose.
+    auto deformed = deformer.Deform(constraint_pos, 20);
+    auto mesh_gt =
+            mesh.DeformAsRigidAsPossible(constraint_ids, constraint_pos, 50);
+    ExpectEQ(deformed->vertices_, mesh_gt->vertices_, 1e-2);
+
+    // The factorization is redone for a new set of constrained vertices.
+    deformer.SetConstraints({0});
+    deformed = deformer.Deform({Eigen::Vector3d(0, 0, 0)}, 50);
+    EXPECT_NEAR((deformed->vertices_[7] - deformed->vertices_[0]).norm(), 7,
+                1e-2);
+
+    EXPECT_THROW(deformer.Deform({}, 1), std::runtime_error);
+    EXPECT_THROW(deformer.SetConstraints({64}), std::runtime_error);
+}
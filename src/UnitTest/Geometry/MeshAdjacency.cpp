@@ -0,0 +1,88 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/MeshAdjacency.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+using namespace unit_test;
+
+namespace {
+
+// 4-sided pyramid with the top vertex 0, the bottom has two triangles.
+const std::vector<Eigen::Vector3i> kPyramid = {
+        Eigen::Vector3i(0, 1, 2), Eigen::Vector3i(0, 2, 3),
+        Eigen::Vector3i(0, 3, 4), Eigen::Vector3i(0, 4, 1),
+        Eigen::Vector3i(1, 2, 4), Eigen::Vector3i(2, 3, 4)};
+
+std::vector<int> ToVector(const geometry::MeshAdjacency::Neighbors &range) {
+    return std::vector<int>(range.begin(), range.end());
+}
+
+}  // unnamed namespace
+
+TEST(MeshAdjacency, CreateVertexAdjacency) {
+    auto adjacency =
+            geometry::MeshAdjacency::CreateVertexAdjacency(kPyramid, 6);
+    EXPECT_EQ(adjacency.Size(), 6);
+    ExpectEQ(ToVector(adjacency[0]), std::vector<int>({1, 2, 3, 4}));
+    ExpectEQ(ToVector(adjacency[1]), std::vector<int>({0, 2, 4}));
+    ExpectEQ(ToVector(adjacency[2]), std::vector<int>({0, 1, 3, 4}));
+    ExpectEQ(ToVector(adjacency[3]), std::vector<int>({0, 2, 4}));
+    ExpectEQ(ToVector(adjacency[4]), std::vector<int>({0, 1, 2, 3}));
+    EXPECT_EQ(adjacency[5].size(), 0u);
+
+    // A degenerate triangle connects its vertex to itself.
+    adjacency = geometry::MeshAdjacency::CreateVertexAdjacency(
+            {Eigen::Vector3i(0, 0, 1)}, 2);
+    ExpectEQ(ToVector(adjacency[0]), std::vector<int>({0, 1}));
+    ExpectEQ(ToVector(adjacency[1]), std::vector<int>({0}));
+}
+
+TEST(MeshAdjacency, CreateVertexTriangles) {
+    auto adjacency =
+            geometry::MeshAdjacency::CreateVertexTriangles(kPyramid, 5);
+    EXPECT_EQ(adjacency.Size(), 5);
+    ExpectEQ(ToVector(adjacency[0]), std::vector<int>({0, 1, 2, 3}));
+    ExpectEQ(ToVector(adjacency[1]), std::vector<int>({0, 3, 4}));
+    ExpectEQ(ToVector(adjacency[2]), std::vector<int>({0, 1, 4, 5}));
+    ExpectEQ(ToVector(adjacency[3]), std::vector<int>({1, 2, 5}));
+    ExpectEQ(ToVector(adjacency[4]), std::vector<int>({2, 3, 4, 5}));
+}
+
+TEST(MeshAdjacency, AdjacencyList) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, 10);
+    auto adjacency = mesh->GetVertexAdjacency();
+    mesh->ComputeAdjacencyList();
+    EXPECT_TRUE(adjacency.ToAdjacencyList() == mesh->adjacency_list_);
+
+    // An existing adjacency list takes precedence over the triangles.
+    mesh->adjacency_list_[0].insert(int(mesh->vertices_.size()) - 1);
+    auto converted = mesh->GetVertexAdjacency();
+    EXPECT_EQ(converted[0].size(), adjacency[0].size() + 1);
+    EXPECT_TRUE(converted.ToAdjacencyList() == mesh->adjacency_list_);
+}
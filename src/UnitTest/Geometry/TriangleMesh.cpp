@@ -24,8 +24,13 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <set>
+#include <thread>
+#include <tuple>
+
 #include "Open3D/Geometry/TriangleMesh.h"
 #include "Open3D/Geometry/BoundingVolume.h"
+#include "Open3D/Geometry/KDTreeFlann.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "TestUtility/UnitTest.h"
 
@@ -693,6 +698,59 @@ TEST(TriangleMesh, MergeCloseVertices) {
     ExpectEQ(mesh, ref);
 }
 
+TEST(TriangleMesh, RemoveDuplicatedVerticesAndTrace) {
+    geometry::TriangleMesh mesh;
+    mesh.vertices_ = {{0.0, 0.0, 0.0}, {1.0, 0.0, 0.0}, {0.0, 1.0, 0.0},
+                      {1.0, 0.0, 0.0}, {-0.0, 0.0, 0.0}, {1.01, 0.0, 0.0},
+                      {0.0, 1.0, 0.0}};
+    mesh.vertex_colors_ = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {0, 0, 1},
+                           {1, 1, 0}, {1, 0, 1}, {0, 1, 1}};
+    mesh.triangles_ = {{0, 1, 2}, {4, 3, 6}, {4, 5, 6}};
+
+    geometry::TriangleMesh exact = mesh;
+    std::vector<int> exact_map = exact.RemoveDuplicatedVerticesAndTrace();
+    EXPECT_EQ(exact_map, std::vector<int>({0, 1, 2, 1, 0, 3, 2}));
+    ExpectEQ(exact.vertices_,
+             std::vector<Eigen::Vector3d>({{0.0, 0.0, 0.0},
+                                           {1.0, 0.0, 0.0},
+                                           {0.0, 1.0, 0.0},
+                                           {1.01, 0.0, 0.0}}));
+    ExpectEQ(exact.vertex_colors_,
+             std::vector<Eigen::Vector3d>(
+                     {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {1, 0, 1}}));
+    ExpectEQ(exact.triangles_, std::vector<Eigen::Vector3i>(
+                                       {{0, 1, 2}, {0, 1, 2}, {0, 3, 2}}));
+
+    geometry::TriangleMesh welded = mesh;
+    std::vector<int> welded_map = welded.RemoveDuplicatedVerticesAndTrace(0.1);
+    EXPECT_EQ(welded_map, std::vector<int>({0, 1, 2, 1, 0, 1, 2}));
+    EXPECT_EQ(welded.vertices_.size(), 3u);
+    EXPECT_EQ(welded.vertex_colors_.size(), 3u);
+    for (size_t i = 0; i < mesh.vertices_.size(); i++) {
+        EXPECT_LE((welded.vertices_[welded_map[i]] - mesh.vertices_[i]).norm(),
+                  0.1 * std::sqrt(3.0));
+    }
+
+    std::vector<int> triangle_map =
+            welded.RemoveDuplicatedTrianglesAndTrace();
+    EXPECT_EQ(triangle_map, std::vector<int>({0, 0, 0}));
+    ExpectEQ(welded.triangles_, std::vector<Eigen::Vector3i>({{0, 1, 2}}));
+
+    // Rotated triangles are duplicates, flipped ones are not.
+    geometry::TriangleMesh triangles;
+    triangles.vertices_.resize(4);
+    triangles.triangles_ = {{0, 1, 2}, {1, 2, 0}, {2, 1, 0}, {1, 2, 3},
+                            {2, 0, 1}, {3, 1, 2}};
+    triangles.triangle_normals_ = {{0, 0, 1}, {0, 0, 2}, {0, 0, 3},
+                                   {0, 0, 4}, {0, 0, 5}, {0, 0, 6}};
+    triangle_map = triangles.RemoveDuplicatedTrianglesAndTrace();
+    EXPECT_EQ(triangle_map, std::vector<int>({0, 0, 1, 2, 0, 2}));
+    ExpectEQ(triangles.triangles_,
+             std::vector<Eigen::Vector3i>({{0, 1, 2}, {2, 1, 0}, {1, 2, 3}}));
+    ExpectEQ(triangles.triangle_normals_,
+             std::vector<Eigen::Vector3d>({{0, 0, 1}, {0, 0, 3}, {0, 0, 4}}));
+}
+
 TEST(TriangleMesh, SamplePointsUniformly) {
     auto mesh_empty = geometry::TriangleMesh();
     EXPECT_THROW(mesh_empty.SamplePointsUniformly(100), std::runtime_error);
@@ -751,6 +809,40 @@ TEST(TriangleMesh, SamplePointsUniformly) {
     }
 }
 
+TEST(TriangleMesh, SamplePointsPoissonDisk) {
+    auto mesh_empty = geometry::TriangleMesh();
+    EXPECT_THROW(mesh_empty.SamplePointsPoissonDisk(100), std::runtime_error);
+
+    auto mesh = geometry::TriangleMesh();
+    mesh.vertices_ = {{0, 0, 0}, {1, 0, 0}, {1, 1, 0}, {0, 1, 0}};
+    mesh.triangles_ = {{0, 1, 2}, {0, 2, 3}};
+
+    size_t n_points = 500;
+    auto pcd = mesh.SamplePointsPoissonDisk(n_points, 5, nullptr, false, 0);
+    EXPECT_EQ(pcd->points_.size(), n_points);
+
+    // The same seed eliminates the same samples.
+    auto pcd_seed =
+            mesh.SamplePointsPoissonDisk(n_points, 5, nullptr, false, 0);
+    ExpectEQ(pcd->points_, pcd_seed->points_, 0);
+
+    // The samples are farther apart than half of the maximal radius of the
+    // sample elimination.
+    double r_max = 2 * std::sqrt((1.0 / n_points) / (2 * std::sqrt(3.)));
+    geometry::KDTreeFlann kdtree(*pcd);
+    std::vector<int> indices;
+    std::vector<double> dists2;
+    for (const Vector3d &point : pcd->points_) {
+        kdtree.SearchKNN(point, 2, indices, dists2);
+        EXPECT_GT(std::sqrt(dists2[1]), 0.5 * r_max);
+    }
+
+    // Elimination from a given point cloud.
+    auto pcd_init = mesh.SamplePointsUniformly(4 * n_points, false, 1);
+    pcd = mesh.SamplePointsPoissonDisk(n_points, 5, pcd_init);
+    EXPECT_EQ(pcd->points_.size(), n_points);
+}
+
 TEST(TriangleMesh, FilterSharpen) {
     auto mesh = std::make_shared<geometry::TriangleMesh>();
     mesh->vertices_ = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {-1, 0, 0}, {0, -1, 0}};
@@ -833,6 +925,51 @@ TEST(TriangleMesh, FilterSmoothTaubin) {
     ExpectEQ(mesh->vertices_, ref2);
 }
 
+TEST(TriangleMesh, FilterSmoothImplicit) {
+    auto mesh = std::make_shared<geometry::TriangleMesh>();
+    mesh->vertices_ = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {-1, 0, 0}, {0, -1, 0}};
+    mesh->vertex_colors_ = {{1, 1, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+                            {0, 0, 0}};
+    mesh->triangles_ = {{0, 1, 2}, {0, 2, 3}, {0, 3, 4}, {0, 4, 1}};
+
+    // The outer vertices solve 3 (1 + lambda) v_o - lambda (0 + v_o') = 3 v_i,
+    // where the neighbours v_o' cancel out.
+    for (bool use_cotangent_weights : {false, true}) {
+        auto smoothed = mesh->FilterSmoothImplicit(
+                1, 1.0, use_cotangent_weights,
+                geometry::MeshBase::FilterScope::Vertex);
+        std::vector<Eigen::Vector3d> ref1 = {{0, 0, 0},
+                                             {0.5, 0, 0},
+                                             {0, 0.5, 0},
+                                             {-0.5, 0, 0},
+                                             {0, -0.5, 0}};
+        ExpectEQ(smoothed->vertices_, ref1);
+        ExpectEQ(smoothed->vertex_colors_, mesh->vertex_colors_);
+
+        smoothed = mesh->FilterSmoothImplicit(
+                2, 1.0, use_cotangent_weights,
+                geometry::MeshBase::FilterScope::Vertex);
+        ExpectEQ(smoothed->vertices_[1], Eigen::Vector3d(0.25, 0, 0));
+    }
+
+    // A large step converges to the mean weighted by the neighbour count.
+    auto smoothed = mesh->FilterSmoothImplicit(
+            1, 1e8, false, geometry::MeshBase::FilterScope::Color);
+    ExpectEQ(smoothed->vertices_, mesh->vertices_);
+    for (const auto &color : smoothed->vertex_colors_) {
+        ExpectEQ(color, Eigen::Vector3d(0.25, 0.25, 0.25), 1e-6);
+    }
+
+    // An adjacency list with every edge at one end only is symmetrized,
+    // which halves all weights and leaves the solution unchanged.
+    mesh->vertices_[0] = Eigen::Vector3d(0.2, 0.1, 0.3);
+    auto reference = mesh->FilterSmoothImplicit(1, 2.0);
+    mesh->adjacency_list_ = {{1, 2, 3, 4}, {2, 4}, {3}, {4}, {}};
+    smoothed = mesh->FilterSmoothImplicit(1, 2.0);
+    ExpectEQ(smoothed->vertices_, reference->vertices_);
+    ExpectEQ(smoothed->vertex_colors_, reference->vertex_colors_);
+}
+
 TEST(TriangleMesh, HasVertices) {
     int size = 100;
 
@@ -1233,6 +1370,151 @@ TEST(TriangleMesh, RemoveTrianglesByMask) {
     ExpectEQ(mesh_in, mesh_gt);
 }
 
+TEST(TriangleMesh, SimplifyVertexClustering) {
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 20);
+    sphere->vertex_colors_ = sphere->vertices_;
+    double voxel_size = 0.3;
+    Vector3d min_bound = sphere->GetMinBound() - Vector3d::Constant(0.15);
+    std::set<std::tuple<int, int, int>> voxels;
+    for (const auto& vertex : sphere->vertices_) {
+        Vector3d coord = (vertex - min_bound) / voxel_size;
+        voxels.emplace(int(floor(coord(0))), int(floor(coord(1))),
+                       int(floor(coord(2))));
+    }
+
+    auto average = geometry::TriangleMesh::SimplificationContraction::Average;
+    auto quadric = geometry::TriangleMesh::SimplificationContraction::Quadric;
+    auto mesh = sphere->SimplifyVertexClustering(voxel_size, average);
+    EXPECT_EQ(mesh->vertices_.size(), voxels.size());
+    ExpectEQ(mesh->vertices_, mesh->vertex_colors_);
+    std::set<std::tuple<int, int, int>> triangles;
+    for (const auto& triangle : mesh->triangles_) {
+        EXPECT_NE(triangle(0), triangle(1));
+        EXPECT_NE(triangle(0), triangle(2));
+        EXPECT_NE(triangle(1), triangle(2));
+        EXPECT_LT(triangle(0), triangle(1));
+        EXPECT_LT(triangle(0), triangle(2));
+        EXPECT_TRUE(triangles.emplace(triangle(0), triangle(1), triangle(2))
+                            .second);
+    }
+    EXPECT_GT(triangles.size(), 0u);
+
+    // Vertices are numbered in the order of the first input vertex of their
+    // voxel.
+    mesh = sphere->SimplifyVertexClustering(voxel_size, quadric);
+    EXPECT_EQ(mesh->vertices_.size(), voxels.size());
+    EXPECT_LE((mesh->vertices_[0] - sphere->vertices_[0]).norm(),
+              voxel_size * std::sqrt(3.0));
+    for (const auto& vertex : mesh->vertices_) {
+        EXPECT_NEAR(vertex.norm(), 1.0, 0.05);
+    }
+}
+
+TEST(TriangleMesh, SimplifyQuadricDecimation) {
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 40);
+    sphere->ComputeVertexNormals();
+    sphere->ComputeTriangleNormals();
+    int target = int(sphere->triangles_.size()) / 10;
+    auto mesh = sphere->SimplifyQuadricDecimation(target);
+
+    // Every collapse removes two triangles of the closed sphere.
+    EXPECT_LE(mesh->triangles_.size(), size_t(target) + 1);
+    EXPECT_GT(mesh->triangles_.size(), size_t(target) / 2);
+    EXPECT_EQ(mesh->vertices_.size(), mesh->vertex_normals_.size());
+    EXPECT_EQ(mesh->triangles_.size(), mesh->triangle_normals_.size());
+    EXPECT_TRUE(mesh->IsEdgeManifold());
+    EXPECT_TRUE(mesh->IsWatertight());
+    EXPECT_EQ(mesh->vertices_.size() * 2, mesh->triangles_.size() + 4);
+    for (const auto& vertex : mesh->vertices_) {
+        EXPECT_NEAR(vertex.norm(), 1.0, 0.05);
+    }
+    for (const auto& triangle : mesh->triangles_) {
+        for (int i = 0; i < 3; i++) {
+            EXPECT_LT(triangle(i), int(mesh->vertices_.size()));
+        }
+    }
+
+    // Collapses are selected by cost and index only, so the result is
+    // deterministic.
+    auto mesh2 = sphere->SimplifyQuadricDecimation(target);
+    ExpectEQ(*mesh, *mesh2);
+}
+
+TEST(TriangleMesh, SubdivideMidpoint) {
+    geometry::TriangleMesh mesh;
+    mesh.vertices_ = {{0, 0, 0}, {4, 0, 0}, {0, 4, 0}, {4, 4, 0}};
+    mesh.vertex_colors_ = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {1, 1, 0}};
+    mesh.triangles_ = {{0, 1, 2}, {2, 1, 3}};
+
+    auto level1 = mesh.SubdivideMidpoint(1);
+    // The shared edge gets a single new vertex.
+    ExpectEQ(level1->vertices_, std::vector<Eigen::Vector3d>({{0, 0, 0},
+                                                             {4, 0, 0},
+                                                             {0, 4, 0},
+                                                             {4, 4, 0},
+                                                             {2, 0, 0},
+                                                             {2, 2, 0},
+                                                             {0, 2, 0},
+                                                             {4, 2, 0},
+                                                             {2, 4, 0}}));
+    ExpectEQ(level1->vertex_colors_[5], Eigen::Vector3d(0.5, 0.5, 0));
+    ExpectEQ(level1->triangles_,
+             std::vector<Eigen::Vector3i>({{0, 4, 6},
+                                           {4, 1, 5},
+                                           {5, 2, 6},
+                                           {4, 5, 6},
+                                           {2, 5, 8},
+                                           {5, 1, 7},
+                                           {7, 3, 8},
+                                           {5, 7, 8}}));
+
+    auto level2 = mesh.SubdivideMidpoint(2);
+    auto level2_from_level1 = level1->SubdivideMidpoint(1);
+    ExpectEQ(level2->vertices_, level2_from_level1->vertices_);
+    ExpectEQ(level2->triangles_, level2_from_level1->triangles_);
+    EXPECT_EQ(level2->vertices_.size(), 25u);
+    EXPECT_EQ(level2->triangles_.size(), 32u);
+}
+
+TEST(TriangleMesh, SubdivideLoop) {
+    // Tetrahedron, every vertex has three neighbors and every edge two
+    // triangles.
+    geometry::TriangleMesh mesh;
+    mesh.vertices_ = {{0, 0, 0}, {16, 0, 0}, {0, 16, 0}, {0, 0, 16}};
+    mesh.triangles_ = {{0, 2, 1}, {0, 1, 3}, {0, 3, 2}, {1, 2, 3}};
+
+    auto level1 = mesh.SubdivideLoop(1);
+    ASSERT_EQ(level1->vertices_.size(), 10u);
+    EXPECT_EQ(level1->triangles_.size(), 16u);
+    // alpha = 7 / 16 and beta = 3 / 16 for the old vertices.
+    ExpectEQ(level1->vertices_[0], Eigen::Vector3d(3, 3, 3));
+    ExpectEQ(level1->vertices_[1], Eigen::Vector3d(7, 3, 3));
+    // Edge (0, 2) with the opposite vertices 1 and 3.
+    ExpectEQ(level1->vertices_[4], Eigen::Vector3d(2, 6, 2));
+    EXPECT_TRUE(level1->IsEdgeManifold(false));
+    EXPECT_TRUE(level1->IsVertexManifold());
+
+    auto level2 = mesh.SubdivideLoop(2);
+    auto level2_from_level1 = level1->SubdivideLoop(1);
+    ExpectEQ(level2->vertices_, level2_from_level1->vertices_);
+    ExpectEQ(level2->triangles_, level2_from_level1->triangles_);
+
+    // Boundary vertices and edges only use their boundary neighbors, and
+    // vertices without triangles are kept.
+    geometry::TriangleMesh open;
+    open.vertices_ = {{0, 0, 0}, {8, 0, 0}, {0, 8, 0}, {5, 5, 5}};
+    open.triangles_ = {{0, 1, 2}};
+    auto open_level1 = open.SubdivideLoop(1);
+    ExpectEQ(open_level1->vertices_,
+             std::vector<Eigen::Vector3d>({{1, 1, 0},
+                                           {6, 1, 0},
+                                           {1, 6, 0},
+                                           {5, 5, 5},
+                                           {4, 0, 0},
+                                           {4, 4, 0},
+                                           {0, 4, 0}}));
+}
+
 TEST(TriangleMesh, DeformAsRigidAsPossible) {
     geometry::TriangleMesh mesh_in;
     geometry::TriangleMesh mesh_gt;
@@ -1637,6 +1919,98 @@ TEST(TriangleMesh, CropTriangleMesh) {
     ExpectEQ(ref_triangle_normals, output_tm->triangle_normals_);
 }
 
+TEST(TriangleMesh, CreateFromPointCloudBallPivoting) {
+    // Fibonacci sphere with the normals pointing outwards.
+    geometry::PointCloud pcd;
+    int n = 1000;
+    for (int i = 0; i < n; ++i) {
+        double z = 1 - (2 * i + 1.0) / n;
+        double r = std::sqrt(1 - z * z);
+        double phi = i * M_PI * (3 - std::sqrt(5.0));
+        pcd.points_.push_back(
+                Eigen::Vector3d(r * std::cos(phi), r * std::sin(phi), z));
+        pcd.normals_.push_back(pcd.points_.back());
+    }
+
+    auto mesh = geometry::TriangleMesh::CreateFromPointCloudBallPivoting(
+            pcd, std::vector<double>{0.1});
+    EXPECT_EQ(mesh->vertices_.size(), pcd.points_.size());
+    EXPECT_EQ(mesh->triangles_.size(), 2 * pcd.points_.size() - 4);
+    EXPECT_TRUE(mesh->IsEdgeManifold(false));
+    EXPECT_TRUE(mesh->IsVertexManifold());
+    EXPECT_TRUE(mesh->IsOrientable());
+    mesh->ComputeTriangleNormals();
+    for (size_t tidx = 0; tidx < mesh->triangles_.size(); ++tidx) {
+        EXPECT_GT(mesh->triangle_normals_[tidx].dot(
+                          mesh->vertices_[mesh->triangles_[tidx](0)]),
+                  0);
+    }
+
+    // No seed is found for the first radius, the second one reconstructs the
+    // same mesh.
+    auto mesh_radii = geometry::TriangleMesh::CreateFromPointCloudBallPivoting(
+            pcd, {0.05, 0.1});
+    EXPECT_EQ(mesh_radii->triangles_.size(), mesh->triangles_.size());
+    EXPECT_TRUE(mesh_radii->IsEdgeManifold(false));
+}
+
+TEST(TriangleMesh, CreateFromPointCloudBallPivotingNoisy) {
+    // Fibonacci sphere with radial noise, the normals are those of the sphere.
+    geometry::PointCloud pcd;
+    int n = 100;
+    for (int i = 0; i < n; ++i) {
+        double z = 1 - (2 * i + 1.0) / n;
+        double r = std::sqrt(1 - z * z);
+        double phi = i * M_PI * (3 - std::sqrt(5.0));
+        double noise = (unsigned(i) * 2654435761u) % 1000 / 1000.0 - 0.5;
+        Eigen::Vector3d normal(r * std::cos(phi), r * std::sin(phi), z);
+        pcd.points_.push_back((1 + 0.3 * noise) * normal);
+        pcd.normals_.push_back(normal);
+    }
+
+    // Triangles of the sequential depth-first implementation, in the order
+    // they are created. Expanding the front in another order gives different
+    // triangles on noisy input.
+    std::vector<Eigen::Vector3i> triangles_gt = {
+            {0, 2, 5},    {2, 10, 5},   {10, 18, 5},  {10, 23, 18},
+            {23, 31, 18}, {23, 44, 31}, {23, 36, 44}, {23, 28, 36},
+            {28, 49, 36}, {28, 41, 49}, {23, 15, 28}, {15, 20, 28},
+            {20, 33, 28}, {20, 12, 33}, {12, 25, 33}, {25, 46, 33},
+            {46, 54, 33}, {54, 41, 33}, {46, 67, 54}, {67, 75, 54},
+            {75, 62, 54}, {67, 80, 75}, {67, 59, 80}, {59, 72, 80},
+            {72, 85, 80}, {85, 93, 80}, {93, 88, 80}, {93, 96, 88},
+            {93, 98, 96}, {98, 99, 96}, {99, 91, 96}, {91, 83, 96},
+            {91, 78, 83}, {78, 70, 83}, {78, 57, 70}, {57, 49, 70},
+            {49, 62, 70}, {78, 65, 57}, {65, 44, 57}, {44, 57, 52},
+            {52, 44, 65}, {65, 73, 52}, {73, 60, 52}, {60, 39, 52},
+            {60, 47, 39}, {47, 26, 39}, {26, 18, 39}, {26, 13, 18},
+            {26, 21, 13}, {21, 8, 13},  {21, 16, 8},  {21, 29, 16},
+            {29, 24, 16}, {24, 11, 16}, {24, 19, 11}, {19, 6, 11},
+            {6, 3, 11},   {19, 14, 6},  {19, 27, 14}, {27, 35, 14},
+            {35, 22, 14}, {22, 9, 14},  {19, 40, 27}, {19, 32, 40},
+            {32, 53, 40}, {53, 61, 40}, {61, 48, 40}, {19, 24, 32},
+            {24, 45, 32}, {24, 37, 45}, {37, 58, 45}, {58, 66, 45},
+            {66, 53, 45}, {37, 50, 58}, {50, 71, 58}, {50, 63, 71},
+            {63, 76, 71}, {76, 84, 71}, {76, 89, 84}, {63, 55, 76},
+            {55, 68, 76}, {55, 47, 68}, {47, 60, 68}, {60, 73, 68},
+            {73, 81, 68}, {73, 86, 81}, {73, 78, 86}, {78, 91, 86},
+            {91, 94, 86}, {73, 65, 78}, {55, 34, 47}, {34, 26, 47},
+            {34, 21, 26}, {34, 42, 21}, {42, 29, 21}, {42, 50, 29},
+            {50, 37, 29}, {37, 24, 29}, {42, 63, 50}, {42, 55, 63},
+            {42, 34, 55}, {72, 64, 85}, {64, 77, 85}, {77, 90, 85},
+            {77, 82, 90}, {82, 95, 90}, {95, 98, 90}, {82, 87, 95},
+            {87, 92, 95}, {92, 97, 95}, {87, 79, 92}, {82, 74, 87},
+            {77, 69, 82}, {69, 61, 82}, {77, 56, 69}, {56, 69, 64},
+            {64, 56, 77}, {72, 51, 64}, {51, 43, 64}, {51, 30, 43},
+            {30, 43, 38}, {38, 30, 51}, {51, 59, 38}, {59, 46, 38},
+            {46, 25, 38}, {59, 67, 46}, {51, 72, 59}, {20, 7, 12},
+            {7, 4, 12},   {7, 2, 4},    {20, 15, 7},  {23, 10, 15}};
+
+    auto mesh = geometry::TriangleMesh::CreateFromPointCloudBallPivoting(
+            pcd, std::vector<double>{0.25});
+    ExpectEQ(mesh->triangles_, triangles_gt);
+}
+
 TEST(TriangleMesh, CreateFromPointCloudPoisson) {
     geometry::PointCloud pcd;
     pcd.points_ = {
@@ -1869,6 +2243,142 @@ TEST(TriangleMesh, CreateFromPointCloudPoisson) {
             geometry::TriangleMesh::CreateFromPointCloudPoisson(pcd, 2);
     ExpectEQ(*mesh_es, mesh_gt, 1e-4);
     ExpectEQ(densities_es, densities_gt, 1e-4);
+
+    // The default option reproduces the legacy overload with its defaults.
+    std::shared_ptr<geometry::TriangleMesh> mesh_legacy, mesh_option;
+    std::vector<double> densities_legacy, densities_option;
+    std::tie(mesh_legacy, densities_legacy) =
+            geometry::TriangleMesh::CreateFromPointCloudPoisson(pcd);
+    geometry::PoissonReconstructionOption option;
+    std::tie(mesh_option, densities_option) =
+            geometry::TriangleMesh::CreateFromPointCloudPoisson(pcd, option);
+    EXPECT_GT(mesh_legacy->vertices_.size(), 0u);
+    ExpectEQ(*mesh_option, *mesh_legacy);
+    ExpectEQ(densities_option, densities_legacy);
+
+    // The thread count does not change the result, the densities can be
+    // skipped.
+    option = geometry::PoissonReconstructionOption();
+    option.depth_ = 2;
+    option.compute_densities_ = false;
+    for (int n_threads : {1, 2, 4}) {
+        option.n_threads_ = n_threads;
+        std::tie(mesh_es, densities_es) =
+                geometry::TriangleMesh::CreateFromPointCloudPoisson(pcd,
+                                                                    option);
+        ExpectEQ(*mesh_es, mesh_gt, 1e-4);
+        EXPECT_TRUE(densities_es.empty());
+    }
+}
+
+TEST(TriangleMesh, CreateFromPointCloudPoissonSolverOptions) {
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 20);
+    geometry::PointCloud pcd;
+    pcd.points_ = sphere->vertices_;
+    pcd.normals_ = sphere->vertices_;
+
+    // Every solver setting still reconstructs the unit sphere.
+    auto ExpectSphere =
+            [&](const geometry::PoissonReconstructionOption &option) {
+                std::shared_ptr<geometry::TriangleMesh> mesh;
+                std::vector<double> densities;
+                std::tie(mesh, densities) =
+                        geometry::TriangleMesh::CreateFromPointCloudPoisson(
+                                pcd, option);
+                ASSERT_GT(mesh->triangles_.size(), 0u);
+                EXPECT_EQ(densities.size(), option.compute_densities_
+                                                    ? mesh->vertices_.size()
+                                                    : 0u);
+                for (const auto &vertex : mesh->vertices_) {
+                    EXPECT_NEAR(vertex.norm(), 1.0, 0.15);
+                }
+            };
+    geometry::PoissonReconstructionOption option;
+    option.depth_ = 5;
+    ExpectSphere(option);
+    option.compute_densities_ = false;
+    ExpectSphere(option);
+    for (int n_threads : {1, 3}) {
+        option.n_threads_ = n_threads;
+        ExpectSphere(option);
+    }
+    option.cg_depth_ = 5;
+    ExpectSphere(option);
+    option.cg_depth_ = 0;
+    for (int iterations : {4, 16}) {
+        option.iterations_ = iterations;
+        ExpectSphere(option);
+    }
+    option.iterations_ = 8;
+    option.full_depth_ = 2;
+    ExpectSphere(option);
+    option.full_depth_ = 5;
+    for (double point_weight : {0.0, 10.0}) {
+        option.point_weight_ = point_weight;
+        ExpectSphere(option);
+    }
+    option.point_weight_ = 2.0;
+    option.linear_fit_ = true;
+    ExpectSphere(option);
+
+    option.iterations_ = 0;
+    EXPECT_THROW(
+            geometry::TriangleMesh::CreateFromPointCloudPoisson(pcd, option),
+            std::runtime_error);
+    option.iterations_ = 8;
+    option.point_weight_ = -1.0;
+    EXPECT_THROW(
+            geometry::TriangleMesh::CreateFromPointCloudPoisson(pcd, option),
+            std::runtime_error);
+}
+
+TEST(TriangleMesh, CreateFromPointCloudPoissonConcurrent) {
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 20);
+    geometry::PointCloud pcd;
+    pcd.points_ = sphere->vertices_;
+    pcd.normals_ = sphere->vertices_;
+    geometry::PoissonReconstructionOption option;
+    option.depth_ = 4;
+    option.n_threads_ = 1;
+    std::shared_ptr<geometry::TriangleMesh> mesh_gt;
+    std::vector<double> densities_gt;
+    std::tie(mesh_gt, densities_gt) =
+            geometry::TriangleMesh::CreateFromPointCloudPoisson(pcd, option);
+
+    // Calls from several threads share the thread pool one at a time.
+    std::vector<std::shared_ptr<geometry::TriangleMesh>> meshes(4);
+    std::vector<std::vector<double>> densities(meshes.size());
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < meshes.size(); ++i) {
+        threads.emplace_back([&, i]() {
+            std::tie(meshes[i], densities[i]) =
+                    geometry::TriangleMesh::CreateFromPointCloudPoisson(
+                            pcd, option);
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    for (size_t i = 0; i < meshes.size(); ++i) {
+        ExpectEQ(*meshes[i], *mesh_gt);
+        ExpectEQ(densities[i], densities_gt);
+    }
+}
+
+TEST(TriangleMesh, PoissonReconstructionOption) {
+    // The defaults are those of the legacy CreateFromPointCloudPoisson
+    // overload and of PoissonRecon.
+    geometry::PoissonReconstructionOption option;
+    EXPECT_EQ(option.depth_, 8);
+    EXPECT_EQ(option.width_, 0.0);
+    EXPECT_NEAR(option.scale_, 1.1, 1e-12);
+    EXPECT_FALSE(option.linear_fit_);
+    EXPECT_EQ(option.full_depth_, 5);
+    EXPECT_EQ(option.cg_depth_, 0);
+    EXPECT_EQ(option.iterations_, 8);
+    EXPECT_EQ(option.point_weight_, 2.0);
+    EXPECT_EQ(option.n_threads_, -1);
+    EXPECT_TRUE(option.compute_densities_);
 }
 
 TEST(TriangleMesh, CreateFromPointCloudAlphaShape) {
@@ -0,0 +1,165 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cstdio>
+
+#include "Open3D/IO/ClassIO/ImageIO.h"
+#include "Open3D/IO/ClassIO/PinholeCameraTrajectoryIO.h"
+#include "Open3D/IO/ClassIO/RGBDSequenceReader.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+using namespace unit_test;
+
+namespace {
+
+const int kNumFrames = 10;
+
+// Writes kNumFrames pairs of color and depth images whose pixels encode the
+// frame index.
+void WriteSequence(std::vector<std::string> &color_filenames,
+                   std::vector<std::string> &depth_filenames) {
+    color_filenames.clear();
+    depth_filenames.clear();
+    for (int i = 0; i < kNumFrames; i++) {
+        geometry::Image color, depth;
+        color.Prepare(32 + i, 24, 3, 1);
+        depth.Prepare(32 + i, 24, 1, 2);
+        for (size_t j = 0; j < color.data_.size(); j++) {
+            color.data_[j] = uint8_t(i * 7 + j);
+        }
+        for (int j = 0; j < depth.width_ * depth.height_; j++) {
+            *depth.PointerAt<uint16_t>(j % depth.width_, j / depth.width_) =
+                    uint16_t(i * 1000 + j);
+        }
+        color_filenames.push_back("tmp_color_" + std::to_string(i) + ".png");
+        depth_filenames.push_back("tmp_depth_" + std::to_string(i) + ".png");
+        io::WriteImage(color_filenames.back(), color);
+        io::WriteImage(depth_filenames.back(), depth);
+    }
+}
+
+void RemoveSequence(const std::vector<std::string> &color_filenames,
+                    const std::vector<std::string> &depth_filenames) {
+    for (size_t i = 0; i < color_filenames.size(); i++) {
+        std::remove(color_filenames[i].c_str());
+        std::remove(depth_filenames[i].c_str());
+    }
+}
+
+}  // unnamed namespace
+
+TEST(RGBDSequenceReader, NextFrame) {
+    std::vector<std::string> color_filenames, depth_filenames;
+    WriteSequence(color_filenames, depth_filenames);
+
+    for (int max_buffered_frames : {1, 3, 16}) {
+        io::RGBDSequenceReader reader(2, max_buffered_frames);
+        EXPECT_FALSE(reader.IsOpened());
+        EXPECT_TRUE(reader.Open(color_filenames, depth_filenames));
+        EXPECT_TRUE(reader.IsOpened());
+        EXPECT_EQ(reader.GetNumFrames(), kNumFrames);
+        EXPECT_FALSE(reader.HasTrajectory());
+
+        geometry::Image color, depth, color_gt, depth_gt;
+        for (int i = 0; i < kNumFrames; i++) {
+            EXPECT_FALSE(reader.IsEOF());
+            EXPECT_EQ(reader.GetFrameIndex(), i);
+            EXPECT_TRUE(reader.NextFrame(color, depth));
+            io::ReadImage(color_filenames[i], color_gt);
+            io::ReadImage(depth_filenames[i], depth_gt);
+            EXPECT_EQ(color.width_, color_gt.width_);
+            EXPECT_EQ(color.num_of_channels_, 3);
+            EXPECT_EQ(color.data_, color_gt.data_);
+            EXPECT_EQ(depth.width_, depth_gt.width_);
+            EXPECT_EQ(depth.bytes_per_channel_, 2);
+            EXPECT_EQ(depth.data_, depth_gt.data_);
+        }
+        EXPECT_TRUE(reader.IsEOF());
+        EXPECT_FALSE(reader.NextFrame(color, depth));
+    }
+
+    // Closing before all the frames are read stops the decoding threads.
+    io::RGBDSequenceReader reader(4, 2);
+    EXPECT_TRUE(reader.Open(color_filenames, depth_filenames));
+    geometry::Image color, depth;
+    EXPECT_TRUE(reader.NextFrame(color, depth));
+    reader.Close();
+    EXPECT_FALSE(reader.IsOpened());
+    EXPECT_FALSE(reader.NextFrame(color, depth));
+
+    RemoveSequence(color_filenames, depth_filenames);
+}
+
+TEST(RGBDSequenceReader, OpenWithTrajectory) {
+    std::vector<std::string> color_filenames, depth_filenames;
+    WriteSequence(color_filenames, depth_filenames);
+
+    camera::PinholeCameraTrajectory trajectory;
+    trajectory.parameters_.resize(kNumFrames);
+    for (int i = 0; i < kNumFrames; i++) {
+        trajectory.parameters_[i].extrinsic_.setIdentity();
+        trajectory.parameters_[i].extrinsic_(0, 3) = i;
+    }
+    io::WritePinholeCameraTrajectory("tmp.log", trajectory);
+
+    io::RGBDSequenceReader reader;
+    EXPECT_TRUE(reader.Open(color_filenames, depth_filenames, "tmp.log"));
+    EXPECT_TRUE(reader.HasTrajectory());
+    const auto &parameters = reader.GetTrajectory().parameters_;
+    ASSERT_EQ(parameters.size(), size_t(kNumFrames));
+    for (int i = 0; i < kNumFrames; i++) {
+        EXPECT_EQ(parameters[i].extrinsic_(0, 3), i);
+    }
+
+    // The trajectory must have a pose for every frame.
+    color_filenames.push_back(color_filenames[0]);
+    depth_filenames.push_back(depth_filenames[0]);
+    EXPECT_FALSE(reader.Open(color_filenames, depth_filenames, "tmp.log"));
+    EXPECT_FALSE(reader.IsOpened());
+    color_filenames.pop_back();
+    depth_filenames.pop_back();
+
+    std::remove("tmp.log");
+    RemoveSequence(color_filenames, depth_filenames);
+}
+
+TEST(RGBDSequenceReader, MissingFrame) {
+    std::vector<std::string> color_filenames, depth_filenames;
+    WriteSequence(color_filenames, depth_filenames);
+    std::remove(depth_filenames[4].c_str());
+
+    io::RGBDSequenceReader reader(3, 4);
+    EXPECT_FALSE(reader.Open(color_filenames, {depth_filenames[0]}));
+    EXPECT_TRUE(reader.Open(color_filenames, depth_filenames));
+    geometry::Image color, depth;
+    for (int i = 0; i < kNumFrames; i++) {
+        EXPECT_EQ(reader.NextFrame(color, depth), i != 4);
+    }
+    EXPECT_TRUE(reader.IsEOF());
+
+    RemoveSequence(color_filenames, depth_filenames);
+}
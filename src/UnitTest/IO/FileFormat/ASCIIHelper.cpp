@@ -0,0 +1,107 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/IO/FileFormat/ASCIIHelper.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+using namespace unit_test;
+
+TEST(ASCIIHelper, ParseASCIIDouble) {
+    // Same results as strtod in the "C" locale, including the slow path for
+    // long mantissas and large exponents.
+    const char *numbers[] = {"0",
+                             "-0",
+                             "1",
+                             "+12.5",
+                             "-.25",
+                             "3.",
+                             "0.1",
+                             "123.4567890123",
+                             "-0.0000000001",
+                             "1e-5",
+                             "2.5E+10",
+                             "9007199254740993",
+                             "0.30000000000000000000000000001",
+                             "12345678901234567890123",
+                             "1.7976931348623157e308",
+                             "4.9e-324",
+                             "1e400"};
+    for (const char *number : numbers) {
+        double value;
+        const char *end = number + std::strlen(number);
+        EXPECT_EQ(io::ParseASCIIDouble(number, end, value), end) << number;
+        EXPECT_EQ(value, std::strtod(number, nullptr)) << number;
+    }
+
+    double value;
+    const char text[] = " \t-inf nan 1.5abc";
+    const char *p = text;
+    const char *end = text + sizeof(text) - 1;
+    p = io::ParseASCIIDouble(p, end, value);
+    EXPECT_TRUE(std::isinf(value) && value < 0);
+    p = io::ParseASCIIDouble(p, end, value);
+    EXPECT_TRUE(std::isnan(value));
+    p = io::ParseASCIIDouble(p, end, value);
+    EXPECT_EQ(value, 1.5);
+    EXPECT_EQ(*p, 'a');
+    EXPECT_EQ(io::ParseASCIIDouble(p, end, value), nullptr);
+
+    const char empty[] = "  \r";
+    EXPECT_EQ(io::ParseASCIIDouble(empty, empty + 3, value), nullptr);
+    const char sign[] = "- 1";
+    EXPECT_EQ(io::ParseASCIIDouble(sign, sign + 3, value), nullptr);
+}
+
+TEST(ASCIIHelper, ParseASCIILines) {
+    // Enough lines for several chunks.
+    std::string text;
+    const int num_lines = 300000;
+    for (int i = 0; i < num_lines; i++) {
+        text += (i % 3 == 0) ? "skipped\n" : std::to_string(i) + "\n";
+    }
+    std::vector<io::ASCIIChunk> chunks =
+            io::SplitASCIIChunks(text.data(), text.size());
+    EXPECT_GT(chunks.size(), 1u);
+    EXPECT_EQ(io::CountASCIILines(chunks), size_t(num_lines));
+
+    std::vector<double> values(io::CountASCIILines(chunks));
+    size_t num_values = io::ParseASCIILines(
+            chunks,
+            [&](const char *begin, const char *end, size_t i) {
+                return io::ParseASCIIDouble(begin, end, values[i]) != nullptr;
+            },
+            [&](size_t from, size_t to) { values[to] = values[from]; });
+    EXPECT_EQ(num_values, size_t(num_lines - num_lines / 3));
+    for (size_t i = 0; i < num_values; i++) {
+        EXPECT_EQ(values[i], double(i / 2 * 3 + i % 2 + 1));
+    }
+}
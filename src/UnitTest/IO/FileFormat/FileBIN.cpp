@@ -24,12 +24,113 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <cstdio>
+
+#include "Open3D/IO/ClassIO/FeatureIO.h"
+#include "Open3D/IO/ClassIO/PinholeCameraTrajectoryIO.h"
+#include "Open3D/IO/ClassIO/PoseGraphIO.h"
 #include "TestUtility/UnitTest.h"
 
+using namespace open3d;
+using namespace unit_test;
+
 TEST(FileBIN, DISABLED_ReadMatrixXdFromBINFile) { unit_test::NotImplemented(); }
 
 TEST(FileBIN, DISABLED_WriteMatrixXdToBINFile) { unit_test::NotImplemented(); }
 
-TEST(FileBIN, DISABLED_ReadFeatureFromBIN) { unit_test::NotImplemented(); }
+TEST(FileBIN, WriteReadFeature) {
+    registration::Feature feature_gt;
+    feature_gt.Resize(33, 1000);
+    feature_gt.data_.setRandom();
+    EXPECT_TRUE(io::WriteFeature("tmp.bin", feature_gt));
+    registration::Feature feature_test;
+    EXPECT_TRUE(io::ReadFeature("tmp.bin", feature_test));
+    ExpectEQ(feature_test.data_, feature_gt.data_, 0.0);
+
+    // Files written without header are still readable.
+    FILE *file = fopen("tmp.bin", "wb");
+    uint32_t rows = (uint32_t)feature_gt.Dimension();
+    uint32_t cols = (uint32_t)feature_gt.Num();
+    fwrite(&rows, sizeof(uint32_t), 1, file);
+    fwrite(&cols, sizeof(uint32_t), 1, file);
+    fwrite(feature_gt.data_.data(), sizeof(double), rows * cols, file);
+    fclose(file);
+    EXPECT_TRUE(io::ReadFeature("tmp.bin", feature_test));
+    ExpectEQ(feature_test.data_, feature_gt.data_, 0.0);
+    std::remove("tmp.bin");
+}
+
+TEST(FileBIN, WriteReadPoseGraph) {
+    registration::PoseGraph pose_graph_gt;
+    for (int i = 0; i < 100; i++) {
+        Eigen::Matrix4d pose = Eigen::Matrix4d::Random();
+        pose_graph_gt.nodes_.push_back(registration::PoseGraphNode(pose));
+    }
+    for (int i = 0; i < 5000; i++) {
+        pose_graph_gt.edges_.push_back(registration::PoseGraphEdge(
+                i % 100, (i * 7) % 100, Eigen::Matrix4d::Random(),
+                Eigen::Matrix6d::Random(), i % 3 == 0, 0.01 * i));
+    }
+    EXPECT_TRUE(io::WritePoseGraph("tmp.bin", pose_graph_gt));
+    registration::PoseGraph pose_graph_test;
+    EXPECT_TRUE(io::ReadPoseGraph("tmp.bin", pose_graph_test));
+    ASSERT_EQ(pose_graph_test.nodes_.size(), pose_graph_gt.nodes_.size());
+    ASSERT_EQ(pose_graph_test.edges_.size(), pose_graph_gt.edges_.size());
+    for (size_t i = 0; i < pose_graph_gt.nodes_.size(); i++) {
+        ExpectEQ(pose_graph_test.nodes_[i].pose_, pose_graph_gt.nodes_[i].pose_,
+                 0.0);
+    }
+    for (size_t i = 0; i < pose_graph_gt.edges_.size(); i++) {
+        const auto &edge_gt = pose_graph_gt.edges_[i];
+        const auto &edge_test = pose_graph_test.edges_[i];
+        EXPECT_EQ(edge_test.source_node_id_, edge_gt.source_node_id_);
+        EXPECT_EQ(edge_test.target_node_id_, edge_gt.target_node_id_);
+        ExpectEQ(edge_test.transformation_, edge_gt.transformation_, 0.0);
+        ExpectEQ(edge_test.information_, edge_gt.information_, 0.0);
+        EXPECT_EQ(edge_test.uncertain_, edge_gt.uncertain_);
+        EXPECT_EQ(edge_test.confidence_, edge_gt.confidence_);
+    }
+
+    // Other BIN files are rejected.
+    EXPECT_TRUE(io::WriteFeature("tmp.bin", registration::Feature()));
+    EXPECT_FALSE(io::ReadPoseGraph("tmp.bin", pose_graph_test));
+    std::remove("tmp.bin");
+}
+
+TEST(FileBIN, WriteReadPinholeCameraTrajectory) {
+    camera::PinholeCameraTrajectory trajectory_gt;
+    trajectory_gt.parameters_.resize(50);
+    for (size_t i = 0; i < trajectory_gt.parameters_.size(); i++) {
+        auto &parameters = trajectory_gt.parameters_[i];
+        parameters.intrinsic_.SetIntrinsics(640, 480, 525.0 + i, 525.0,
+                                            319.5, 239.5);
+        parameters.extrinsic_ = Eigen::Matrix4d::Random();
+    }
+    EXPECT_TRUE(io::WritePinholeCameraTrajectory("tmp.bin", trajectory_gt));
+    camera::PinholeCameraTrajectory trajectory_test;
+    EXPECT_TRUE(io::ReadPinholeCameraTrajectory("tmp.bin", trajectory_test));
+    ASSERT_EQ(trajectory_test.parameters_.size(),
+              trajectory_gt.parameters_.size());
+    for (size_t i = 0; i < trajectory_gt.parameters_.size(); i++) {
+        const auto &parameters_gt = trajectory_gt.parameters_[i];
+        const auto &parameters_test = trajectory_test.parameters_[i];
+        EXPECT_EQ(parameters_test.intrinsic_.width_,
+                  parameters_gt.intrinsic_.width_);
+        EXPECT_EQ(parameters_test.intrinsic_.height_,
+                  parameters_gt.intrinsic_.height_);
+        ExpectEQ(parameters_test.intrinsic_.intrinsic_matrix_,
+                 parameters_gt.intrinsic_.intrinsic_matrix_, 0.0);
+        ExpectEQ(parameters_test.extrinsic_, parameters_gt.extrinsic_, 0.0);
+    }
 
-TEST(FileBIN, DISABLED_WriteFeatureToBIN) { unit_test::NotImplemented(); }
+    // A truncated file is rejected.
+    FILE *file = fopen("tmp.bin", "rb");
+    std::vector<char> buffer(100000);
+    size_t size = fread(buffer.data(), 1, buffer.size(), file);
+    fclose(file);
+    file = fopen("tmp.bin", "wb");
+    fwrite(buffer.data(), 1, size - 8, file);
+    fclose(file);
+    EXPECT_FALSE(io::ReadPinholeCameraTrajectory("tmp.bin", trajectory_test));
+    std::remove("tmp.bin");
+}
@@ -0,0 +1,127 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cstdio>
+#include <fstream>
+
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/IO/ClassIO/TriangleMeshIO.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+using namespace unit_test;
+
+TEST(FileOBJ, ReadTriangleMeshFromOBJ) {
+    std::ofstream("tmp.mtl") << "newmtl red\nKd 1 0 0\n"
+                             << "newmtl green\nKd 0 1 0\n";
+    // A quad with texture coordinates, and a triangle that uses two of its
+    // vertices with another normal and relative indices.
+    std::ofstream("tmp.obj") << "# comment\n"
+                             << "mtllib tmp.mtl\n"
+                             << "v 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\n"
+                             << "v 0 0 1 0.5 0.5 0.5\n"
+                             << "vt 0 0\nvt 1 0\nvt 1 1\nvt 0 1\n"
+                             << "vn 0 0 1\nvn 1 0 0\n"
+                             << "usemtl green\n"
+                             << "f 1/1/1 2/2/1 3/3/1 4/4/1\n"
+                             << "usemtl red\n"
+                             << "f -5/1/-1 -4/2/-1 -1/4/-1\r\n";
+    geometry::TriangleMesh mesh;
+    EXPECT_TRUE(io::ReadTriangleMesh("tmp.obj", mesh));
+
+    // Vertices 0 and 1 are duplicated for their second normal.
+    ASSERT_EQ(mesh.vertices_.size(), 7u);
+    ExpectEQ(mesh.vertices_[5], Eigen::Vector3d(0, 0, 0));
+    ExpectEQ(mesh.vertices_[6], Eigen::Vector3d(1, 0, 0));
+    ExpectEQ(mesh.vertex_colors_[3], Eigen::Vector3d(1, 1, 1));
+    ExpectEQ(mesh.vertex_colors_[4], Eigen::Vector3d(0.5, 0.5, 0.5));
+    ASSERT_EQ(mesh.vertex_normals_.size(), 7u);
+    ExpectEQ(mesh.vertex_normals_[0], Eigen::Vector3d(0, 0, 1));
+    ExpectEQ(mesh.vertex_normals_[1], Eigen::Vector3d(0, 0, 1));
+    ExpectEQ(mesh.vertex_normals_[4], Eigen::Vector3d(1, 0, 0));
+    ExpectEQ(mesh.vertex_normals_[5], Eigen::Vector3d(1, 0, 0));
+    ExpectEQ(mesh.vertex_normals_[6], Eigen::Vector3d(1, 0, 0));
+
+    ASSERT_EQ(mesh.triangles_.size(), 3u);
+    ExpectEQ(mesh.triangles_[0], Eigen::Vector3i(0, 1, 2));
+    ExpectEQ(mesh.triangles_[1], Eigen::Vector3i(0, 2, 3));
+    ExpectEQ(mesh.triangles_[2], Eigen::Vector3i(5, 6, 4));
+    ASSERT_EQ(mesh.triangle_uvs_.size(), 9u);
+    ExpectEQ(mesh.triangle_uvs_[4], Eigen::Vector2d(1, 1));
+    ExpectEQ(mesh.triangle_uvs_[8], Eigen::Vector2d(0, 1));
+    EXPECT_EQ(mesh.triangle_material_ids_, std::vector<int>({1, 1, 0}));
+    ASSERT_EQ(mesh.materials_.size(), 2u);
+    EXPECT_EQ(mesh.materials_["red"].baseColor.f4[0], 1.0f);
+
+    // Indices out of range are rejected.
+    std::ofstream("tmp.obj") << "v 0 0 0\nv 1 0 0\nv 1 1 0\nf 1 2 4\n";
+    EXPECT_FALSE(io::ReadTriangleMesh("tmp.obj", mesh));
+
+    std::remove("tmp.obj");
+    std::remove("tmp.mtl");
+}
+
+TEST(FileOBJ, WriteReadTriangleMesh) {
+    // Large enough to be parsed in several chunks.
+    geometry::TriangleMesh mesh_gt;
+    const int num_vertices = 50000;
+    const int num_triangles = 100000;
+    mesh_gt.vertices_.resize(num_vertices);
+    mesh_gt.vertex_normals_.resize(num_vertices);
+    mesh_gt.vertex_colors_.resize(num_vertices);
+    mesh_gt.triangles_.resize(num_triangles);
+    mesh_gt.triangle_uvs_.resize(3 * num_triangles);
+    Rand(mesh_gt.vertices_, Eigen::Vector3d(-1, -1, -1),
+         Eigen::Vector3d(1, 1, 1), 0);
+    Rand(mesh_gt.vertex_normals_, Eigen::Vector3d(-1, -1, -1),
+         Eigen::Vector3d(1, 1, 1), 1);
+    Rand(mesh_gt.vertex_colors_, Eigen::Vector3d(0, 0, 0),
+         Eigen::Vector3d(1, 1, 1), 2);
+    Rand(mesh_gt.triangles_, Eigen::Vector3i(0, 0, 0),
+         Eigen::Vector3i(num_vertices - 1, num_vertices - 1, num_vertices - 1),
+         3);
+    for (auto &uv : mesh_gt.triangle_uvs_) {
+        uv = (Eigen::Vector2d::Random() + Eigen::Vector2d(1, 1)) / 2;
+    }
+    // Every vertex is referenced, so that all of them have a normal.
+    for (int i = 0; i < num_vertices; i++) {
+        mesh_gt.triangles_[i](0) = i;
+    }
+    EXPECT_TRUE(io::WriteTriangleMesh("tmp.obj", mesh_gt));
+
+    geometry::TriangleMesh mesh_test;
+    EXPECT_TRUE(io::ReadTriangleMesh("tmp.obj", mesh_test));
+    ExpectEQ(mesh_test.vertices_, mesh_gt.vertices_, 1e-5);
+    ExpectEQ(mesh_test.vertex_normals_, mesh_gt.vertex_normals_, 1e-5);
+    ExpectEQ(mesh_test.vertex_colors_, mesh_gt.vertex_colors_, 1e-5);
+    ExpectEQ(mesh_test.triangles_, mesh_gt.triangles_);
+    ExpectEQ(mesh_test.triangle_uvs_, mesh_gt.triangle_uvs_, 1e-5);
+    EXPECT_EQ(mesh_test.triangle_material_ids_,
+              std::vector<int>(num_triangles, 0));
+
+    std::remove("tmp.obj");
+    std::remove("tmp.mtl");
+}
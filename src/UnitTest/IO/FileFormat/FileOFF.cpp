@@ -0,0 +1,82 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cstdio>
+#include <fstream>
+
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/IO/ClassIO/TriangleMeshIO.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+using namespace unit_test;
+
+TEST(FileOFF, WriteReadTriangleMesh) {
+    auto tm_gt = geometry::TriangleMesh::CreateSphere(1.0, 40);
+    tm_gt->ComputeVertexNormals();
+    tm_gt->vertex_colors_.resize(tm_gt->vertices_.size());
+    for (size_t i = 0; i < tm_gt->vertices_.size(); i++) {
+        tm_gt->vertex_colors_[i] =
+                Eigen::Vector3d(i % 256, (i / 256) % 256, 255) / 255.0;
+    }
+    EXPECT_TRUE(io::WriteTriangleMesh("tmp.off", *tm_gt));
+
+    geometry::TriangleMesh tm_test;
+    EXPECT_TRUE(io::ReadTriangleMesh("tmp.off", tm_test, false));
+    ExpectEQ(tm_test.vertices_, tm_gt->vertices_, 1e-5);
+    ExpectEQ(tm_test.vertex_normals_, tm_gt->vertex_normals_, 1e-5);
+    ExpectEQ(tm_test.vertex_colors_, tm_gt->vertex_colors_, 1e-12);
+    ExpectEQ(tm_test.triangles_, tm_gt->triangles_);
+    std::remove("tmp.off");
+}
+
+TEST(FileOFF, ReadPolygonsAndComments) {
+    std::ofstream("tmp.off") << "# comment\n"
+                                "OFF\n"
+                                "6 3 0\n"
+                                "0 0 0\n"
+                                "1 0 0\n"
+                                "\n"
+                                "1 1 0\n"
+                                "# comment\r\n"
+                                "0 1 0\n"
+                                "2 0 0\r\n"
+                                "2 1 0\n"
+                                "4 0 1 2 3\n"
+                                "3 1 4 5\n"
+                                "3 1 5 2";
+    geometry::TriangleMesh tm_test;
+    EXPECT_TRUE(io::ReadTriangleMesh("tmp.off", tm_test, false));
+    EXPECT_EQ(tm_test.vertices_.size(), 6u);
+    EXPECT_EQ(tm_test.triangles_.size(), 4u);
+    ExpectEQ(tm_test.vertices_[4], Eigen::Vector3d(2, 0, 0));
+    ExpectEQ(tm_test.triangles_[2], Eigen::Vector3i(1, 4, 5));
+
+    // Out of range vertex indices are rejected.
+    std::ofstream("tmp.off") << "OFF\n3 1 0\n0 0 0\n1 0 0\n0 1 0\n3 0 1 3\n";
+    EXPECT_FALSE(io::ReadTriangleMesh("tmp.off", tm_test, false));
+    std::remove("tmp.off");
+}
@@ -0,0 +1,140 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#include "Open3D/Geometry/KDTreeFlann.h"
+#include "Open3D/Geometry/Octree.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/IO/ClassIO/OctreeIO.h"
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
+#include "TestUtility/RandomPointCloud.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+using namespace unit_test;
+
+TEST(FileOPC, EncodeDecodePointCloud) {
+    geometry::PointCloud pcd_gt = CreateRandomPointCloud(100000);
+    io::OctreeCompressionOption option;
+    option.depth_ = 10;
+    std::vector<uint8_t> buffer;
+    EXPECT_TRUE(io::EncodePointCloudToOPC(pcd_gt, buffer, option));
+    EXPECT_LT(buffer.size(), pcd_gt.points_.size() * 6);
+
+    geometry::PointCloud pcd_test;
+    EXPECT_TRUE(io::DecodePointCloudFromOPC(buffer, pcd_test));
+    // A few points share a leaf and are merged.
+    EXPECT_LE(pcd_test.points_.size(), pcd_gt.points_.size());
+    EXPECT_GE(pcd_test.points_.size(), pcd_gt.points_.size() * 99 / 100);
+    EXPECT_TRUE(pcd_test.HasColors());
+
+    // Every point is decoded to the center of its leaf.
+    const double extent =
+            (pcd_gt.GetMaxBound() - pcd_gt.GetMinBound()).maxCoeff();
+    const double threshold = extent / (1 << option.depth_) * std::sqrt(3.0) / 2;
+    geometry::KDTreeFlann kdtree(pcd_test);
+    std::vector<int> indices(1);
+    std::vector<double> distances2(1);
+    for (const auto &point : pcd_gt.points_) {
+        kdtree.SearchKNN(point, 1, indices, distances2);
+        EXPECT_LE(std::sqrt(distances2[0]), threshold + 1e-9);
+    }
+
+    // The stream can be decoded in place, e.g. from a mapped file.
+    geometry::PointCloud pcd_in_place;
+    EXPECT_TRUE(io::DecodePointCloudFromOPC(buffer.data(), buffer.size(),
+                                            pcd_in_place));
+    ExpectEQ(pcd_in_place.points_, pcd_test.points_, 0.0);
+    ExpectEQ(pcd_in_place.colors_, pcd_test.colors_, 0.0);
+
+    // A header claiming more points than the stream holds is rejected before
+    // the points are allocated. The number of points is the uint64 at byte
+    // 48 of the header.
+    std::vector<uint8_t> inflated = buffer;
+    const std::uint64_t num_points = std::uint64_t(1) << 60;
+    std::memcpy(inflated.data() + 48, &num_points, sizeof(num_points));
+    EXPECT_FALSE(io::DecodePointCloudFromOPC(inflated, pcd_test));
+    geometry::Octree octree;
+    EXPECT_FALSE(io::DecodeOctreeFromOPC(inflated.data(), inflated.size(),
+                                         octree));
+
+    // Corrupted streams are rejected.
+    buffer.resize(buffer.size() / 2);
+    EXPECT_FALSE(io::DecodePointCloudFromOPC(buffer, pcd_test));
+}
+
+TEST(FileOPC, WriteReadPointCloudWithDuplicates) {
+    geometry::PointCloud pcd_gt = CreateRandomPointCloud(20000);
+    io::OctreeCompressionOption option;
+    option.depth_ = 4;
+    option.keep_duplicates_ = true;
+    EXPECT_TRUE(io::WritePointCloudToOPCWithOption("tmp.opc", pcd_gt, option));
+    geometry::PointCloud pcd_test;
+    EXPECT_TRUE(io::ReadPointCloud("tmp.opc", pcd_test));
+    ASSERT_EQ(pcd_test.points_.size(), pcd_gt.points_.size());
+
+    // The colors are kept per point, in leaf order.
+    auto sorted = [](std::vector<Eigen::Vector3d> colors) {
+        std::sort(colors.begin(), colors.end(),
+                  [](const Eigen::Vector3d &a, const Eigen::Vector3d &b) {
+                      return std::lexicographical_compare(
+                              a.data(), a.data() + 3, b.data(), b.data() + 3);
+                  });
+        return colors;
+    };
+    ExpectEQ(sorted(pcd_gt.colors_), sorted(pcd_test.colors_), 1e-12);
+
+    // Without duplicates there is one point per leaf.
+    option.keep_duplicates_ = false;
+    EXPECT_TRUE(io::WritePointCloudToOPCWithOption("tmp.opc", pcd_gt, option));
+    EXPECT_TRUE(io::ReadPointCloud("tmp.opc", pcd_test));
+    EXPECT_EQ(pcd_test.points_.size(),
+              pcd_test.VoxelDownSample(1e-6)->points_.size());
+    EXPECT_LE(pcd_test.points_.size(), 4096u);
+    std::remove("tmp.opc");
+}
+
+TEST(FileOPC, WriteReadOctree) {
+    geometry::PointCloud pcd = CreateRandomPointCloud(20000);
+    geometry::Octree octree_gt(8);
+    octree_gt.ConvertFromPointCloud(pcd, 0.01);
+    EXPECT_TRUE(io::WriteOctree("tmp.opc", octree_gt));
+    geometry::Octree octree_test;
+    EXPECT_TRUE(io::ReadOctree("tmp.opc", octree_test));
+    EXPECT_TRUE(octree_gt == octree_test);
+    std::remove("tmp.opc");
+
+    // Octrees with leaves above the maximum depth are rejected.
+    geometry::Octree octree_shallow(8);
+    octree_shallow.root_node_ =
+            std::make_shared<geometry::OctreeColorLeafNode>();
+    std::vector<uint8_t> buffer;
+    EXPECT_FALSE(io::EncodeOctreeToOPC(octree_shallow, buffer));
+}
@@ -24,8 +24,39 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <liblzf/lzf.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
+#include "TestUtility/RandomPointCloud.h"
 #include "TestUtility/UnitTest.h"
 
+using namespace open3d;
+using namespace unit_test;
+
+namespace {
+
+std::vector<char> ReadFileContent(const std::string &filename) {
+    std::vector<char> content;
+    FILE *file = fopen(filename.c_str(), "rb");
+    if (file != nullptr) {
+        char buffer[4096];
+        size_t size;
+        while ((size = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+            content.insert(content.end(), buffer, buffer + size);
+        }
+        fclose(file);
+    }
+    return content;
+}
+
+}  // unnamed namespace
+
 TEST(FilePCD, DISABLED_CheckHeader) { unit_test::NotImplemented(); }
 
 TEST(FilePCD, DISABLED_ReadPCDHeader) { unit_test::NotImplemented(); }
@@ -55,3 +86,67 @@ TEST(FilePCD, DISABLED_WritePCDData) { unit_test::NotImplemented(); }
 TEST(FilePCD, DISABLED_ReadPointCloudFromPCD) { unit_test::NotImplemented(); }
 
 TEST(FilePCD, DISABLED_WritePointCloudToPCD) { unit_test::NotImplemented(); }
+
+TEST(FilePCD, WriteReadBinaryCompressed) {
+    // Large enough to be compressed in several blocks.
+    geometry::PointCloud pcd_gt = CreateRandomPointCloud(300000);
+    EXPECT_TRUE(io::WritePointCloud("tmp_binary.pcd", pcd_gt, false, false));
+    EXPECT_TRUE(io::WritePointCloud("tmp_compressed.pcd", pcd_gt, false, true));
+    geometry::PointCloud pcd_binary;
+    geometry::PointCloud pcd_compressed;
+    EXPECT_TRUE(io::ReadPointCloud("tmp_binary.pcd", pcd_binary));
+    EXPECT_TRUE(io::ReadPointCloud("tmp_compressed.pcd", pcd_compressed));
+    ExpectEQ(pcd_gt.points_, pcd_compressed.points_, /*threshold*/ 1e-4);
+    ExpectEQ(pcd_gt.normals_, pcd_compressed.normals_, /*threshold*/ 1e-6);
+    ExpectEQ(pcd_binary.points_, pcd_compressed.points_, /*threshold*/ 0.0);
+    ExpectEQ(pcd_binary.normals_, pcd_compressed.normals_, /*threshold*/ 0.0);
+    ExpectEQ(pcd_binary.colors_, pcd_compressed.colors_, /*threshold*/ 0.0);
+    std::remove("tmp_binary.pcd");
+    std::remove("tmp_compressed.pcd");
+}
+
+TEST(FilePCD, BinaryCompressedIsSingleLZFStream) {
+    geometry::PointCloud pcd_gt = CreateRandomPointCloud(300000);
+    EXPECT_TRUE(io::WritePointCloud("tmp_compressed.pcd", pcd_gt, false, true));
+    std::vector<char> content = ReadFileContent("tmp_compressed.pcd");
+    const std::string data_line = "DATA binary_compressed\n";
+    auto it = std::search(content.begin(), content.end(), data_line.begin(),
+                          data_line.end());
+    ASSERT_NE(it, content.end());
+    const size_t header_size = (it - content.begin()) + data_line.size();
+    std::uint32_t compressed_size, uncompressed_size;
+    memcpy(&compressed_size, content.data() + header_size, 4);
+    memcpy(&uncompressed_size, content.data() + header_size + 4, 4);
+    EXPECT_EQ(header_size + 8 + compressed_size, content.size());
+    EXPECT_EQ(uncompressed_size, 300000u * 7 * 4);
+
+    // A reader decompressing the payload in one call, as PCL does.
+    std::vector<char> data(uncompressed_size);
+    EXPECT_EQ(lzf_decompress(content.data() + header_size + 8,
+                             compressed_size, data.data(), uncompressed_size),
+              uncompressed_size);
+
+    // A payload compressed as a single stream, as PCL writes it.
+    std::vector<char> compressed(uncompressed_size * 2);
+    compressed_size = lzf_compress(data.data(), uncompressed_size,
+                                   compressed.data(), uncompressed_size * 2);
+    ASSERT_GT(compressed_size, 0u);
+    FILE *file = fopen("tmp_single_stream.pcd", "wb");
+    ASSERT_NE(file, nullptr);
+    fwrite(content.data(), 1, header_size, file);
+    fwrite(&compressed_size, 4, 1, file);
+    fwrite(&uncompressed_size, 4, 1, file);
+    fwrite(compressed.data(), 1, compressed_size, file);
+    fclose(file);
+
+    geometry::PointCloud pcd_blocks;
+    geometry::PointCloud pcd_single_stream;
+    EXPECT_TRUE(io::ReadPointCloud("tmp_compressed.pcd", pcd_blocks));
+    EXPECT_TRUE(io::ReadPointCloud("tmp_single_stream.pcd", pcd_single_stream));
+    ExpectEQ(pcd_blocks.points_, pcd_single_stream.points_, /*threshold*/ 0.0);
+    ExpectEQ(pcd_blocks.normals_, pcd_single_stream.normals_,
+             /*threshold*/ 0.0);
+    ExpectEQ(pcd_blocks.colors_, pcd_single_stream.colors_, /*threshold*/ 0.0);
+    std::remove("tmp_compressed.pcd");
+    std::remove("tmp_single_stream.pcd");
+}
@@ -24,8 +24,17 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <cstdio>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
+#include "Open3D/IO/ClassIO/TriangleMeshIO.h"
 #include "TestUtility/UnitTest.h"
 
+using namespace open3d;
+using namespace unit_test;
+
 TEST(FilePLY, DISABLED_ReadVertexCallback) { unit_test::NotImplemented(); }
 
 TEST(FilePLY, DISABLED_AdvanceConsoleProgress) { unit_test::NotImplemented(); }
@@ -36,11 +45,96 @@ TEST(FilePLY, DISABLED_ReadColorCallback) { unit_test::NotImplemented(); }
 
 TEST(FilePLY, DISABLED_ReadFaceCallBack) { unit_test::NotImplemented(); }
 
-TEST(FilePLY, DISABLED_ReadPointCloudFromPLY) { unit_test::NotImplemented(); }
+TEST(FilePLY, ReadPointCloudFromPLY) {
+    geometry::PointCloud pcd_gt;
+    pcd_gt.points_.resize(100000);
+    pcd_gt.normals_.resize(100000);
+    pcd_gt.colors_.resize(100000);
+    Rand(pcd_gt.points_, Eigen::Vector3d(-100, -100, -100),
+         Eigen::Vector3d(100, 100, 100), 0);
+    Rand(pcd_gt.normals_, Eigen::Vector3d(-1, -1, -1),
+         Eigen::Vector3d(1, 1, 1), 1);
+    Rand(pcd_gt.colors_, Eigen::Vector3d(0, 0, 0), Eigen::Vector3d(1, 1, 1),
+         2);
+
+    // Binary files are read by the bulk reader, ASCII files by rply.
+    EXPECT_TRUE(io::WritePointCloud("tmp_binary.ply", pcd_gt, false));
+    EXPECT_TRUE(io::WritePointCloud("tmp_ascii.ply", pcd_gt, true));
+    geometry::PointCloud pcd_binary;
+    geometry::PointCloud pcd_ascii;
+    EXPECT_TRUE(io::ReadPointCloud("tmp_binary.ply", pcd_binary));
+    EXPECT_TRUE(io::ReadPointCloud("tmp_ascii.ply", pcd_ascii));
+    ExpectEQ(pcd_gt.points_, pcd_binary.points_, /*threshold*/ 1e-4);
+    ExpectEQ(pcd_gt.normals_, pcd_binary.normals_, /*threshold*/ 1e-6);
+    ExpectEQ(pcd_gt.colors_, pcd_binary.colors_, /*threshold*/ 1.0 / 255.0);
+    ExpectEQ(pcd_ascii.points_, pcd_binary.points_, /*threshold*/ 1e-4);
+    ExpectEQ(pcd_ascii.normals_, pcd_binary.normals_, /*threshold*/ 1e-6);
+    ExpectEQ(pcd_ascii.colors_, pcd_binary.colors_, /*threshold*/ 1e-12);
+    std::remove("tmp_binary.ply");
+    std::remove("tmp_ascii.ply");
+}
 
 TEST(FilePLY, DISABLED_WritePointCloudToPLY) { unit_test::NotImplemented(); }
 
-TEST(FilePLY, DISABLED_ReadTriangleMeshFromPLY) { unit_test::NotImplemented(); }
+TEST(FilePLY, ReadTriangleMeshFromPLY) {
+    geometry::TriangleMesh mesh_gt;
+    mesh_gt.vertices_.resize(10000);
+    mesh_gt.vertex_normals_.resize(10000);
+    mesh_gt.triangles_.resize(20000);
+    Rand(mesh_gt.vertices_, Eigen::Vector3d(-100, -100, -100),
+         Eigen::Vector3d(100, 100, 100), 0);
+    Rand(mesh_gt.vertex_normals_, Eigen::Vector3d(-1, -1, -1),
+         Eigen::Vector3d(1, 1, 1), 1);
+    Rand(mesh_gt.triangles_, Eigen::Vector3i(0, 0, 0),
+         Eigen::Vector3i(9999, 9999, 9999), 2);
+
+    EXPECT_TRUE(io::WriteTriangleMesh("tmp_binary.ply", mesh_gt, false));
+    EXPECT_TRUE(io::WriteTriangleMesh("tmp_ascii.ply", mesh_gt, true));
+    geometry::TriangleMesh mesh_binary;
+    geometry::TriangleMesh mesh_ascii;
+    EXPECT_TRUE(io::ReadTriangleMesh("tmp_binary.ply", mesh_binary));
+    EXPECT_TRUE(io::ReadTriangleMesh("tmp_ascii.ply", mesh_ascii));
+    ExpectEQ(mesh_gt.vertices_, mesh_binary.vertices_, /*threshold*/ 1e-12);
+    ExpectEQ(mesh_gt.vertex_normals_, mesh_binary.vertex_normals_,
+             /*threshold*/ 1e-12);
+    ExpectEQ(mesh_gt.triangles_, mesh_binary.triangles_);
+    EXPECT_FALSE(mesh_binary.HasVertexColors());
+    ExpectEQ(mesh_ascii.vertices_, mesh_binary.vertices_, /*threshold*/ 1e-4);
+    ExpectEQ(mesh_ascii.triangles_, mesh_binary.triangles_);
+    std::remove("tmp_binary.ply");
+    std::remove("tmp_ascii.ply");
+}
+
+TEST(FilePLY, ReadTriangleMeshFromPLYWithPolygons) {
+    // Binary files with non-triangle faces fall back to rply, which splits
+    // the polygons into triangles.
+    const char header[] =
+            "ply\n"
+            "format binary_little_endian 1.0\n"
+            "element vertex 4\n"
+            "property float x\n"
+            "property float y\n"
+            "property float z\n"
+            "element face 1\n"
+            "property list uchar int vertex_indices\n"
+            "end_header\n";
+    const float vertices[12] = {0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0};
+    const unsigned char length = 4;
+    const int indices[4] = {0, 1, 2, 3};
+    FILE *file = fopen("tmp_polygon.ply", "wb");
+    ASSERT_NE(file, nullptr);
+    fwrite(header, 1, sizeof(header) - 1, file);
+    fwrite(vertices, sizeof(float), 12, file);
+    fwrite(&length, 1, 1, file);
+    fwrite(indices, sizeof(int), 4, file);
+    fclose(file);
+
+    geometry::TriangleMesh mesh;
+    EXPECT_TRUE(io::ReadTriangleMesh("tmp_polygon.ply", mesh));
+    EXPECT_EQ(mesh.vertices_.size(), 4u);
+    EXPECT_EQ(mesh.triangles_.size(), 2u);
+    std::remove("tmp_polygon.ply");
+}
 
 TEST(FilePLY, DISABLED_WriteTriangleMeshToPLY) { unit_test::NotImplemented(); }
 
@@ -24,9 +24,57 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <cstdio>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
 #include "TestUtility/UnitTest.h"
 
-TEST(FilePTS, DISABLED_ReadPointCloudFromPTS) { unit_test::NotImplemented(); }
+using namespace open3d;
+using namespace unit_test;
+
+TEST(FilePTS, ReadPointCloudFromPTS) {
+    FILE *file = fopen("tmp.pts", "w");
+    // Lines after the number of points in the header are ignored.
+    fprintf(file,
+            "3\r\n"
+            "1 2 3 0 255 0 51\r\n"
+            "4 5 6 -10 0 255 102\r\n"
+            "7 8 9 0 0 0 0\r\n"
+            "10 11 12 0 0 0 0\r\n");
+    fclose(file);
+
+    geometry::PointCloud pcd;
+    EXPECT_TRUE(io::ReadPointCloud("tmp.pts", pcd));
+    ExpectEQ(pcd.points_,
+             std::vector<Eigen::Vector3d>({{1, 2, 3}, {4, 5, 6}, {7, 8, 9}}));
+    ExpectEQ(pcd.colors_, std::vector<Eigen::Vector3d>(
+                                  {{1, 0, 0.2}, {0, 1, 0.4}, {0, 0, 0}}));
+
+    // Lines that fail to parse are read as points at the origin.
+    file = fopen("tmp.pts", "w");
+    fprintf(file, "3\n1 2 3\nbad line\n4 5 6\n");
+    fclose(file);
+    pcd.Clear();
+    EXPECT_TRUE(io::ReadPointCloud("tmp.pts", pcd));
+    ExpectEQ(pcd.points_,
+             std::vector<Eigen::Vector3d>({{1, 2, 3}, {0, 0, 0}, {4, 5, 6}}));
+    EXPECT_FALSE(pcd.HasColors());
+
+    file = fopen("tmp.pts", "w");
+    fprintf(file, "3\n1 2 3 0 255 0 51\n4 5 6\n7 8 9 0 0 255 102\n");
+    fclose(file);
+    EXPECT_TRUE(io::ReadPointCloud("tmp.pts", pcd));
+    ExpectEQ(pcd.points_,
+             std::vector<Eigen::Vector3d>({{1, 2, 3}, {0, 0, 0}, {7, 8, 9}}));
+    ExpectEQ(pcd.colors_, std::vector<Eigen::Vector3d>(
+                                  {{1, 0, 0.2}, {0, 0, 0}, {0, 1, 0.4}}));
+
+    file = fopen("tmp.pts", "w");
+    fprintf(file, "2\n1 2\n3 4\n");
+    fclose(file);
+    EXPECT_FALSE(io::ReadPointCloud("tmp.pts", pcd));
+}
 
 TEST(FilePTS, DISABLED_ResetConsoleProgress) { unit_test::NotImplemented(); }
 
@@ -34,4 +82,26 @@ TEST(FilePTS, DISABLED_SplitString) { unit_test::NotImplemented(); }
 
 TEST(FilePTS, DISABLED_AdvanceConsoleProgress) { unit_test::NotImplemented(); }
 
-TEST(FilePTS, DISABLED_WritePointCloudToPTS) { unit_test::NotImplemented(); }
+TEST(FilePTS, WriteReadPointCloudFromPTS) {
+    geometry::PointCloud pcd_gt;
+    pcd_gt.points_.resize(100000);
+    Rand(pcd_gt.points_, Eigen::Vector3d(-100, -100, -100),
+         Eigen::Vector3d(100, 100, 100), 0);
+
+    EXPECT_TRUE(io::WritePointCloud("tmp.pts", pcd_gt));
+    geometry::PointCloud pcd_test;
+    EXPECT_TRUE(io::ReadPointCloud("tmp.pts", pcd_test));
+    ExpectEQ(pcd_gt.points_, pcd_test.points_, /*threshold*/ 1e-10);
+    EXPECT_FALSE(pcd_test.HasColors());
+
+    // Colors are written as integers in [0, 255].
+    pcd_gt.colors_.resize(pcd_gt.points_.size());
+    for (size_t i = 0; i < pcd_gt.colors_.size(); i++) {
+        pcd_gt.colors_[i] = Eigen::Vector3d(i % 256, (i / 256) % 256, 0) /
+                            255.0;
+    }
+    EXPECT_TRUE(io::WritePointCloud("tmp.pts", pcd_gt));
+    EXPECT_TRUE(io::ReadPointCloud("tmp.pts", pcd_test));
+    ExpectEQ(pcd_gt.points_, pcd_test.points_, /*threshold*/ 1e-10);
+    ExpectEQ(pcd_gt.colors_, pcd_test.colors_, /*threshold*/ 1e-10);
+}
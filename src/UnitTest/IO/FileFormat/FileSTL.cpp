@@ -24,6 +24,8 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <cstdio>
+
 #include "Open3D/Geometry/TriangleMesh.h"
 #include "Open3D/IO/ClassIO/TriangleMeshIO.h"
 #include "TestUtility/UnitTest.h"
@@ -45,3 +47,33 @@ TEST(FileSTL, WriteReadTriangleMeshFromSTL) {
     ExpectEQ(tm_gt.vertices_, tm_test.vertices_);
     ExpectEQ(tm_gt.triangles_, tm_test.triangles_);
 }
+
+TEST(FileSTL, ReadTriangleMeshWeldsVertices) {
+    auto tm_gt = geometry::TriangleMesh::CreateSphere(1.0, 40);
+    tm_gt->ComputeTriangleNormals();
+    io::WriteTriangleMesh("tmp.stl", *tm_gt);
+
+    // Every vertex is written once per triangle and shared again on reading.
+    geometry::TriangleMesh tm_test;
+    EXPECT_TRUE(io::ReadTriangleMesh("tmp.stl", tm_test, false));
+    EXPECT_EQ(tm_test.vertices_.size(), tm_gt->vertices_.size());
+    ASSERT_EQ(tm_test.triangles_.size(), tm_gt->triangles_.size());
+    for (size_t i = 0; i < tm_gt->triangles_.size(); i++) {
+        for (int j = 0; j < 3; j++) {
+            ExpectEQ(tm_test.vertices_[tm_test.triangles_[i](j)],
+                     tm_gt->vertices_[tm_gt->triangles_[i](j)], 1e-6);
+        }
+        ExpectEQ(tm_test.triangle_normals_[i], tm_gt->triangle_normals_[i],
+                 1e-6);
+    }
+
+    // Files with fewer records than announced are rejected.
+    FILE *file = fopen("tmp.stl", "r+b");
+    ASSERT_NE(file, nullptr);
+    const uint32_t num_triangles = (uint32_t)tm_gt->triangles_.size() + 1;
+    fseek(file, 80, SEEK_SET);
+    fwrite(&num_triangles, sizeof(num_triangles), 1, file);
+    fclose(file);
+    EXPECT_FALSE(io::ReadTriangleMesh("tmp.stl", tm_test, false));
+    std::remove("tmp.stl");
+}
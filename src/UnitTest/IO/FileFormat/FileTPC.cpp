@@ -0,0 +1,215 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <numeric>
+#include <vector>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
+#include "TestUtility/RandomPointCloud.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+using namespace unit_test;
+
+namespace {
+
+// The tiling reorders the points. Every point gets a distinct color, which
+// is stored exactly, so that the points can be matched after sorting.
+geometry::PointCloud CreateTestPointCloud(size_t size) {
+    geometry::PointCloud pcd = CreateRandomPointCloud(size);
+    for (size_t i = 0; i < size; i++) {
+        pcd.colors_[i] = Eigen::Vector3d(i & 255, (i >> 8) & 255,
+                                         (i >> 16) & 255) /
+                         255.0;
+    }
+    return pcd;
+}
+
+std::vector<size_t> SortByColor(const geometry::PointCloud &pcd) {
+    std::vector<size_t> order(pcd.points_.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&pcd](size_t i0, size_t i1) {
+        const Eigen::Vector3d &c0 = pcd.colors_[i0];
+        const Eigen::Vector3d &c1 = pcd.colors_[i1];
+        return std::lexicographical_compare(c0.data(), c0.data() + 3,
+                                            c1.data(), c1.data() + 3);
+    });
+    return order;
+}
+
+void ExpectSamePoints(const geometry::PointCloud &pcd_gt,
+                      const geometry::PointCloud &pcd_test,
+                      double threshold) {
+    ASSERT_EQ(pcd_gt.points_.size(), pcd_test.points_.size());
+    EXPECT_EQ(pcd_gt.HasNormals(), pcd_test.HasNormals());
+    ASSERT_TRUE(pcd_gt.HasColors());
+    ASSERT_TRUE(pcd_test.HasColors());
+    const std::vector<size_t> order_gt = SortByColor(pcd_gt);
+    const std::vector<size_t> order_test = SortByColor(pcd_test);
+    for (size_t i = 0; i < order_gt.size(); i++) {
+        const size_t i_gt = order_gt[i];
+        const size_t i_test = order_test[i];
+        ExpectEQ(pcd_gt.colors_[i_gt], pcd_test.colors_[i_test], 0.0);
+        EXPECT_LE((pcd_gt.points_[i_gt] - pcd_test.points_[i_test]).norm(),
+                  threshold);
+        if (pcd_test.HasNormals()) {
+            ExpectEQ(pcd_gt.normals_[i_gt], pcd_test.normals_[i_test], 1e-6);
+        }
+    }
+}
+
+// Writes \p data with \p value stored at \p offset to \p filename.
+template <typename T>
+void WriteCorruptFile(const std::string &filename,
+                      std::vector<char> data,
+                      size_t offset,
+                      T value) {
+    memcpy(data.data() + offset, &value, sizeof(T));
+    std::ofstream file(filename, std::ios::binary);
+    file.write(data.data(), data.size());
+}
+
+}  // unnamed namespace
+
+TEST(FileTPC, WriteReadPointCloud) {
+    geometry::PointCloud pcd_gt = CreateTestPointCloud(100000);
+    io::TiledPointCloudOption option;
+    option.max_points_per_tile_ = 5000;
+    EXPECT_TRUE(io::WritePointCloudToTPCWithOption("tmp.tpc", pcd_gt, option));
+    geometry::PointCloud pcd_test;
+    EXPECT_TRUE(io::ReadPointCloud("tmp.tpc", pcd_test));
+    ExpectSamePoints(pcd_gt, pcd_test, 1e-4);
+    std::remove("tmp.tpc");
+}
+
+TEST(FileTPC, WriteReadQuantizedPointCloud) {
+    geometry::PointCloud pcd_gt = CreateTestPointCloud(100000);
+    pcd_gt.normals_.clear();
+    io::TiledPointCloudOption option;
+    option.quantization_step_ = 0.001;
+    EXPECT_TRUE(io::WritePointCloudToTPCWithOption("tmp.tpc", pcd_gt, option));
+    geometry::PointCloud pcd_test;
+    EXPECT_TRUE(io::ReadPointCloud("tmp.tpc", pcd_test));
+    ExpectSamePoints(pcd_gt, pcd_test, 0.001 * std::sqrt(3.0) / 2 + 1e-9);
+    std::remove("tmp.tpc");
+}
+
+TEST(FileTPC, ReadPointCloudInBoundingBox) {
+    geometry::PointCloud pcd_gt = CreateTestPointCloud(100000);
+    io::TiledPointCloudOption option;
+    option.max_points_per_tile_ = 2000;
+    EXPECT_TRUE(io::WritePointCloudToTPCWithOption("tmp.tpc", pcd_gt, option));
+    geometry::PointCloud pcd_full;
+    EXPECT_TRUE(io::ReadPointCloud("tmp.tpc", pcd_full));
+
+    geometry::AxisAlignedBoundingBox bbox(Eigen::Vector3d(-30, 10, -100),
+                                          Eigen::Vector3d(20, 60, 0));
+    geometry::PointCloud pcd_region;
+    EXPECT_TRUE(io::ReadPointCloud("tmp.tpc", pcd_region, bbox));
+    auto pcd_cropped = pcd_full.Crop(bbox);
+    EXPECT_GT(pcd_region.points_.size(), 0u);
+    ExpectSamePoints(*pcd_cropped, pcd_region, 0.0);
+
+    // Other formats are read completely and cropped.
+    EXPECT_TRUE(io::WritePointCloud("tmp.ply", pcd_full));
+    EXPECT_TRUE(io::ReadPointCloud("tmp.ply", pcd_region, bbox));
+    EXPECT_EQ(pcd_region.points_.size(), pcd_cropped->points_.size());
+    std::remove("tmp.tpc");
+    std::remove("tmp.ply");
+}
+
+TEST(FileTPC, ReadPointCloudLevelOfDetail) {
+    geometry::PointCloud pcd_gt = CreateTestPointCloud(100000);
+    io::TiledPointCloudOption option;
+    option.max_points_per_tile_ = 10000;
+    option.num_levels_ = 3;
+    EXPECT_TRUE(io::WritePointCloudToTPCWithOption("tmp.tpc", pcd_gt, option));
+    geometry::AxisAlignedBoundingBox bbox(Eigen::Vector3d(-101, -101, -101),
+                                          Eigen::Vector3d(101, 101, 101));
+    size_t previous_size = 0;
+    for (int level = 0; level < 3; level++) {
+        geometry::PointCloud pcd_level;
+        EXPECT_TRUE(io::ReadPointCloud("tmp.tpc", pcd_level, bbox, level));
+        EXPECT_GT(pcd_level.points_.size(), previous_size);
+        previous_size = pcd_level.points_.size();
+        if (level == 0) {
+            // Level 0 holds about 1 / 16 of the points of every tile and
+            // covers the whole cloud.
+            EXPECT_NEAR(pcd_level.points_.size(), 100000 / 16, 100);
+            Eigen::Vector3d extent =
+                    pcd_level.GetMaxBound() - pcd_level.GetMinBound();
+            Eigen::Vector3d extent_gt =
+                    pcd_gt.GetMaxBound() - pcd_gt.GetMinBound();
+            ExpectGE(extent, Eigen::Vector3d(0.95 * extent_gt));
+        }
+    }
+    EXPECT_EQ(previous_size, pcd_gt.points_.size());
+    std::remove("tmp.tpc");
+}
+
+TEST(FileTPC, ReadCorruptIndex) {
+    geometry::PointCloud pcd_gt = CreateTestPointCloud(1000);
+    EXPECT_TRUE(io::WritePointCloud("tmp.tpc", pcd_gt));
+    std::ifstream file("tmp.tpc", std::ios::binary);
+    const std::vector<char> data((std::istreambuf_iterator<char>(file)),
+                                 std::istreambuf_iterator<char>());
+    file.close();
+    const size_t footer_offset = data.size() - 16;
+    std::uint64_t index_offset;
+    memcpy(&index_offset, data.data() + footer_offset, sizeof(index_offset));
+    const size_t chunk_offset = index_offset + 24 + 9 * sizeof(double);
+
+    geometry::PointCloud pcd_test;
+    // Index offsets for which the end of the index header wraps around.
+    for (std::uint64_t offset : {~std::uint64_t(0), ~std::uint64_t(0) - 7}) {
+        WriteCorruptFile("tmp_corrupt.tpc", data, footer_offset, offset);
+        EXPECT_FALSE(io::ReadPointCloud("tmp_corrupt.tpc", pcd_test));
+    }
+    // 2^28 levels, for which 16 bytes per level wrap around in 32 bits.
+    for (std::uint32_t num_levels : {0u, 33u, 1u << 28, ~0u}) {
+        WriteCorruptFile("tmp_corrupt.tpc", data, index_offset + 4,
+                         num_levels);
+        EXPECT_FALSE(io::ReadPointCloud("tmp_corrupt.tpc", pcd_test));
+    }
+    // Chunk offsets for which the end of the chunk wraps around.
+    for (std::uint64_t offset : {~std::uint64_t(0), ~std::uint64_t(0) - 7,
+                                 std::uint64_t(index_offset) + 1}) {
+        WriteCorruptFile("tmp_corrupt.tpc", data, chunk_offset, offset);
+        EXPECT_FALSE(io::ReadPointCloud("tmp_corrupt.tpc", pcd_test));
+    }
+    // The unmodified data is read.
+    WriteCorruptFile("tmp_corrupt.tpc", data, 0, data[0]);
+    EXPECT_TRUE(io::ReadPointCloud("tmp_corrupt.tpc", pcd_test));
+    EXPECT_EQ(pcd_test.points_.size(), pcd_gt.points_.size());
+    std::remove("tmp.tpc");
+    std::remove("tmp_corrupt.tpc");
+}
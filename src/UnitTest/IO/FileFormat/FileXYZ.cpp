@@ -24,8 +24,46 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <cstdio>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
 #include "TestUtility/UnitTest.h"
 
-TEST(FileXYZ, DISABLED_ReadPointCloudFromXYZ) { unit_test::NotImplemented(); }
+using namespace open3d;
+using namespace unit_test;
+
+TEST(FileXYZ, ReadPointCloudFromXYZ) {
+    FILE *file = fopen("tmp.xyz", "w");
+    fprintf(file,
+            "1 2 3\n"
+            "\n"
+            "# comment\n"
+            "-1.5e-3 +2.25 .5\r\n"
+            "  4.0\t5.0 6.0 7.0\n"
+            "1 2\n"
+            "1e2 -0 3.000000000000000000001");
+    fclose(file);
+
+    geometry::PointCloud pcd;
+    EXPECT_TRUE(io::ReadPointCloud("tmp.xyz", pcd));
+    ExpectEQ(pcd.points_, std::vector<Eigen::Vector3d>({{1, 2, 3},
+                                                        {-1.5e-3, 2.25, 0.5},
+                                                        {4, 5, 6},
+                                                        {100, 0, 3}}));
+
+    EXPECT_FALSE(io::ReadPointCloud("does_not_exist.xyz", pcd));
+}
+
+TEST(FileXYZ, WriteReadPointCloudFromXYZ) {
+    geometry::PointCloud pcd_gt;
+    // More than one block of lines for the parallel reader and writer.
+    pcd_gt.points_.resize(100000);
+    Rand(pcd_gt.points_, Eigen::Vector3d(-100, -100, -100),
+         Eigen::Vector3d(100, 100, 100), 0);
 
-TEST(FileXYZ, DISABLED_WritePointCloudToXYZ) { unit_test::NotImplemented(); }
+    EXPECT_TRUE(io::WritePointCloud("tmp.xyz", pcd_gt));
+    geometry::PointCloud pcd_test;
+    EXPECT_TRUE(io::ReadPointCloud("tmp.xyz", pcd_test));
+    ExpectEQ(pcd_gt.points_, pcd_test.points_, /*threshold*/ 1e-10);
+}
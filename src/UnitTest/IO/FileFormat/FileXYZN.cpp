@@ -24,8 +24,25 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
 #include "TestUtility/UnitTest.h"
 
-TEST(FileXYZN, DISABLED_ReadPointCloudFromXYZN) { unit_test::NotImplemented(); }
+using namespace open3d;
+using namespace unit_test;
 
-TEST(FileXYZN, DISABLED_WritePointCloudToXYZN) { unit_test::NotImplemented(); }
\ No newline at end of file
+TEST(FileXYZN, WriteReadPointCloudFromXYZN) {
+    geometry::PointCloud pcd_gt;
+    pcd_gt.points_.resize(100000);
+    pcd_gt.normals_.resize(100000);
+    Rand(pcd_gt.points_, Eigen::Vector3d(-100, -100, -100),
+         Eigen::Vector3d(100, 100, 100), 0);
+    Rand(pcd_gt.normals_, Eigen::Vector3d(-1, -1, -1),
+         Eigen::Vector3d(1, 1, 1), 1);
+
+    EXPECT_TRUE(io::WritePointCloud("tmp.xyzn", pcd_gt));
+    geometry::PointCloud pcd_test;
+    EXPECT_TRUE(io::ReadPointCloud("tmp.xyzn", pcd_test));
+    ExpectEQ(pcd_gt.points_, pcd_test.points_, /*threshold*/ 1e-10);
+    ExpectEQ(pcd_gt.normals_, pcd_test.normals_, /*threshold*/ 1e-10);
+}
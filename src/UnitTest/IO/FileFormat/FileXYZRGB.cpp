@@ -24,12 +24,25 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
 #include "TestUtility/UnitTest.h"
 
-TEST(FileXYZRGB, DISABLED_ReadPointCloudFromXYZRGB) {
-    unit_test::NotImplemented();
-}
+using namespace open3d;
+using namespace unit_test;
+
+TEST(FileXYZRGB, WriteReadPointCloudFromXYZRGB) {
+    geometry::PointCloud pcd_gt;
+    pcd_gt.points_.resize(100000);
+    pcd_gt.colors_.resize(100000);
+    Rand(pcd_gt.points_, Eigen::Vector3d(-100, -100, -100),
+         Eigen::Vector3d(100, 100, 100), 0);
+    Rand(pcd_gt.colors_, Eigen::Vector3d(0, 0, 0), Eigen::Vector3d(1, 1, 1),
+         1);
 
-TEST(FileXYZRGB, DISABLED_WritePointCloudToXYZRGB) {
-    unit_test::NotImplemented();
-}
\ No newline at end of file
+    EXPECT_TRUE(io::WritePointCloud("tmp.xyzrgb", pcd_gt));
+    geometry::PointCloud pcd_test;
+    EXPECT_TRUE(io::ReadPointCloud("tmp.xyzrgb", pcd_test));
+    ExpectEQ(pcd_gt.points_, pcd_test.points_, /*threshold*/ 1e-10);
+    ExpectEQ(pcd_gt.colors_, pcd_test.colors_, /*threshold*/ 1e-10);
+}
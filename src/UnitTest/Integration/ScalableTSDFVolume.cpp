@@ -24,8 +24,21 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "Open3D/Integration/ScalableTSDFVolume.h"
+#include "Open3D/Camera/PinholeCameraIntrinsic.h"
+#include "Open3D/Camera/PinholeCameraTrajectory.h"
+#include "Open3D/Geometry/RGBDImage.h"
+#include "Open3D/IO/ClassIO/ImageIO.h"
+#include "Open3D/IO/ClassIO/PinholeCameraTrajectoryIO.h"
+#include "TestUtility/SyntheticRGBD.h"
 #include "TestUtility/UnitTest.h"
 
+#include <iomanip>
+#include <sstream>
+
+using namespace open3d;
+using namespace unit_test;
+
 TEST(ScalableTSDFVolume, DISABLED_VolumeUnit) { unit_test::NotImplemented(); }
 
 TEST(ScalableTSDFVolume, DISABLED_Constructor) { unit_test::NotImplemented(); }
@@ -36,14 +49,151 @@ TEST(ScalableTSDFVolume, DISABLED_MemberData) { unit_test::NotImplemented(); }
 
 TEST(ScalableTSDFVolume, DISABLED_Reset) { unit_test::NotImplemented(); }
 
-TEST(ScalableTSDFVolume, DISABLED_Integrate) { unit_test::NotImplemented(); }
+TEST(ScalableTSDFVolume, RealData) {
+    // Camera
+    camera::PinholeCameraTrajectory trajectory;
+    io::ReadPinholeCameraTrajectory(
+            std::string(TEST_DATA_DIR) + "/RGBD/odometry.log", trajectory);
+    EXPECT_EQ(trajectory.parameters_.size(), 5u);
+    camera::PinholeCameraIntrinsic intrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
 
-TEST(ScalableTSDFVolume, DISABLED_ExtractPointCloud) {
-    unit_test::NotImplemented();
+    // TSDF init
+    integration::ScalableTSDFVolume tsdf_volume(
+            4.0 / 512.0, 0.04, integration::TSDFVolumeColorType::RGB8);
+
+    // Integrate RGBD frames
+    for (size_t i = 0; i < trajectory.parameters_.size(); ++i) {
+        geometry::Image im_color;
+        std::ostringstream im_color_path;
+        im_color_path << TEST_DATA_DIR << "/RGBD/color/" << std::setfill('0')
+                      << std::setw(5) << i << ".jpg";
+        io::ReadImage(im_color_path.str(), im_color);
+
+        geometry::Image im_depth;
+        std::ostringstream im_depth_path;
+        im_depth_path << TEST_DATA_DIR << "/RGBD/depth/" << std::setfill('0')
+                      << std::setw(5) << i << ".png";
+        io::ReadImage(im_depth_path.str(), im_depth);
+
+        std::shared_ptr<geometry::RGBDImage> im_rgbd =
+                geometry::RGBDImage::CreateFromColorAndDepth(
+                        im_color, im_depth, /*depth_scale*/ 1000.0,
+                        /*depth_func*/ 4.0, /*convert_rgb_to_intensity*/ false);
+        tsdf_volume.Integrate(*im_rgbd, intrinsic,
+                              trajectory.parameters_[i].extrinsic_);
+    }
+    EXPECT_EQ(tsdf_volume.volume_units_.size(), 1141u);
+
+    // These hard-coded values are for unit test only. The volume units are
+    // integrated in parallel, the results must not depend on the number of
+    // threads or the order in which the units are processed.
+
+    // Extract mesh
+    std::shared_ptr<geometry::TriangleMesh> mesh =
+            tsdf_volume.ExtractTriangleMesh();
+    EXPECT_EQ(mesh->vertices_.size(), 146747u);
+    EXPECT_EQ(mesh->triangles_.size(), 279171u);
+    Eigen::Vector3d color_sum(0, 0, 0);
+    for (const Eigen::Vector3d &color : mesh->vertex_colors_) {
+        color_sum += color;
+    }
+    ExpectEQ(color_sum, Eigen::Vector3d(123556.801, 114682.545, 109871.592),
+             /*threshold*/ 0.1);
+
+    // Extract point cloud
+    std::shared_ptr<geometry::PointCloud> pcd = tsdf_volume.ExtractPointCloud();
+    EXPECT_EQ(pcd->points_.size(), 140018u);
+    Eigen::Vector3d normal_sum(0, 0, 0);
+    for (const Eigen::Vector3d &normal : pcd->normals_) {
+        normal_sum += normal;
+    }
+    ExpectEQ(normal_sum,
+             Eigen::Vector3d(460.570578, -38747.697550, -70866.112550),
+             /*threshold*/ 0.1);
 }
 
-TEST(ScalableTSDFVolume, DISABLED_ExtractTriangleMesh) {
-    unit_test::NotImplemented();
+TEST(ScalableTSDFVolume, IncrementalExtractTriangleMesh) {
+    camera::PinholeCameraTrajectory trajectory;
+    io::ReadPinholeCameraTrajectory(
+            std::string(TEST_DATA_DIR) + "/RGBD/odometry.log", trajectory);
+    camera::PinholeCameraIntrinsic intrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+
+    integration::ScalableTSDFVolume tsdf_volume(
+            4.0 / 512.0, 0.04, integration::TSDFVolumeColorType::RGB8);
+    std::shared_ptr<geometry::TriangleMesh> mesh;
+    for (size_t i = 0; i < trajectory.parameters_.size(); ++i) {
+        geometry::Image im_color;
+        std::ostringstream im_color_path;
+        im_color_path << TEST_DATA_DIR << "/RGBD/color/" << std::setfill('0')
+                      << std::setw(5) << i << ".jpg";
+        io::ReadImage(im_color_path.str(), im_color);
+
+        geometry::Image im_depth;
+        std::ostringstream im_depth_path;
+        im_depth_path << TEST_DATA_DIR << "/RGBD/depth/" << std::setfill('0')
+                      << std::setw(5) << i << ".png";
+        io::ReadImage(im_depth_path.str(), im_depth);
+
+        std::shared_ptr<geometry::RGBDImage> im_rgbd =
+                geometry::RGBDImage::CreateFromColorAndDepth(
+                        im_color, im_depth, /*depth_scale*/ 1000.0,
+                        /*depth_func*/ 4.0, /*convert_rgb_to_intensity*/ false);
+        tsdf_volume.Integrate(*im_rgbd, intrinsic,
+                              trajectory.parameters_[i].extrinsic_);
+
+        // Only the units touched by this frame and their neighbors are
+        // re-meshed, the others are stitched from the cached fragments.
+        mesh = tsdf_volume.ExtractTriangleMesh();
+        for (const auto& unit : tsdf_volume.volume_units_) {
+            EXPECT_TRUE(unit.second.mesh_fragment_ != nullptr);
+        }
+    }
+
+    // Same values as RealData, where the mesh is extracted once.
+    EXPECT_EQ(mesh->vertices_.size(), 146747u);
+    EXPECT_EQ(mesh->triangles_.size(), 279171u);
+    Eigen::Vector3d color_sum(0, 0, 0);
+    for (const Eigen::Vector3d& color : mesh->vertex_colors_) {
+        color_sum += color;
+    }
+    ExpectEQ(color_sum, Eigen::Vector3d(123556.801, 114682.545, 109871.592),
+             /*threshold*/ 0.1);
+    EXPECT_EQ(mesh->GetNonManifoldEdges().size(), 0u);
+
+    // Extracting again without integration reuses all fragments.
+    std::shared_ptr<geometry::TriangleMesh> mesh_cached =
+            tsdf_volume.ExtractTriangleMesh();
+    ExpectEQ(mesh_cached->vertices_, mesh->vertices_);
+    ExpectEQ(mesh_cached->triangles_, mesh->triangles_);
+}
+
+TEST(ScalableTSDFVolume, RayCast) {
+    camera::PinholeCameraIntrinsic intrinsic(160, 120, 150.0, 150.0, 79.5,
+                                             59.5);
+    const Eigen::Vector3d center(0.05, -0.02, 1.2);
+    const double radius = 0.3;
+    const double voxel_length = 0.01;
+
+    // The sphere spans many volume units and is observed from three poses.
+    integration::ScalableTSDFVolume tsdf_volume(
+            voxel_length, 0.04, integration::TSDFVolumeColorType::RGB8,
+            /*volume_unit_resolution*/ 8);
+    for (double x : {-0.2, 0.0, 0.2}) {
+        Eigen::Matrix4d extrinsic = Eigen::Matrix4d::Identity();
+        extrinsic(0, 3) = -x;
+        tsdf_volume.Integrate(
+                *CreateSphereRGBDImage(intrinsic, extrinsic, center, radius),
+                intrinsic, extrinsic);
+    }
+
+    // Cast rays from a pose in between the integrated ones.
+    Eigen::Matrix4d extrinsic = Eigen::Matrix4d::Identity();
+    extrinsic.block<3, 1>(0, 3) = Eigen::Vector3d(-0.1, 0.05, 0.1);
+    ExpectRayCastOnSphere(tsdf_volume, intrinsic, extrinsic, center, radius,
+                          /*tolerance*/ 0.5 * voxel_length,
+                          /*min_coverage*/ 0.95);
 }
 
 TEST(ScalableTSDFVolume, DISABLED_ExtractVoxelPointCloud) {
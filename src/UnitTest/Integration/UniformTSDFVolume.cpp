@@ -30,6 +30,7 @@
 #include "Open3D/IO/ClassIO/ImageIO.h"
 #include "Open3D/Utility/FileSystem.h"
 #include "Open3D/Visualization/Utility/DrawGeometry.h"
+#include "TestUtility/SyntheticRGBD.h"
 #include "TestUtility/UnitTest.h"
 
 #include <sstream>
@@ -195,6 +196,151 @@ TEST(UniformTSDFVolume, RealData) {
              /*threshold*/ 0.1);
 }
 
+TEST(UniformTSDFVolume, CompactStorage) {
+    std::string test_data_dir = std::string(TEST_DATA_DIR);
+    std::vector<Eigen::Matrix4d> poses;
+    if (!ReadPoses(test_data_dir + "/RGBD/odometry.log", poses)) {
+        throw std::runtime_error("Cannot read trajectory file");
+    }
+    camera::PinholeCameraIntrinsic intrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+
+    for (auto storage_type : {integration::TSDFVoxelStorageType::Float16,
+                              integration::TSDFVoxelStorageType::Int16}) {
+        integration::UniformTSDFVolume tsdf_volume(
+                4.0, 100, 0.04, integration::TSDFVolumeColorType::RGB8,
+                Eigen::Vector3d::Zero(), storage_type);
+        EXPECT_EQ(tsdf_volume.storage_type_, storage_type);
+        EXPECT_EQ(tsdf_volume.voxels_.size(), 0u);
+        EXPECT_EQ(int(tsdf_volume.weight_uint16_.size()),
+                  tsdf_volume.voxel_num_);
+        EXPECT_EQ(int(tsdf_volume.color_uint8_.size()),
+                  tsdf_volume.voxel_num_ * 3);
+
+        for (size_t i = 0; i < poses.size(); ++i) {
+            geometry::Image im_color;
+            std::ostringstream im_color_path;
+            im_color_path << TEST_DATA_DIR << "/RGBD/color/"
+                          << std::setfill('0') << std::setw(5) << i << ".jpg";
+            io::ReadImage(im_color_path.str(), im_color);
+
+            geometry::Image im_depth;
+            std::ostringstream im_depth_path;
+            im_depth_path << TEST_DATA_DIR << "/RGBD/depth/"
+                          << std::setfill('0') << std::setw(5) << i << ".png";
+            io::ReadImage(im_depth_path.str(), im_depth);
+
+            std::shared_ptr<geometry::RGBDImage> im_rgbd =
+                    geometry::RGBDImage::CreateFromColorAndDepth(
+                            im_color, im_depth, /*depth_scale*/ 1000.0,
+                            /*depth_func*/ 4.0,
+                            /*convert_rgb_to_intensity*/ false);
+            tsdf_volume.Integrate(*im_rgbd, intrinsic, poses[i].inverse());
+        }
+
+        // The quantized volumes produce the same surface as the full
+        // precision volume in RealData, the colors differ by the dithered
+        // uint8 rounding of the running averages.
+        std::shared_ptr<geometry::TriangleMesh> mesh =
+                tsdf_volume.ExtractTriangleMesh();
+        EXPECT_EQ(mesh->vertices_.size(), 3198u);
+        EXPECT_EQ(mesh->triangles_.size(), 4402u);
+        Eigen::Vector3d color_sum(0, 0, 0);
+        for (const Eigen::Vector3d &color : mesh->vertex_colors_) {
+            color_sum += color;
+        }
+        ExpectEQ(color_sum,
+                 Eigen::Vector3d(2703.951001, 2561.437740, 2481.651022),
+                 /*threshold*/ 0.1);
+
+        std::shared_ptr<geometry::PointCloud> pcd =
+                tsdf_volume.ExtractPointCloud();
+        EXPECT_EQ(pcd->points_.size(), 2227u);
+        Eigen::Vector3d normal_sum(0, 0, 0);
+        for (const Eigen::Vector3d &normal : pcd->normals_) {
+            normal_sum += normal;
+        }
+        ExpectEQ(normal_sum,
+                 Eigen::Vector3d(-161.569098, -95.969433, -1783.167177),
+                 /*threshold*/ 0.1);
+    }
+}
+
+TEST(UniformTSDFVolume, CompactStorageColorChange) {
+    camera::PinholeCameraIntrinsic intrinsic(80, 60, 75.0, 75.0, 39.5, 29.5);
+    const Eigen::Matrix4d extrinsic = Eigen::Matrix4d::Identity();
+    std::shared_ptr<geometry::RGBDImage> rgbd = CreateSphereRGBDImage(
+            intrinsic, extrinsic, Eigen::Vector3d(0.0, 0.0, 1.2), 0.3);
+
+    integration::UniformTSDFVolume reference(
+            1.28, 64, 0.04, integration::TSDFVolumeColorType::RGB8,
+            Eigen::Vector3d(-0.64, -0.64, 0.56));
+    integration::UniformTSDFVolume compact(
+            1.28, 64, 0.04, integration::TSDFVolumeColorType::RGB8,
+            Eigen::Vector3d(-0.64, -0.64, 0.56),
+            integration::TSDFVoxelStorageType::Int16);
+    // Many frames of one color followed by a change of 30 levels, which a
+    // rounded uint8 running average of weight 100 never absorbs.
+    for (int i = 0; i < 300; i++) {
+        std::fill(rgbd->color_.data_.begin(), rgbd->color_.data_.end(),
+                  i < 100 ? 100 : 130);
+        reference.Integrate(*rgbd, intrinsic, extrinsic);
+        compact.Integrate(*rgbd, intrinsic, extrinsic);
+    }
+
+    int num_voxels = 0;
+    double error_sum = 0.0;
+    double squared_error_sum = 0.0;
+    for (int i = 0; i < compact.voxel_num_; i++) {
+        if (compact.GetWeight(i) == 0.0f) {
+            continue;
+        }
+        ASSERT_EQ(reference.GetWeight(i), compact.GetWeight(i));
+        const Eigen::Vector3d error =
+                compact.GetColor(i) - reference.GetColor(i);
+        error_sum += error.sum();
+        squared_error_sum += error.squaredNorm();
+        num_voxels++;
+    }
+    ASSERT_GT(num_voxels, 0);
+    // The dithered colors scatter around the full precision colors, without
+    // the bias of 20 levels of a frozen average.
+    EXPECT_NEAR(error_sum / (3 * num_voxels), 0.0, 0.5);
+    EXPECT_LT(std::sqrt(squared_error_sum / (3 * num_voxels)), 4.0);
+}
+
+TEST(UniformTSDFVolume, RayCast) {
+    camera::PinholeCameraIntrinsic intrinsic(160, 120, 150.0, 150.0, 79.5,
+                                             59.5);
+    const Eigen::Vector3d center(0.05, -0.02, 1.2);
+    const double radius = 0.3;
+    const double length = 1.28;
+    const int resolution = 128;
+    const double voxel_length = length / resolution;
+
+    for (auto storage_type : {integration::TSDFVoxelStorageType::Voxel,
+                              integration::TSDFVoxelStorageType::Float16,
+                              integration::TSDFVoxelStorageType::Int16}) {
+        integration::UniformTSDFVolume tsdf_volume(
+                length, resolution, 0.04,
+                integration::TSDFVolumeColorType::RGB8,
+                Eigen::Vector3d(-0.64, -0.64, 0.56), storage_type);
+        for (double x : {-0.2, 0.0, 0.2}) {
+            Eigen::Matrix4d extrinsic = Eigen::Matrix4d::Identity();
+            extrinsic(0, 3) = -x;
+            tsdf_volume.Integrate(*CreateSphereRGBDImage(intrinsic, extrinsic,
+                                                         center, radius),
+                                  intrinsic, extrinsic);
+        }
+
+        Eigen::Matrix4d extrinsic = Eigen::Matrix4d::Identity();
+        extrinsic.block<3, 1>(0, 3) = Eigen::Vector3d(-0.1, 0.05, 0.1);
+        ExpectRayCastOnSphere(tsdf_volume, intrinsic, extrinsic, center,
+                              radius, /*tolerance*/ 0.5 * voxel_length,
+                              /*min_coverage*/ 0.95);
+    }
+}
+
 TEST(UniformTSDFVolume, DISABLED_Destructor) {}
 
 TEST(UniformTSDFVolume, DISABLED_MemberData) {}
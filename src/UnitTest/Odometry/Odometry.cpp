@@ -24,10 +24,69 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "Open3D/Odometry/Odometry.h"
+#include "Open3D/Geometry/RGBDImage.h"
+#include "Open3D/IO/ClassIO/ImageIO.h"
 #include "TestUtility/UnitTest.h"
 
+#include <iomanip>
+#include <sstream>
+
+using namespace open3d;
+using namespace unit_test;
+
 TEST(Odometry, DISABLED_ComputeRGBDOdometry) { unit_test::NotImplemented(); }
 
+TEST(Odometry, RGBDOdometryTracker) {
+    camera::PinholeCameraIntrinsic intrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    std::vector<std::shared_ptr<geometry::RGBDImage>> frames;
+    for (int i = 0; i < 5; ++i) {
+        geometry::Image im_color;
+        std::ostringstream im_color_path;
+        im_color_path << TEST_DATA_DIR << "/RGBD/color/" << std::setfill('0')
+                      << std::setw(5) << i << ".jpg";
+        io::ReadImage(im_color_path.str(), im_color);
+
+        geometry::Image im_depth;
+        std::ostringstream im_depth_path;
+        im_depth_path << TEST_DATA_DIR << "/RGBD/depth/" << std::setfill('0')
+                      << std::setw(5) << i << ".png";
+        io::ReadImage(im_depth_path.str(), im_depth);
+
+        frames.push_back(geometry::RGBDImage::CreateFromColorAndDepth(
+                im_color, im_depth));
+    }
+
+    odometry::RGBDOdometryTracker tracker(intrinsic);
+    bool is_success;
+    Eigen::Matrix4d trans;
+    Eigen::Matrix6d info;
+    std::tie(is_success, trans, info) = tracker.Track(*frames[0]);
+    EXPECT_FALSE(is_success);
+    EXPECT_TRUE(tracker.HasPreviousFrame());
+
+    // Each frame is preprocessed once, with the same result as the pairwise
+    // odometry that preprocesses both frames.
+    for (size_t i = 1; i < frames.size(); ++i) {
+        std::tie(is_success, trans, info) = tracker.Track(*frames[i]);
+        bool is_success_ref;
+        Eigen::Matrix4d trans_ref;
+        Eigen::Matrix6d info_ref;
+        std::tie(is_success_ref, trans_ref, info_ref) =
+                odometry::ComputeRGBDOdometry(*frames[i - 1], *frames[i],
+                                              intrinsic);
+        EXPECT_TRUE(is_success_ref);
+        EXPECT_EQ(is_success, is_success_ref);
+        ExpectEQ(trans, trans_ref, /*threshold*/ 1e-6);
+        // The information matrix is summed in parallel.
+        EXPECT_LT((info - info_ref).norm(), 1e-6 * info_ref.norm());
+    }
+
+    tracker.Reset();
+    EXPECT_FALSE(tracker.HasPreviousFrame());
+}
+
 TEST(Odometry, DISABLED_PinholeCameraIntrinsic) { unit_test::NotImplemented(); }
 
 TEST(Odometry, DISABLED_RGBDOdometryJacobianFromHybridTerm) {
@@ -0,0 +1,59 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "UnitTest/TestUtility/RandomPointCloud.h"
+
+#include <random>
+
+namespace unit_test {
+
+open3d::geometry::PointCloud CreateRandomPointCloud(size_t size,
+                                                    unsigned int seed) {
+    // Rand() draws from a small table of values, which makes many points
+    // coincide. A seeded generator gives distinct and reproducible points.
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<double> position(-100.0, 100.0);
+    std::uniform_real_distribution<double> normal(-1.0, 1.0);
+    std::uniform_int_distribution<int> color(0, 255);
+    open3d::geometry::PointCloud pcd;
+    pcd.points_.resize(size);
+    pcd.normals_.resize(size);
+    pcd.colors_.resize(size);
+    for (size_t i = 0; i < size; i++) {
+        for (int j = 0; j < 3; j++) {
+            pcd.points_[i](j) = position(generator);
+        }
+        for (int j = 0; j < 3; j++) {
+            pcd.normals_[i](j) = normal(generator);
+        }
+        for (int j = 0; j < 3; j++) {
+            pcd.colors_[i](j) = color(generator) / 255.0;
+        }
+    }
+    return pcd;
+}
+
+}  // namespace unit_test
@@ -0,0 +1,158 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "UnitTest/TestUtility/SyntheticRGBD.h"
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <tuple>
+
+using namespace open3d;
+
+namespace unit_test {
+
+namespace {
+
+// Depth of the first intersection of the ray through pixel (u, v) with the
+// sphere, or 0 if the ray misses it.
+double SphereDepthAt(const camera::PinholeCameraIntrinsic &intrinsic,
+                     const Eigen::Matrix4d &pose,
+                     const Eigen::Vector3d &center,
+                     double radius,
+                     int u,
+                     int v) {
+    const Eigen::Vector3d origin = pose.block<3, 1>(0, 3);
+    const Eigen::Vector3d direction =
+            pose.block<3, 3>(0, 0) *
+            Eigen::Vector3d((u - intrinsic.GetPrincipalPoint().first) /
+                                    intrinsic.GetFocalLength().first,
+                            (v - intrinsic.GetPrincipalPoint().second) /
+                                    intrinsic.GetFocalLength().second,
+                            1.0);
+    // The camera space direction has unit z, so the ray parameter is the
+    // depth.
+    const Eigen::Vector3d oc = origin - center;
+    const double a = direction.squaredNorm();
+    const double b = 2.0 * direction.dot(oc);
+    const double c = oc.squaredNorm() - radius * radius;
+    const double discriminant = b * b - 4.0 * a * c;
+    if (discriminant < 0.0) {
+        return 0.0;
+    }
+    const double t = (-b - std::sqrt(discriminant)) / (2.0 * a);
+    return t > 0.0 ? t : 0.0;
+}
+
+}  // unnamed namespace
+
+std::shared_ptr<geometry::RGBDImage> CreateSphereRGBDImage(
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        const Eigen::Matrix4d &extrinsic,
+        const Eigen::Vector3d &center,
+        double radius) {
+    auto rgbd = std::make_shared<geometry::RGBDImage>();
+    rgbd->color_.Prepare(intrinsic.width_, intrinsic.height_, 3, 1);
+    rgbd->depth_.Prepare(intrinsic.width_, intrinsic.height_, 1, 4);
+    const Eigen::Matrix4d pose = extrinsic.inverse();
+    for (int v = 0; v < intrinsic.height_; v++) {
+        for (int u = 0; u < intrinsic.width_; u++) {
+            *rgbd->depth_.PointerAt<float>(u, v) = (float)SphereDepthAt(
+                    intrinsic, pose, center, radius, u, v);
+            for (int i = 0; i < 3; i++) {
+                *rgbd->color_.PointerAt<uint8_t>(u, v, i) = 128;
+            }
+        }
+    }
+    return rgbd;
+}
+
+void ExpectRayCastOnSphere(const integration::TSDFVolume &volume,
+                           const camera::PinholeCameraIntrinsic &intrinsic,
+                           const Eigen::Matrix4d &extrinsic,
+                           const Eigen::Vector3d &center,
+                           double radius,
+                           double tolerance,
+                           double min_coverage) {
+    std::shared_ptr<geometry::Image> depth, vertex, normal, color;
+    std::tie(depth, vertex, normal, color) =
+            volume.RayCast(intrinsic, extrinsic);
+    EXPECT_EQ(depth->width_, intrinsic.width_);
+    EXPECT_EQ(depth->height_, intrinsic.height_);
+    EXPECT_EQ(vertex->num_of_channels_, 3);
+    EXPECT_EQ(normal->num_of_channels_, 3);
+
+    // Rays close to the silhouette graze the surface, where the depth is
+    // ill-conditioned and the hit may even lie just outside the sphere. All
+    // hits must lie on the sphere, the depth and normal are only compared
+    // where the surface is at most 60 degrees from facing the camera.
+    const Eigen::Matrix4d pose = extrinsic.inverse();
+    const Eigen::Vector3d origin = pose.block<3, 1>(0, 3);
+    int num_visible = 0;
+    int num_hits = 0;
+    double max_radial_error = 0.0;
+    double max_depth_error = 0.0;
+    double min_normal_dot = 1.0;
+    for (int v = 0; v < depth->height_; v++) {
+        for (int u = 0; u < depth->width_; u++) {
+            const double d_gt =
+                    SphereDepthAt(intrinsic, pose, center, radius, u, v);
+            const double d = *depth->PointerAt<float>(u, v);
+            if (d_gt > 0.0) {
+                num_visible++;
+            }
+            if (d <= 0.0) {
+                continue;
+            }
+            num_hits++;
+            const Eigen::Vector3d p(*vertex->PointerAt<float>(u, v, 0),
+                                    *vertex->PointerAt<float>(u, v, 1),
+                                    *vertex->PointerAt<float>(u, v, 2));
+            const Eigen::Vector3d n(*normal->PointerAt<float>(u, v, 0),
+                                    *normal->PointerAt<float>(u, v, 1),
+                                    *normal->PointerAt<float>(u, v, 2));
+            // The vertex is the hit point of the pixel ray in world
+            // coordinates.
+            const Eigen::Vector4d p_camera =
+                    extrinsic * Eigen::Vector4d(p(0), p(1), p(2), 1.0);
+            EXPECT_NEAR(p_camera(2), d, 1e-4);
+            EXPECT_NEAR(n.norm(), 1.0, 1e-4);
+            max_radial_error = std::max(max_radial_error,
+                                        std::abs((p - center).norm() - radius));
+            const Eigen::Vector3d n_gt = (p - center).normalized();
+            if (n_gt.dot((origin - p).normalized()) < 0.5) {
+                continue;
+            }
+            max_depth_error = std::max(max_depth_error, std::abs(d - d_gt));
+            min_normal_dot = std::min(min_normal_dot, n.dot(n_gt));
+        }
+    }
+    EXPECT_GE(num_hits, min_coverage * num_visible);
+    EXPECT_LT(max_radial_error, tolerance);
+    EXPECT_LT(max_depth_error, tolerance);
+    EXPECT_GT(min_normal_dot, 0.97);
+}
+
+}  // namespace unit_test
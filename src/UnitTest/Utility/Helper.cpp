@@ -24,6 +24,55 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <Eigen/Core>
+#include <algorithm>
+#include <map>
+#include <random>
+
+#include "Open3D/Utility/Helper.h"
 #include "TestUtility/UnitTest.h"
 
+using namespace open3d;
+
 TEST(Helper, DISABLED_SplitString) { unit_test::NotImplemented(); }
+
+TEST(Helper, ParallelSort) {
+    std::mt19937 rng(0);
+    std::uniform_int_distribution<int> dist(0, 1000);
+    for (int size : {0, 1, 1000, 1000000}) {
+        std::vector<int> values(size);
+        for (int& value : values) {
+            value = dist(rng);
+        }
+        std::vector<int> sorted = values;
+        std::sort(sorted.begin(), sorted.end());
+        utility::ParallelSort(values.begin(), values.end(), std::less<int>());
+        EXPECT_EQ(values, sorted);
+    }
+}
+
+TEST(Helper, FindFirstOccurrences) {
+    std::mt19937 rng(0);
+    std::uniform_int_distribution<int> dist(0, 100);
+    for (int size : {0, 1, 1000, 100000}) {
+        std::vector<Eigen::Vector2i> keys(size);
+        std::vector<uint8_t> valid(size);
+        for (int i = 0; i < size; i++) {
+            keys[i] = Eigen::Vector2i(dist(rng), dist(rng));
+            valid[i] = i % 7 == 0 ? 0 : 1;
+        }
+        std::vector<int> first_occurrence =
+                utility::FindFirstOccurrences(keys, valid);
+        ASSERT_EQ(int(first_occurrence.size()), size);
+        std::map<std::pair<int, int>, int> key_to_first;
+        for (int i = 0; i < size; i++) {
+            if (!valid[i]) {
+                EXPECT_EQ(first_occurrence[i], i);
+                continue;
+            }
+            auto key = std::make_pair(keys[i](0), keys[i](1));
+            EXPECT_EQ(first_occurrence[i],
+                      key_to_first.emplace(key, i).first->second);
+        }
+    }
+}